@@ -0,0 +1,274 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "Name.h"
+
+#include "EngineMemory.h"
+#include "MemoryTracker.h"
+#include "AssertionMacros.h"
+#include "Char.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+
+
+
+
+namespace Name_Private
+{
+/**
+	Entries are stored in fixed size blocks that are never moved, so readers need no lock.
+*/
+static constexpr uint32 EntriesPerBlockBits = 14;
+static constexpr uint32 EntriesPerBlock = 1 << EntriesPerBlockBits;
+static constexpr uint32 MaxBlocks = 1024;
+/**
+	Chars of all names are packed in blocks of this size.
+*/
+static constexpr uint32 CharsPerBlock = 16 * 1024;
+static constexpr uint32 InitialBuckets = 1024;
+
+struct FNameEntry
+{
+	/**
+		Null terminated string as it was first registered.
+	*/
+	const TCHAR* Data;
+	uint32 Length;
+	/**
+		Case-insensitive hash of Data.
+	*/
+	uint64 Hash;
+};
+
+/**
+	FNV-1a over lower case chars.
+*/
+FORCEINLINE uint64 HashNameIgnoreCase(FStringView Name) noexcept
+{
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for( TCHAR C : Name )
+	{
+		Hash ^= static_cast<uint64>(FChar::ToLower(C));
+		Hash *= 0x100000001b3ull;
+	}
+	return Hash;
+}
+
+FORCEINLINE uint32 GetBucket(uint64 Hash, uint32 Mask) noexcept
+{
+	return static_cast<uint32>(Hash ^ (Hash >> 32)) & Mask;
+}
+
+
+
+/**
+	Global storage of names.
+	Lookup goes through open addressing table of entry indices under mutex.
+*/
+class FNamePool
+{
+public:
+
+	FNamePool()
+	{
+		MEMORY_TAG_SCOPE(Strings);
+
+		Buckets = static_cast<uint32*>(FMemory::Malloc(sizeof(uint32) * InitialBuckets));
+		FMemory::MemZero(Buckets, sizeof(uint32) * InitialBuckets);
+		BucketMask = InitialBuckets - 1;
+
+		// Entry 0 is None and never placed in buckets
+		AddEntry(FStringView(), HashNameIgnoreCase(FStringView()));
+	}
+
+
+public:
+
+	/**
+		@return index of entry equal to Name ignoring case. If not found and bAdd then adds new entry, otherwise returns 0.
+	*/
+	uint32 FindOrAdd(FStringView Name, bool bAdd)
+	{
+		if( Name.IsEmpty() ) return 0;
+
+		const uint64 Hash = HashNameIgnoreCase(Name);
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		uint32 Bucket = GetBucket(Hash, BucketMask);
+		for( ;; )
+		{
+			const uint32 EntryIndex = Buckets[Bucket];
+			if( EntryIndex == 0 ) break;
+
+			const FNameEntry& Entry = GetEntry(EntryIndex);
+			if( Entry.Hash == Hash && FStringView(Entry.Data, Entry.Length).Equals(Name, ESearchCase::IgnoreCase) ) return EntryIndex;
+
+			Bucket = (Bucket + 1) & BucketMask;
+		}
+
+		if( !bAdd ) return 0;
+
+		// Entries, chars and buckets are never freed, charge them to strings
+		MEMORY_TAG_SCOPE(Strings);
+
+		const uint32 NewIndex = AddEntry(Name, Hash);
+		Buckets[Bucket] = NewIndex;
+
+		// Keep load factor under 1/2 so probe sequences stay short
+		if( NewIndex * 2 > BucketMask )
+		{
+			GrowBuckets();
+		}
+
+		return NewIndex;
+	}
+
+	FORCEINLINE const FNameEntry& GetEntry(uint32 Index) const noexcept
+	{
+		check(Index < NumEntries.load(std::memory_order_relaxed));
+		return Blocks[Index >> EntriesPerBlockBits][Index & (EntriesPerBlock - 1)];
+	}
+
+	FORCEINLINE uint32 Num() const noexcept { return NumEntries.load(std::memory_order_acquire); }
+
+
+
+private:
+
+	uint32 AddEntry(FStringView Name, uint64 Hash)
+	{
+		const uint32 Index = NumEntries.load(std::memory_order_relaxed);
+		const uint32 BlockIndex = Index >> EntriesPerBlockBits;
+		checkf(BlockIndex < MaxBlocks, TEXT("Name pool is full"));
+
+		if( Blocks[BlockIndex] == nullptr )
+		{
+			Blocks[BlockIndex] = static_cast<FNameEntry*>(FMemory::Malloc(sizeof(FNameEntry) * EntriesPerBlock));
+		}
+
+		TCHAR* Chars = AllocateChars(Name.Len() + 1);
+		if( !Name.IsEmpty() )
+		{
+			FMemory::MemCpy(Chars, Name.GetData(), sizeof(TCHAR) * Name.Len());
+		}
+		Chars[Name.Len()] = '\0';
+
+		FNameEntry& Entry = Blocks[BlockIndex][Index & (EntriesPerBlock - 1)];
+		Entry.Data = Chars;
+		Entry.Length = Name.Len();
+		Entry.Hash = Hash;
+
+		NumEntries.store(Index + 1, std::memory_order_release);
+		return Index;
+	}
+
+	TCHAR* AllocateChars(uint32 Count)
+	{
+		if( Count > CharsPerBlock )
+		{
+			return static_cast<TCHAR*>(FMemory::Malloc(sizeof(TCHAR) * Count));
+		}
+
+		if( Count > NumFreeChars )
+		{
+			FreeChars = static_cast<TCHAR*>(FMemory::Malloc(sizeof(TCHAR) * CharsPerBlock));
+			NumFreeChars = CharsPerBlock;
+		}
+
+		TCHAR* Result = FreeChars;
+		FreeChars += Count;
+		NumFreeChars -= Count;
+		return Result;
+	}
+
+	void GrowBuckets()
+	{
+		const uint32 NewNumBuckets = (BucketMask + 1) * 2;
+		uint32* NewBuckets = static_cast<uint32*>(FMemory::Malloc(sizeof(uint32) * NewNumBuckets));
+		FMemory::MemZero(NewBuckets, sizeof(uint32) * NewNumBuckets);
+
+		const uint32 NewMask = NewNumBuckets - 1;
+		for( uint32 i = 0; i <= BucketMask; ++i )
+		{
+			const uint32 EntryIndex = Buckets[i];
+			if( EntryIndex == 0 ) continue;
+
+			uint32 Bucket = GetBucket(GetEntry(EntryIndex).Hash, NewMask);
+			while( NewBuckets[Bucket] != 0 )
+			{
+				Bucket = (Bucket + 1) & NewMask;
+			}
+			NewBuckets[Bucket] = EntryIndex;
+		}
+
+		FMemory::Free(Buckets);
+		Buckets = NewBuckets;
+		BucketMask = NewMask;
+	}
+
+
+
+private:
+
+	std::mutex Mutex;
+
+	FNameEntry* Blocks[MaxBlocks] = {};
+	std::atomic<uint32> NumEntries {0};
+
+	uint32* Buckets = nullptr;
+	uint32 BucketMask = 0;
+
+	TCHAR* FreeChars = nullptr;
+	uint32 NumFreeChars = 0;
+};
+
+/**
+	Pool is never destroyed, so names stay valid in destructors of other static objects.
+*/
+static FNamePool& GetNamePool()
+{
+	alignas(FNamePool) static uint8 PoolStorage[sizeof(FNamePool)];
+	static FNamePool* Pool = new(PoolStorage) FNamePool();
+	return *Pool;
+}
+} // namespace Name_Private
+
+
+
+
+
+FName::FName(FStringView Name) : Index(Name_Private::GetNamePool().FindOrAdd(Name, true))
+{
+}
+
+FName::FName(const ANSICHAR* Name)
+{
+	if( Name == nullptr || *Name == '\0' ) return;
+
+	Index = Name_Private::GetNamePool().FindOrAdd(FString::FromAnsi(Name), true);
+}
+
+FName FName::Find(FStringView Name)
+{
+	FName Result;
+	Result.Index = Name_Private::GetNamePool().FindOrAdd(Name, false);
+	return Result;
+}
+
+uint64 FName::GetStringHash() const noexcept
+{
+	return Name_Private::GetNamePool().GetEntry(Index).Hash;
+}
+
+FStringView FName::ToView() const noexcept
+{
+	const Name_Private::FNameEntry& Entry = Name_Private::GetNamePool().GetEntry(Index);
+	return FStringView(Entry.Data, Entry.Length);
+}
+
+uint32 FName::GetNumNames() noexcept
+{
+	return Name_Private::GetNamePool().Num();
+}
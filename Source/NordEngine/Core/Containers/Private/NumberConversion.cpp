@@ -0,0 +1,778 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "NumberConversion.h"
+
+#include "EngineMemory.h"
+#include "AssertionMacros.h"
+
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+
+
+
+
+namespace NumberConversion_Private
+{
+template<typename FloatType>
+struct TFloatTraits;
+
+template<>
+struct TFloatTraits<double>
+{
+	using BitsType = uint64;
+
+	/**
+		Count of mantissa bits with the hidden bit.
+	*/
+	static constexpr int32 Precision = 53;
+	static constexpr int32 ExponentBias = 1023 + (Precision - 1);
+	/**
+		Greatest power of ten that is exact in this type.
+	*/
+	static constexpr int32 MaxExactPow10 = 22;
+	static constexpr int32 MaxMantissaDigits = 15;
+};
+
+template<>
+struct TFloatTraits<float>
+{
+	using BitsType = uint32;
+
+	static constexpr int32 Precision = 24;
+	static constexpr int32 ExponentBias = 127 + (Precision - 1);
+	static constexpr int32 MaxExactPow10 = 10;
+	static constexpr int32 MaxMantissaDigits = 7;
+};
+
+static constexpr double ExactPowersOf10[] = {1e0,  1e1,	 1e2,  1e3,	 1e4,  1e5,	 1e6,  1e7,	 1e8,  1e9,	 1e10, 1e11,
+											 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static constexpr uint64 IntPowersOf10[] = {1ull,
+										   10ull,
+										   100ull,
+										   1000ull,
+										   10000ull,
+										   100000ull,
+										   1000000ull,
+										   10000000ull,
+										   100000000ull,
+										   1000000000ull,
+										   10000000000ull,
+										   100000000000ull,
+										   1000000000000ull,
+										   10000000000000ull,
+										   100000000000000ull,
+										   1000000000000000ull};
+
+
+
+/**
+	Floating point number F * 2^E with 64-bit mantissa used by Grisu.
+*/
+struct FDiyFp
+{
+	uint64 F;
+	int32 E;
+
+	FORCEINLINE constexpr FDiyFp(uint64 InF, int32 InE) noexcept : F(InF), E(InE) { }
+
+	/**
+		X - Y of numbers with the same exponent, X.F >= Y.F.
+	*/
+	static FORCEINLINE FDiyFp Sub(const FDiyFp& X, const FDiyFp& Y) noexcept
+	{
+		return FDiyFp(X.F - Y.F, X.E);
+	}
+	/**
+		Upper half of 128-bit product rounded to nearest.
+	*/
+	static FORCEINLINE FDiyFp Mul(const FDiyFp& X, const FDiyFp& Y) noexcept
+	{
+		const uint64 XLo = X.F & 0xFFFFFFFFu;
+		const uint64 XHi = X.F >> 32;
+		const uint64 YLo = Y.F & 0xFFFFFFFFu;
+		const uint64 YHi = Y.F >> 32;
+
+		const uint64 P0 = XLo * YLo;
+		const uint64 P1 = XLo * YHi;
+		const uint64 P2 = XHi * YLo;
+		const uint64 P3 = XHi * YHi;
+
+		uint64 Q = (P0 >> 32) + (P1 & 0xFFFFFFFFu) + (P2 & 0xFFFFFFFFu);
+		Q += uint64(1) << 31;
+
+		return FDiyFp(P3 + (P2 >> 32) + (P1 >> 32) + (Q >> 32), X.E + Y.E + 64);
+	}
+	/**
+		Shift mantissa so its highest bit is set.
+	*/
+	static FORCEINLINE FDiyFp Normalize(FDiyFp X) noexcept
+	{
+		while( (X.F >> 63) == 0 )
+		{
+			X.F <<= 1;
+			--X.E;
+		}
+		return X;
+	}
+	static FORCEINLINE FDiyFp NormalizeTo(const FDiyFp& X, int32 TargetExponent) noexcept
+	{
+		return FDiyFp(X.F << (X.E - TargetExponent), TargetExponent);
+	}
+};
+
+/**
+	Value and boundaries of its rounding interval, Minus and Plus share exponent.
+*/
+struct FBoundaries
+{
+	FDiyFp W;
+	FDiyFp Minus;
+	FDiyFp Plus;
+};
+
+template<typename FloatType>
+FBoundaries ComputeBoundaries(FloatType Value) noexcept
+{
+	using FTraits = TFloatTraits<FloatType>;
+	using BitsType = typename FTraits::BitsType;
+
+	constexpr int32 MinExponent = 1 - FTraits::ExponentBias;
+	constexpr uint64 HiddenBit = uint64(1) << (FTraits::Precision - 1);
+
+	BitsType Bits;
+	FMemory::MemCpy(&Bits, &Value, sizeof(Bits));
+
+	const uint64 BiasedExponent = static_cast<uint64>(Bits) >> (FTraits::Precision - 1);
+	const uint64 Fraction = static_cast<uint64>(Bits) & (HiddenBit - 1);
+
+	const bool bDenormal = BiasedExponent == 0;
+	const FDiyFp V = bDenormal ? FDiyFp(Fraction, MinExponent) : FDiyFp(Fraction + HiddenBit, static_cast<int32>(BiasedExponent) - FTraits::ExponentBias);
+
+	// Lower neighbour is closer when value is power of two, except the smallest normal
+	const bool bLowerBoundaryIsCloser = Fraction == 0 && BiasedExponent > 1;
+	const FDiyFp MPlus(2 * V.F + 1, V.E - 1);
+	const FDiyFp MMinus = bLowerBoundaryIsCloser ? FDiyFp(4 * V.F - 1, V.E - 2) : FDiyFp(2 * V.F - 1, V.E - 1);
+
+	const FDiyFp WPlus = FDiyFp::Normalize(MPlus);
+	const FDiyFp WMinus = FDiyFp::NormalizeTo(MMinus, WPlus.E);
+
+	return {FDiyFp::Normalize(V), WMinus, WPlus};
+}
+
+
+
+/**
+	Normalized 10^K = F * 2^E.
+*/
+struct FCachedPower
+{
+	uint64 F;
+	int32 E;
+	int32 K;
+};
+
+/**
+	Exponent range of scaled value, so its integral part fits 32 bits.
+*/
+static constexpr int32 Alpha = -60;
+static constexpr int32 Gamma = -32;
+
+/**
+	@return cached power c, so Alpha <= c.E + E + 64 <= Gamma.
+*/
+static FCachedPower GetCachedPowerForBinaryExponent(int32 E) noexcept
+{
+	// clang-format off
+	static constexpr FCachedPower CachedPowers[] = {
+		{ 0xAB70FE17C79AC6CAull, -1060, -300 },
+		{ 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+		{ 0xBE5691EF416BD60Cull, -1007, -284 },
+		{ 0x8DD01FAD907FFC3Cull, -980, -276 },
+		{ 0xD3515C2831559A83ull, -954, -268 },
+		{ 0x9D71AC8FADA6C9B5ull, -927, -260 },
+		{ 0xEA9C227723EE8BCBull, -901, -252 },
+		{ 0xAECC49914078536Dull, -874, -244 },
+		{ 0x823C12795DB6CE57ull, -847, -236 },
+		{ 0xC21094364DFB5637ull, -821, -228 },
+		{ 0x9096EA6F3848984Full, -794, -220 },
+		{ 0xD77485CB25823AC7ull, -768, -212 },
+		{ 0xA086CFCD97BF97F4ull, -741, -204 },
+		{ 0xEF340A98172AACE5ull, -715, -196 },
+		{ 0xB23867FB2A35B28Eull, -688, -188 },
+		{ 0x84C8D4DFD2C63F3Bull, -661, -180 },
+		{ 0xC5DD44271AD3CDBAull, -635, -172 },
+		{ 0x936B9FCEBB25C996ull, -608, -164 },
+		{ 0xDBAC6C247D62A584ull, -582, -156 },
+		{ 0xA3AB66580D5FDAF6ull, -555, -148 },
+		{ 0xF3E2F893DEC3F126ull, -529, -140 },
+		{ 0xB5B5ADA8AAFF80B8ull, -502, -132 },
+		{ 0x87625F056C7C4A8Bull, -475, -124 },
+		{ 0xC9BCFF6034C13053ull, -449, -116 },
+		{ 0x964E858C91BA2655ull, -422, -108 },
+		{ 0xDFF9772470297EBDull, -396, -100 },
+		{ 0xA6DFBD9FB8E5B88Full, -369, -92 },
+		{ 0xF8A95FCF88747D94ull, -343, -84 },
+		{ 0xB94470938FA89BCFull, -316, -76 },
+		{ 0x8A08F0F8BF0F156Bull, -289, -68 },
+		{ 0xCDB02555653131B6ull, -263, -60 },
+		{ 0x993FE2C6D07B7FACull, -236, -52 },
+		{ 0xE45C10C42A2B3B06ull, -210, -44 },
+		{ 0xAA242499697392D3ull, -183, -36 },
+		{ 0xFD87B5F28300CA0Eull, -157, -28 },
+		{ 0xBCE5086492111AEBull, -130, -20 },
+		{ 0x8CBCCC096F5088CCull, -103, -12 },
+		{ 0xD1B71758E219652Cull, -77, -4 },
+		{ 0x9C40000000000000ull, -50, 4 },
+		{ 0xE8D4A51000000000ull, -24, 12 },
+		{ 0xAD78EBC5AC620000ull, 3, 20 },
+		{ 0x813F3978F8940984ull, 30, 28 },
+		{ 0xC097CE7BC90715B3ull, 56, 36 },
+		{ 0x8F7E32CE7BEA5C70ull, 83, 44 },
+		{ 0xD5D238A4ABE98068ull, 109, 52 },
+		{ 0x9F4F2726179A2245ull, 136, 60 },
+		{ 0xED63A231D4C4FB27ull, 162, 68 },
+		{ 0xB0DE65388CC8ADA8ull, 189, 76 },
+		{ 0x83C7088E1AAB65DBull, 216, 84 },
+		{ 0xC45D1DF942711D9Aull, 242, 92 },
+		{ 0x924D692CA61BE758ull, 269, 100 },
+		{ 0xDA01EE641A708DEAull, 295, 108 },
+		{ 0xA26DA3999AEF774Aull, 322, 116 },
+		{ 0xF209787BB47D6B85ull, 348, 124 },
+		{ 0xB454E4A179DD1877ull, 375, 132 },
+		{ 0x865B86925B9BC5C2ull, 402, 140 },
+		{ 0xC83553C5C8965D3Dull, 428, 148 },
+		{ 0x952AB45CFA97A0B3ull, 455, 156 },
+		{ 0xDE469FBD99A05FE3ull, 481, 164 },
+		{ 0xA59BC234DB398C25ull, 508, 172 },
+		{ 0xF6C69A72A3989F5Cull, 534, 180 },
+		{ 0xB7DCBF5354E9BECEull, 561, 188 },
+		{ 0x88FCF317F22241E2ull, 588, 196 },
+		{ 0xCC20CE9BD35C78A5ull, 614, 204 },
+		{ 0x98165AF37B2153DFull, 641, 212 },
+		{ 0xE2A0B5DC971F303Aull, 667, 220 },
+		{ 0xA8D9D1535CE3B396ull, 694, 228 },
+		{ 0xFB9B7CD9A4A7443Cull, 720, 236 },
+		{ 0xBB764C4CA7A44410ull, 747, 244 },
+		{ 0x8BAB8EEFB6409C1Aull, 774, 252 },
+		{ 0xD01FEF10A657842Cull, 800, 260 },
+		{ 0x9B10A4E5E9913129ull, 827, 268 },
+		{ 0xE7109BFBA19C0C9Dull, 853, 276 },
+		{ 0xAC2820D9623BF429ull, 880, 284 },
+		{ 0x80444B5E7AA7CF85ull, 907, 292 },
+		{ 0xBF21E44003ACDD2Dull, 933, 300 },
+		{ 0x8E679C2F5E44FF8Full, 960, 308 },
+		{ 0xD433179D9C8CB841ull, 986, 316 },
+		{ 0x9E19DB92B4E31BA9ull, 1013, 324 },
+	};
+	// clang-format on
+	constexpr int32 CachedPowersMinDecExp = -300;
+	constexpr int32 CachedPowersDecStep = 8;
+
+	// K = ceil((Alpha - E - 1) * log10(2))
+	const int32 F = Alpha - E - 1;
+	const int32 K = (F * 78913) / (1 << 18) + static_cast<int32>(F > 0);
+
+	const int32 Index = (-CachedPowersMinDecExp + K + (CachedPowersDecStep - 1)) / CachedPowersDecStep;
+	check(Index >= 0 && Index < static_cast<int32>(sizeof(CachedPowers) / sizeof(CachedPowers[0])));
+
+	const FCachedPower Cached = CachedPowers[Index];
+	check(Alpha <= Cached.E + E + 64 && Cached.E + E + 64 <= Gamma);
+	return Cached;
+}
+
+/**
+	@return count of decimal digits N of Value, so 10^(N-1) <= Value < 10^N. OutPow10 is 10^(N-1).
+*/
+static FORCEINLINE int32 FindLargestPow10(uint32 Value, uint32& OutPow10) noexcept
+{
+	int32 NumDigits = 10;
+	OutPow10 = 1000000000;
+	while( NumDigits > 1 && Value < OutPow10 )
+	{
+		OutPow10 /= 10;
+		--NumDigits;
+	}
+	return NumDigits;
+}
+
+/**
+	Move last digit down while result stays inside rounding interval and gets closer to the exact value.
+*/
+static FORCEINLINE void Grisu2Round(ANSICHAR* Buffer, int32 Length, uint64 Distance, uint64 Delta, uint64 Rest, uint64 TenK) noexcept
+{
+	while( Rest < Distance && Delta - Rest >= TenK && (Rest + TenK < Distance || Distance - Rest > Rest + TenK - Distance) )
+	{
+		--Buffer[Length - 1];
+		Rest += TenK;
+	}
+}
+
+/**
+	Generate shortest digits of value inside (MMinus, MPlus).
+*/
+static void Grisu2DigitGen(ANSICHAR* Buffer, int32& Length, int32& DecimalExponent, FDiyFp MMinus, FDiyFp W, FDiyFp MPlus) noexcept
+{
+	uint64 Delta = FDiyFp::Sub(MPlus, MMinus).F;
+	uint64 Distance = FDiyFp::Sub(MPlus, W).F;
+
+	// Split MPlus into integral part P1 and fractional part P2
+	const FDiyFp One(uint64(1) << -MPlus.E, MPlus.E);
+
+	uint32 P1 = static_cast<uint32>(MPlus.F >> -One.E);
+	uint64 P2 = MPlus.F & (One.F - 1);
+
+	uint32 Pow10;
+	int32 N = FindLargestPow10(P1, Pow10);
+
+	while( N > 0 )
+	{
+		const uint32 Digit = P1 / Pow10;
+		P1 %= Pow10;
+		Buffer[Length++] = static_cast<ANSICHAR>('0' + Digit);
+		--N;
+
+		const uint64 Rest = (static_cast<uint64>(P1) << -One.E) + P2;
+		if( Rest <= Delta )
+		{
+			DecimalExponent += N;
+			Grisu2Round(Buffer, Length, Distance, Delta, Rest, static_cast<uint64>(Pow10) << -One.E);
+			return;
+		}
+
+		Pow10 /= 10;
+	}
+
+	int32 M = 0;
+	for( ;; )
+	{
+		P2 *= 10;
+		const uint64 Digit = P2 >> -One.E;
+		P2 &= One.F - 1;
+		Buffer[Length++] = static_cast<ANSICHAR>('0' + Digit);
+		++M;
+
+		Delta *= 10;
+		Distance *= 10;
+		if( P2 <= Delta ) break;
+	}
+
+	DecimalExponent -= M;
+	Grisu2Round(Buffer, Length, Distance, Delta, P2, One.F);
+}
+
+/**
+	Write shortest digits of positive finite value, so Value = Digits * 10^DecimalExponent.
+*/
+template<typename FloatType>
+static void Grisu2(ANSICHAR* Buffer, int32& Length, int32& DecimalExponent, FloatType Value) noexcept
+{
+	const FBoundaries Boundaries = ComputeBoundaries(Value);
+
+	const FCachedPower Cached = GetCachedPowerForBinaryExponent(Boundaries.Plus.E);
+	const FDiyFp CMinusK(Cached.F, Cached.E);
+
+	const FDiyFp W = FDiyFp::Mul(Boundaries.W, CMinusK);
+	const FDiyFp WMinus = FDiyFp::Mul(Boundaries.Minus, CMinusK);
+	const FDiyFp WPlus = FDiyFp::Mul(Boundaries.Plus, CMinusK);
+
+	// Shrink interval by one ulp of multiplication error on both sides
+	const FDiyFp MMinus(WMinus.F + 1, WMinus.E);
+	const FDiyFp MPlus(WPlus.F - 1, WPlus.E);
+
+	Length = 0;
+	DecimalExponent = -Cached.K;
+	Grisu2DigitGen(Buffer, Length, DecimalExponent, MMinus, W, MPlus);
+}
+
+static FORCEINLINE ANSICHAR* AppendExponent(ANSICHAR* Buffer, int32 Exponent) noexcept
+{
+	if( Exponent < 0 )
+	{
+		Exponent = -Exponent;
+		*Buffer++ = '-';
+	}
+	else
+	{
+		*Buffer++ = '+';
+	}
+
+	// At least two digits like printf
+	if( Exponent < 10 )
+	{
+		*Buffer++ = '0';
+	}
+	else if( Exponent >= 100 )
+	{
+		*Buffer++ = static_cast<ANSICHAR>('0' + Exponent / 100);
+		Exponent %= 100;
+		*Buffer++ = static_cast<ANSICHAR>('0' + Exponent / 10);
+		Exponent %= 10;
+	}
+	else
+	{
+		*Buffer++ = static_cast<ANSICHAR>('0' + Exponent / 10);
+		Exponent %= 10;
+	}
+	*Buffer++ = static_cast<ANSICHAR>('0' + Exponent);
+
+	return Buffer;
+}
+
+/**
+	Place decimal point into Length digits in the beginning of Buffer.
+
+	@return end of written chars.
+*/
+static ANSICHAR* FormatDigits(ANSICHAR* Buffer, int32 Length, int32 DecimalExponent) noexcept
+{
+	constexpr int32 MinExponent = -4;
+	constexpr int32 MaxExponent = 15;
+
+	// Position of decimal point relative to the first digit
+	const int32 N = Length + DecimalExponent;
+
+	if( Length <= N && N <= MaxExponent )
+	{
+		// digits[000].0
+		FMemory::MemSet(Buffer + Length, '0', static_cast<SIZE_T>(N - Length));
+		Buffer[N] = '.';
+		Buffer[N + 1] = '0';
+		return Buffer + N + 2;
+	}
+
+	if( 0 < N && N <= MaxExponent )
+	{
+		// dig.its
+		FMemory::MemMove(Buffer + N + 1, Buffer + N, static_cast<SIZE_T>(Length - N));
+		Buffer[N] = '.';
+		return Buffer + Length + 1;
+	}
+
+	if( MinExponent < N && N <= 0 )
+	{
+		// 0.[000]digits
+		FMemory::MemMove(Buffer + 2 - N, Buffer, static_cast<SIZE_T>(Length));
+		Buffer[0] = '0';
+		Buffer[1] = '.';
+		FMemory::MemSet(Buffer + 2, '0', static_cast<SIZE_T>(-N));
+		return Buffer + 2 - N + Length;
+	}
+
+	if( Length == 1 )
+	{
+		// de+123
+		++Buffer;
+	}
+	else
+	{
+		// d.igitse+123
+		FMemory::MemMove(Buffer + 2, Buffer + 1, static_cast<SIZE_T>(Length - 1));
+		Buffer[1] = '.';
+		Buffer += Length + 1;
+	}
+
+	*Buffer++ = 'e';
+	return AppendExponent(Buffer, N - 1);
+}
+
+template<typename FloatType>
+static uint32 FormatShortestImpl(FloatType Value, ANSICHAR* Buffer) noexcept
+{
+	ANSICHAR* It = Buffer;
+
+	if( Value != Value )
+	{
+		FMemory::MemCpy(It, "nan", 3);
+		return 3;
+	}
+
+	if( std::signbit(Value) )
+	{
+		*It++ = '-';
+		Value = -Value;
+	}
+
+	if( Value == std::numeric_limits<FloatType>::infinity() )
+	{
+		FMemory::MemCpy(It, "inf", 3);
+		return static_cast<uint32>(It + 3 - Buffer);
+	}
+
+	if( Value == 0 )
+	{
+		*It++ = '0';
+		*It++ = '.';
+		*It++ = '0';
+		return static_cast<uint32>(It - Buffer);
+	}
+
+	int32 Length;
+	int32 DecimalExponent;
+	Grisu2(It, Length, DecimalExponent, Value);
+
+	It = FormatDigits(It, Length, DecimalExponent);
+	check(It - Buffer <= static_cast<int32>(FNumberConversion::MaxFloatChars));
+	return static_cast<uint32>(It - Buffer);
+}
+
+
+
+template<typename CharType>
+static FORCEINLINE bool IsDigit(CharType C) noexcept
+{
+	return C >= '0' && C <= '9';
+}
+
+/**
+	Check that text starts with lower case Word ignoring case.
+*/
+template<typename CharType>
+static bool StartsWithIgnoreCase(const CharType* First, const CharType* Last, const ANSICHAR* Word) noexcept
+{
+	for( ; *Word != '\0'; ++Word, ++First )
+	{
+		if( First == Last ) return false;
+
+		const CharType C = (*First >= 'A' && *First <= 'Z') ? static_cast<CharType>(*First - 'A' + 'a') : *First;
+		if( C != static_cast<CharType>(*Word) ) return false;
+	}
+	return true;
+}
+
+/**
+	Parse number, first by exact fast path of Clinger's algorithm and by correctly rounded std::from_chars otherwise.
+	std::from_chars does not depend on C locale, unlike strtod.
+*/
+template<typename FloatType, typename CharType>
+static TNumberParseResult<CharType> ParseFloatImpl(const CharType* First, const CharType* Last, FloatType& OutValue) noexcept
+{
+	using FTraits = TFloatTraits<FloatType>;
+
+	const CharType* It = First;
+
+	bool bNegative = false;
+	if( It != Last && (*It == '-' || *It == '+') )
+	{
+		bNegative = *It == '-';
+		++It;
+	}
+
+	if( It != Last && !IsDigit(*It) && *It != '.' )
+	{
+		FloatType Special;
+		if( StartsWithIgnoreCase(It, Last, "infinity") )
+		{
+			It += 8;
+			Special = std::numeric_limits<FloatType>::infinity();
+		}
+		else if( StartsWithIgnoreCase(It, Last, "inf") )
+		{
+			It += 3;
+			Special = std::numeric_limits<FloatType>::infinity();
+		}
+		else if( StartsWithIgnoreCase(It, Last, "nan") )
+		{
+			It += 3;
+			Special = std::numeric_limits<FloatType>::quiet_NaN();
+		}
+		else
+		{
+			return {First, ENumberParseError::Invalid};
+		}
+
+		OutValue = bNegative ? -Special : Special;
+		return {It, ENumberParseError::None};
+	}
+
+	// Up to 19 significant digits always fit 64 bits
+	constexpr int32 MaxSignificantDigits = 19;
+
+	uint64 Mantissa = 0;
+	int32 NumSignificantDigits = 0;
+	int32 Exponent10 = 0;
+	bool bTruncated = false;
+	bool bHasDigits = false;
+
+	for( ; It != Last && IsDigit(*It); ++It )
+	{
+		bHasDigits = true;
+		const uint32 Digit = static_cast<uint32>(*It - '0');
+		if( NumSignificantDigits < MaxSignificantDigits )
+		{
+			Mantissa = Mantissa * 10 + Digit;
+			NumSignificantDigits += Mantissa != 0;
+		}
+		else
+		{
+			++Exponent10;
+			bTruncated |= Digit != 0;
+		}
+	}
+
+	if( It != Last && *It == '.' )
+	{
+		++It;
+		for( ; It != Last && IsDigit(*It); ++It )
+		{
+			bHasDigits = true;
+			const uint32 Digit = static_cast<uint32>(*It - '0');
+			if( NumSignificantDigits < MaxSignificantDigits )
+			{
+				Mantissa = Mantissa * 10 + Digit;
+				NumSignificantDigits += Mantissa != 0;
+				--Exponent10;
+			}
+			else
+			{
+				bTruncated |= Digit != 0;
+			}
+		}
+	}
+
+	if( !bHasDigits ) return {First, ENumberParseError::Invalid};
+
+	// Exponent is consumed only when it has digits, "1e" is parsed as "1"
+	if( It != Last && (*It == 'e' || *It == 'E') )
+	{
+		const CharType* ExponentIt = It + 1;
+
+		bool bNegativeExponent = false;
+		if( ExponentIt != Last && (*ExponentIt == '-' || *ExponentIt == '+') )
+		{
+			bNegativeExponent = *ExponentIt == '-';
+			++ExponentIt;
+		}
+
+		if( ExponentIt != Last && IsDigit(*ExponentIt) )
+		{
+			int32 Exponent = 0;
+			for( ; ExponentIt != Last && IsDigit(*ExponentIt); ++ExponentIt )
+			{
+				// Saturate, anything above is out of range anyway
+				if( Exponent < 100000 )
+				{
+					Exponent = Exponent * 10 + static_cast<int32>(*ExponentIt - '0');
+				}
+			}
+
+			Exponent10 += bNegativeExponent ? -Exponent : Exponent;
+			It = ExponentIt;
+		}
+	}
+
+	constexpr uint64 MaxExactMantissa = uint64(1) << FTraits::Precision;
+	if( !bTruncated && Mantissa <= MaxExactMantissa )
+	{
+		// Mantissa and power of ten are exact, so single operation is correctly rounded. "0e999" is zero as well
+		bool bExact = true;
+		FloatType Value = static_cast<FloatType>(Mantissa);
+		if( Mantissa != 0 && Exponent10 > 0 && Exponent10 <= FTraits::MaxExactPow10 )
+		{
+			Value *= static_cast<FloatType>(ExactPowersOf10[Exponent10]);
+		}
+		else if( Mantissa != 0 && Exponent10 < 0 && Exponent10 >= -FTraits::MaxExactPow10 )
+		{
+			Value /= static_cast<FloatType>(ExactPowersOf10[-Exponent10]);
+		}
+		else if( Mantissa != 0 && Exponent10 > FTraits::MaxExactPow10 && Exponent10 <= FTraits::MaxExactPow10 + FTraits::MaxMantissaDigits )
+		{
+			// Move extra zeros into mantissa when it stays exact: 123e25 = 123000e22
+			const uint64 Scale = IntPowersOf10[Exponent10 - FTraits::MaxExactPow10];
+			bExact = Mantissa <= MaxExactMantissa / Scale;
+			Value = static_cast<FloatType>(Mantissa * Scale) * static_cast<FloatType>(ExactPowersOf10[FTraits::MaxExactPow10]);
+		}
+		else if( Mantissa != 0 && Exponent10 != 0 )
+		{
+			bExact = false;
+		}
+
+		if( bExact )
+		{
+			OutValue = bNegative ? -Value : Value;
+			return {It, ENumberParseError::None};
+		}
+	}
+
+	// Text is validated already, so from_chars parses exactly the same chars. It does not accept plus sign.
+	if( *First == '+' )
+	{
+		++First;
+	}
+	const SIZE_T NumChars = static_cast<SIZE_T>(It - First);
+	constexpr SIZE_T StackBufferSize = 128;
+	ANSICHAR StackBuffer[StackBufferSize];
+	ANSICHAR* const Text = NumChars <= StackBufferSize ? StackBuffer : static_cast<ANSICHAR*>(FMemory::Malloc(NumChars));
+	for( SIZE_T i = 0; i < NumChars; ++i )
+	{
+		Text[i] = static_cast<ANSICHAR>(First[i]);
+	}
+
+	FloatType Value = 0;
+	const std::from_chars_result Result = std::from_chars(Text, Text + NumChars, Value);
+
+	if( Text != StackBuffer )
+	{
+		FMemory::Free(Text);
+	}
+
+	if( Result.ec != std::errc() || Value == std::numeric_limits<FloatType>::infinity() || Value == -std::numeric_limits<FloatType>::infinity() || (Value == 0 && Mantissa != 0) )
+	{
+		return {It, ENumberParseError::OutOfRange};
+	}
+
+	OutValue = Value;
+	return {It, ENumberParseError::None};
+}
+} // namespace NumberConversion_Private
+
+
+
+
+
+uint32 FNumberConversion::FormatShortest(float Value, ANSICHAR* Buffer) noexcept
+{
+	return NumberConversion_Private::FormatShortestImpl(Value, Buffer);
+}
+
+uint32 FNumberConversion::FormatShortest(double Value, ANSICHAR* Buffer) noexcept
+{
+	return NumberConversion_Private::FormatShortestImpl(Value, Buffer);
+}
+
+uint32 FNumberConversion::FormatFixedAnsi(double Value, int32 Precision, ANSICHAR* Buffer) noexcept
+{
+	checkf(Precision >= 0 && Precision <= static_cast<int32>(MaxFixedPrecision), TEXT("Fixed precision is out of range"));
+
+	if( Value != Value )
+	{
+		FMemory::MemCpy(Buffer, "nan", 3);
+		return 3;
+	}
+
+	// std::to_chars does not depend on C locale, unlike printf
+	const std::to_chars_result Result = std::to_chars(Buffer, Buffer + MaxFixedChars, Value, std::chars_format::fixed, Precision);
+	check(Result.ec == std::errc());
+	return static_cast<uint32>(Result.ptr - Buffer);
+}
+
+TNumberParseResult<ANSICHAR> FNumberConversion::ParseFloat(const ANSICHAR* First, const ANSICHAR* Last, float& OutValue) noexcept
+{
+	return NumberConversion_Private::ParseFloatImpl(First, Last, OutValue);
+}
+
+TNumberParseResult<ANSICHAR> FNumberConversion::ParseFloat(const ANSICHAR* First, const ANSICHAR* Last, double& OutValue) noexcept
+{
+	return NumberConversion_Private::ParseFloatImpl(First, Last, OutValue);
+}
+
+TNumberParseResult<WIDECHAR> FNumberConversion::ParseFloat(const WIDECHAR* First, const WIDECHAR* Last, float& OutValue) noexcept
+{
+	return NumberConversion_Private::ParseFloatImpl(First, Last, OutValue);
+}
+
+TNumberParseResult<WIDECHAR> FNumberConversion::ParseFloat(const WIDECHAR* First, const WIDECHAR* Last, double& OutValue) noexcept
+{
+	return NumberConversion_Private::ParseFloatImpl(First, Last, OutValue);
+}
@@ -0,0 +1,461 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "StringConversion.h"
+
+#include "EngineMath.h"
+
+// We require SSE2
+#include <emmintrin.h>
+
+
+
+
+
+namespace StringConversion_Private
+{
+static_assert(sizeof(WIDECHAR) == 2 || sizeof(WIDECHAR) == 4, "Unsupported WIDECHAR size.");
+
+/**
+	True when WIDECHAR holds UTF-16 code units.
+*/
+static constexpr bool bWideIsUtf16 = sizeof(WIDECHAR) == 2;
+static constexpr uint32 BlockBytes = 16;
+
+FORCEINLINE __m128i LoadBytes(const void* P) noexcept
+{
+	return _mm_loadu_si128(static_cast<const __m128i*>(P));
+}
+
+FORCEINLINE void StoreBytes(void* P, __m128i V) noexcept
+{
+	_mm_storeu_si128(static_cast<__m128i*>(P), V);
+}
+
+/**
+	@return mask with bit set for every non-ASCII byte of 16 bytes block.
+*/
+FORCEINLINE uint32 NonAsciiMask(const ANSICHAR* Src) noexcept
+{
+	return static_cast<uint32>(_mm_movemask_epi8(LoadBytes(Src)));
+}
+
+/**
+	Zero extend 16 bytes into 16 wide chars.
+*/
+FORCEINLINE void WidenBlock(const ANSICHAR* Src, WIDECHAR* Dest) noexcept
+{
+	const __m128i Zero = _mm_setzero_si128();
+	const __m128i Bytes = LoadBytes(Src);
+	const __m128i Lo = _mm_unpacklo_epi8(Bytes, Zero);
+	const __m128i Hi = _mm_unpackhi_epi8(Bytes, Zero);
+
+	if constexpr( bWideIsUtf16 )
+	{
+		StoreBytes(Dest, Lo);
+		StoreBytes(Dest + 8, Hi);
+	}
+	else
+	{
+		StoreBytes(Dest, _mm_unpacklo_epi16(Lo, Zero));
+		StoreBytes(Dest + 4, _mm_unpackhi_epi16(Lo, Zero));
+		StoreBytes(Dest + 8, _mm_unpacklo_epi16(Hi, Zero));
+		StoreBytes(Dest + 12, _mm_unpackhi_epi16(Hi, Zero));
+	}
+}
+
+/**
+	Check that all of 16 wide chars are below Limit, Limit is 0x80 or 0x100.
+*/
+FORCEINLINE bool IsBlockBelow(const WIDECHAR* Src, uint32 Limit) noexcept
+{
+	const __m128i Zero = _mm_setzero_si128();
+
+	if constexpr( bWideIsUtf16 )
+	{
+		const __m128i HighBits = _mm_set1_epi16(static_cast<int16>(~(Limit - 1)));
+		const __m128i Outside = _mm_and_si128(_mm_or_si128(LoadBytes(Src), LoadBytes(Src + 8)), HighBits);
+		return _mm_movemask_epi8(_mm_cmpeq_epi16(Outside, Zero)) == 0xFFFF;
+	}
+	else
+	{
+		const __m128i HighBits = _mm_set1_epi32(static_cast<int32>(~(Limit - 1)));
+		const __m128i Any = _mm_or_si128(_mm_or_si128(LoadBytes(Src), LoadBytes(Src + 4)), _mm_or_si128(LoadBytes(Src + 8), LoadBytes(Src + 12)));
+		return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(Any, HighBits), Zero)) == 0xFFFF;
+	}
+}
+
+/**
+	Narrow 16 wide chars below 0x100 into 16 bytes.
+*/
+FORCEINLINE void NarrowBlock(const WIDECHAR* Src, ANSICHAR* Dest) noexcept
+{
+	if constexpr( bWideIsUtf16 )
+	{
+		StoreBytes(Dest, _mm_packus_epi16(LoadBytes(Src), LoadBytes(Src + 8)));
+	}
+	else
+	{
+		// Values fit 8 bits, so signed saturation to 16 bits keeps them as is
+		const __m128i Lo = _mm_packs_epi32(LoadBytes(Src), LoadBytes(Src + 4));
+		const __m128i Hi = _mm_packs_epi32(LoadBytes(Src + 8), LoadBytes(Src + 12));
+		StoreBytes(Dest, _mm_packus_epi16(Lo, Hi));
+	}
+}
+
+FORCEINLINE bool IsContinuation(uint8 Byte) noexcept
+{
+	return (Byte & 0xC0) == 0x80;
+}
+
+/**
+	Result of decoding malformed UTF-8 sequence.
+*/
+static constexpr uint32 InvalidCodePoint = 0xFFFFFFFF;
+
+/**
+	Decode one code point from UTF-8 that does not start with ASCII byte.
+	Malformed sequence gives InvalidCodePoint and consumes its maximal valid prefix, at least one byte.
+
+	@return count of consumed bytes.
+*/
+static uint32 DecodeUtf8(const uint8* Src, uint32 SrcLen, uint32& OutCodePoint) noexcept
+{
+	const uint8 Lead = Src[0];
+
+	uint32 Length;
+	uint8 SecondMin = 0x80;
+	uint8 SecondMax = 0xBF;
+	if( Lead >= 0xC2 && Lead <= 0xDF )
+	{
+		Length = 2;
+		OutCodePoint = Lead & 0x1F;
+	}
+	else if( Lead >= 0xE0 && Lead <= 0xEF )
+	{
+		Length = 3;
+		OutCodePoint = Lead & 0x0F;
+		// No overlong forms and no surrogates
+		if( Lead == 0xE0 ) SecondMin = 0xA0;
+		if( Lead == 0xED ) SecondMax = 0x9F;
+	}
+	else if( Lead >= 0xF0 && Lead <= 0xF4 )
+	{
+		Length = 4;
+		OutCodePoint = Lead & 0x07;
+		// No overlong forms and nothing above U+10FFFF
+		if( Lead == 0xF0 ) SecondMin = 0x90;
+		if( Lead == 0xF4 ) SecondMax = 0x8F;
+	}
+	else
+	{
+		OutCodePoint = InvalidCodePoint;
+		return 1;
+	}
+
+	for( uint32 i = 1; i < Length; ++i )
+	{
+		const bool bValid = i < SrcLen && (i == 1 ? (Src[1] >= SecondMin && Src[1] <= SecondMax) : IsContinuation(Src[i]));
+		if( !bValid )
+		{
+			OutCodePoint = InvalidCodePoint;
+			return i;
+		}
+		OutCodePoint = (OutCodePoint << 6) | (Src[i] & 0x3F);
+	}
+
+	return Length;
+}
+
+/**
+	Decode one code point from wide string.
+	Unpaired surrogates and values above U+10FFFF give ReplacementChar.
+
+	@return count of consumed chars.
+*/
+FORCEINLINE uint32 DecodeWide(const WIDECHAR* Src, uint32 SrcLen, uint32& OutCodePoint) noexcept
+{
+	const uint32 Unit = static_cast<uint32>(Src[0]);
+
+	if( Unit < 0xD800 || (Unit > 0xDFFF && Unit <= 0x10FFFF) )
+	{
+		OutCodePoint = Unit;
+		return 1;
+	}
+
+	if constexpr( bWideIsUtf16 )
+	{
+		if( Unit <= 0xDBFF && SrcLen > 1 )
+		{
+			const uint32 Low = static_cast<uint32>(Src[1]);
+			if( Low >= 0xDC00 && Low <= 0xDFFF )
+			{
+				OutCodePoint = 0x10000 + ((Unit - 0xD800) << 10) + (Low - 0xDC00);
+				return 2;
+			}
+		}
+	}
+
+	OutCodePoint = FStringConversion::ReplacementChar;
+	return 1;
+}
+
+FORCEINLINE uint32 GetUtf8Length(uint32 CodePoint) noexcept
+{
+	if( CodePoint < 0x80 ) return 1;
+	if( CodePoint < 0x800 ) return 2;
+	if( CodePoint < 0x10000 ) return 3;
+	return 4;
+}
+
+FORCEINLINE void EncodeUtf8(uint32 CodePoint, uint32 NumBytes, ANSICHAR* Dest) noexcept
+{
+	switch( NumBytes )
+	{
+	case 1:
+		Dest[0] = static_cast<ANSICHAR>(CodePoint);
+		break;
+	case 2:
+		Dest[0] = static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6));
+		Dest[1] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+		break;
+	case 3:
+		Dest[0] = static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12));
+		Dest[1] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+		Dest[2] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+		break;
+	default:
+		Dest[0] = static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18));
+		Dest[1] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F));
+		Dest[2] = static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+		Dest[3] = static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F));
+		break;
+	}
+}
+
+FORCEINLINE uint32 GetWideLength(uint32 CodePoint) noexcept
+{
+	return bWideIsUtf16 && CodePoint >= 0x10000 ? 2 : 1;
+}
+
+/**
+	Shared loop of length scan and conversion, so both always agree.
+*/
+template<bool bWrite>
+static uint32 Utf8ToWideImpl(const ANSICHAR* Src, uint32 SrcLen, WIDECHAR* Dest) noexcept
+{
+	const uint8* const Bytes = reinterpret_cast<const uint8*>(Src);
+	uint32 SrcIndex = 0;
+	uint32 DestLen = 0;
+
+	while( SrcIndex < SrcLen )
+	{
+		if( SrcIndex + BlockBytes <= SrcLen )
+		{
+			const uint32 Mask = NonAsciiMask(Src + SrcIndex);
+			if( Mask == 0 )
+			{
+				if constexpr( bWrite )
+				{
+					WidenBlock(Src + SrcIndex, Dest + DestLen);
+				}
+				SrcIndex += BlockBytes;
+				DestLen += BlockBytes;
+				continue;
+			}
+
+			// Copy ASCII prefix of the block
+			const uint32 NumAscii = FMath::CountTrailingZeros(Mask);
+			if constexpr( bWrite )
+			{
+				for( uint32 i = 0; i < NumAscii; ++i )
+				{
+					Dest[DestLen + i] = static_cast<WIDECHAR>(Bytes[SrcIndex + i]);
+				}
+			}
+			SrcIndex += NumAscii;
+			DestLen += NumAscii;
+		}
+		else if( Bytes[SrcIndex] < 0x80 )
+		{
+			if constexpr( bWrite )
+			{
+				Dest[DestLen] = static_cast<WIDECHAR>(Bytes[SrcIndex]);
+			}
+			++SrcIndex;
+			++DestLen;
+			continue;
+		}
+
+		uint32 CodePoint;
+		SrcIndex += DecodeUtf8(Bytes + SrcIndex, SrcLen - SrcIndex, CodePoint);
+		if( CodePoint == InvalidCodePoint )
+		{
+			CodePoint = FStringConversion::ReplacementChar;
+		}
+
+		const uint32 NumUnits = GetWideLength(CodePoint);
+		if constexpr( bWrite )
+		{
+			if( NumUnits == 2 )
+			{
+				const uint32 Offset = CodePoint - 0x10000;
+				Dest[DestLen] = static_cast<WIDECHAR>(0xD800 + (Offset >> 10));
+				Dest[DestLen + 1] = static_cast<WIDECHAR>(0xDC00 + (Offset & 0x3FF));
+			}
+			else
+			{
+				Dest[DestLen] = static_cast<WIDECHAR>(CodePoint);
+			}
+		}
+		DestLen += NumUnits;
+	}
+
+	return DestLen;
+}
+
+template<bool bWrite>
+static uint32 WideToUtf8Impl(const WIDECHAR* Src, uint32 SrcLen, ANSICHAR* Dest) noexcept
+{
+	uint32 SrcIndex = 0;
+	uint32 DestLen = 0;
+
+	while( SrcIndex < SrcLen )
+	{
+		// Block with non-ASCII chars is encoded one by one up to its end
+		uint32 ScalarEnd = SrcIndex + 1;
+		if( SrcIndex + BlockBytes <= SrcLen )
+		{
+			if( IsBlockBelow(Src + SrcIndex, 0x80) )
+			{
+				if constexpr( bWrite )
+				{
+					NarrowBlock(Src + SrcIndex, Dest + DestLen);
+				}
+				SrcIndex += BlockBytes;
+				DestLen += BlockBytes;
+				continue;
+			}
+			ScalarEnd = SrcIndex + BlockBytes;
+		}
+
+		while( SrcIndex < ScalarEnd )
+		{
+			uint32 CodePoint;
+			SrcIndex += DecodeWide(Src + SrcIndex, SrcLen - SrcIndex, CodePoint);
+
+			const uint32 NumBytes = GetUtf8Length(CodePoint);
+			if constexpr( bWrite )
+			{
+				EncodeUtf8(CodePoint, NumBytes, Dest + DestLen);
+			}
+			DestLen += NumBytes;
+		}
+	}
+
+	return DestLen;
+}
+} // namespace StringConversion_Private
+
+
+
+
+
+bool FStringConversion::IsAscii(const ANSICHAR* Src, uint32 SrcLen) noexcept
+{
+	using namespace StringConversion_Private;
+
+	uint32 Index = 0;
+	for( ; Index + BlockBytes <= SrcLen; Index += BlockBytes )
+	{
+		if( NonAsciiMask(Src + Index) != 0 ) return false;
+	}
+	for( ; Index < SrcLen; ++Index )
+	{
+		if( static_cast<uint8>(Src[Index]) >= 0x80 ) return false;
+	}
+	return true;
+}
+
+bool FStringConversion::IsValidUtf8(const ANSICHAR* Src, uint32 SrcLen) noexcept
+{
+	using namespace StringConversion_Private;
+
+	const uint8* const Bytes = reinterpret_cast<const uint8*>(Src);
+	uint32 Index = 0;
+	while( Index < SrcLen )
+	{
+		if( Index + BlockBytes <= SrcLen && NonAsciiMask(Src + Index) == 0 )
+		{
+			Index += BlockBytes;
+			continue;
+		}
+		if( Bytes[Index] < 0x80 )
+		{
+			++Index;
+			continue;
+		}
+
+		uint32 CodePoint;
+		Index += DecodeUtf8(Bytes + Index, SrcLen - Index, CodePoint);
+		if( CodePoint == InvalidCodePoint ) return false;
+	}
+	return true;
+}
+
+void FStringConversion::Latin1ToWide(const ANSICHAR* Src, uint32 SrcLen, WIDECHAR* Dest) noexcept
+{
+	using namespace StringConversion_Private;
+
+	uint32 Index = 0;
+	for( ; Index + BlockBytes <= SrcLen; Index += BlockBytes )
+	{
+		WidenBlock(Src + Index, Dest + Index);
+	}
+	for( ; Index < SrcLen; ++Index )
+	{
+		Dest[Index] = static_cast<WIDECHAR>(static_cast<uint8>(Src[Index]));
+	}
+}
+
+void FStringConversion::WideToLatin1(const WIDECHAR* Src, uint32 SrcLen, ANSICHAR* Dest) noexcept
+{
+	using namespace StringConversion_Private;
+
+	uint32 Index = 0;
+	while( Index < SrcLen )
+	{
+		if( Index + BlockBytes <= SrcLen && IsBlockBelow(Src + Index, 0x100) )
+		{
+			NarrowBlock(Src + Index, Dest + Index);
+			Index += BlockBytes;
+			continue;
+		}
+
+		// Block has chars out of Latin-1, convert up to its end one by one
+		const uint32 End = FMath::Min(Index + BlockBytes, SrcLen);
+		for( ; Index < End; ++Index )
+		{
+			const uint32 Char = static_cast<uint32>(Src[Index]);
+			Dest[Index] = static_cast<ANSICHAR>(Char <= 0xFF ? Char : '?');
+		}
+	}
+}
+
+uint32 FStringConversion::GetUtf8ToWideLength(const ANSICHAR* Src, uint32 SrcLen) noexcept
+{
+	return StringConversion_Private::Utf8ToWideImpl<false>(Src, SrcLen, nullptr);
+}
+
+uint32 FStringConversion::Utf8ToWide(const ANSICHAR* Src, uint32 SrcLen, WIDECHAR* Dest) noexcept
+{
+	return StringConversion_Private::Utf8ToWideImpl<true>(Src, SrcLen, Dest);
+}
+
+uint32 FStringConversion::GetWideToUtf8Length(const WIDECHAR* Src, uint32 SrcLen) noexcept
+{
+	return StringConversion_Private::WideToUtf8Impl<false>(Src, SrcLen, nullptr);
+}
+
+uint32 FStringConversion::WideToUtf8(const WIDECHAR* Src, uint32 SrcLen, ANSICHAR* Dest) noexcept
+{
+	return StringConversion_Private::WideToUtf8Impl<true>(Src, SrcLen, Dest);
+}
@@ -7,6 +7,9 @@
 #include "AssertionMacros.h"
 #include "InitializerList.h"
 #include "MoveSemantic.h"
+#include "ContainerAllocationPolicies.h"
+#include "ArraySearch.h"
+#include "ArraySort.h"
 
 #include <algorithm>
 
@@ -16,29 +19,47 @@
 /**
 	Engine version of std::vector.
 	It can be faster because it does not use exceptions and can be optimized for specific operations.
+
+	@param Allocator - storage policy, e.g TInlineAllocator<8>, TFixedAllocator<8>, FArenaAllocator, FFrameArrayAllocator.
+	@see ContainerAllocationPolicies.h
 */
-template<typename T>
+template<typename T, typename Allocator = FDefaultAllocator>
 struct ENGINE_API TArray
 {
 public:
 
-	TArray() = default;
-	FORCEINLINE explicit TArray(uint32 InitSize) : Size(InitSize), Capacity(InitSize) { Data = static_cast<T*>(FMemory::Malloc(sizeof(T) * InitSize)); }
-	FORCEINLINE TArray(const TArray& Other) : Size(Other.Size), Capacity(Other.Size)
+	using ElementAllocatorType = typename Allocator::template ForElementType<T>;
+
+public:
+
+	FORCEINLINE TArray() noexcept : Capacity(AllocatorInstance.GetInitialCapacity()) { }
+	FORCEINLINE explicit TArray(uint32 InitSize) : Capacity(AllocatorInstance.GetInitialCapacity())
 	{
-		Data = static_cast<T*>(FMemory::Malloc(sizeof(T) * Size));
-		CopyAssignItems(Data, Other.Data, Other.Size);
+		ResizeAllocation(AllocatorInstance.CalculateSlackReserve(InitSize));
+		Size = InitSize;
 	}
-	FORCEINLINE TArray(TArray&& Other) noexcept : Data(Other.Data), Size(Other.Size), Capacity(Other.Size)
+	/**
+		Construct empty array with configured allocator, e.g TArray<int32, FArenaAllocator> Array(Arena);
+	*/
+	FORCEINLINE explicit TArray(const ElementAllocatorType& InAllocatorInstance) noexcept : AllocatorInstance(InAllocatorInstance), Capacity(AllocatorInstance.GetInitialCapacity()) { }
+	FORCEINLINE TArray(const TArray& Other) : AllocatorInstance(Other.AllocatorInstance), Capacity(AllocatorInstance.GetInitialCapacity())
 	{
-		Other.Data = nullptr;
+		ResizeAllocation(AllocatorInstance.CalculateSlackReserve(Other.Size));
+		ConstructItems<T>(GetData(), Other.GetData(), Other.Size);
+		Size = Other.Size;
+	}
+	FORCEINLINE TArray(TArray&& Other) noexcept : Size(Other.Size), Capacity(Other.Capacity)
+	{
+		AllocatorInstance.MoveToEmpty(Other.AllocatorInstance, Other.Size);
+
 		Other.Size = 0;
-		Other.Capacity = 0;
+		Other.Capacity = Other.AllocatorInstance.GetInitialCapacity();
 	}
-	FORCEINLINE TArray(TInitializerList<T> InitList) : Size(InitList.Size()), Capacity(InitList.Size())
+	FORCEINLINE TArray(TInitializerList<T> InitList) : Capacity(AllocatorInstance.GetInitialCapacity())
 	{
-		Data = static_cast<T*>(FMemory::Malloc(sizeof(T) * Size));
-		CopyAssignItems(Data, InitList.begin(), Size);
+		ResizeAllocation(AllocatorInstance.CalculateSlackReserve(static_cast<uint32>(InitList.Size())));
+		ConstructItems<T>(GetData(), InitList.begin(), InitList.Size());
+		Size = static_cast<uint32>(InitList.Size());
 	}
 	~TArray() { Reset(); }
 
@@ -49,34 +70,36 @@ public:
 	{
 		if( &Other == this ) return *this;
 
-		DestructItems(Data, this->Size);
+		Clear();
 
 		Reserve(Other.Size);
-		CopyAssignItems(Data, Other.Data, Other.Size);
+		ConstructItems<T>(GetData(), Other.GetData(), Other.Size);
+		Size = Other.Size;
 
 		return *this;
 	}
 	FORCEINLINE TArray& operator=(TArray&& Other) noexcept
 	{
-		DestructItems(Data, this->Size);
-		FMemory::Free(Data);
+		if( &Other == this ) return *this;
+
+		Reset();
+		AllocatorInstance.MoveToEmpty(Other.AllocatorInstance, Other.Size);
 
-		this->Data = Other.Data;
 		this->Size = Other.Size;
 		this->Capacity = Other.Capacity;
 
-		Other.Data = nullptr;
 		Other.Size = 0;
-		Other.Capacity = 0;
+		Other.Capacity = Other.AllocatorInstance.GetInitialCapacity();
 
 		return *this;
 	}
 	FORCEINLINE TArray& operator=(TInitializerList<T> InitList)
 	{
-		DestructItems(Data, this->Size);
+		Clear();
 
-		Reserve(InitList.Size());
-		CopyAssignItems(Data, InitList.begin(), Other.Size);
+		Reserve(static_cast<uint32>(InitList.Size()));
+		ConstructItems<T>(GetData(), InitList.begin(), InitList.Size());
+		Size = static_cast<uint32>(InitList.Size());
 
 		return *this;
 	}
@@ -88,30 +111,22 @@ public:
 
 public:
 
-	FORCEINLINE T* begin() noexcept { return Data; }
-	FORCEINLINE const T* begin() const noexcept { return Data; }
-	FORCEINLINE T* end() noexcept { return Data + Size; }
-	FORCEINLINE const T* end() const noexcept { return Data + Size; }
+	FORCEINLINE T* begin() noexcept { return GetData(); }
+	FORCEINLINE const T* begin() const noexcept { return GetData(); }
+	FORCEINLINE T* end() noexcept { return GetData() + Size; }
+	FORCEINLINE const T* end() const noexcept { return GetData() + Size; }
 
 public:
 
 	/**
 		Allocate memory for give count of elements.
+		Capacity is exactly NewSize for heap policies, so reserve known final size before adding elements.
 	*/
 	FORCEINLINE void Reserve(uint32 NewSize)
 	{
 		if( NewSize > Capacity )
 		{
-			Capacity = NewSize * 2; // do not reduce the growth factor
-
-			if( Data != nullptr )
-			{
-				Data = static_cast<T*>(FMemory::Realloc(Data, sizeof(T) * Capacity));
-			}
-			else
-			{
-				Data = static_cast<T*>(FMemory::Malloc(sizeof(T) * Capacity));
-			}
+			ResizeAllocation(AllocatorInstance.CalculateSlackReserve(NewSize));
 		}
 	}
 	/**
@@ -125,8 +140,11 @@ public:
 		}
 		else
 		{
-			Data = static_cast<T*>(FMemory::Realloc(Data, sizeof(T) * Size));
-			Capacity = Size;
+			const uint32 NewCapacity = AllocatorInstance.CalculateSlackReserve(Size);
+			if( NewCapacity != Capacity )
+			{
+				ResizeAllocation(NewCapacity);
+			}
 		}
 	}
 	/**
@@ -134,7 +152,7 @@ public:
 	*/
 	FORCEINLINE void Clear()
 	{
-		DestructItems(Data, Size);
+		DestructItems(GetData(), Size);
 		Size = 0;
 	}
 	/**
@@ -143,12 +161,8 @@ public:
 	FORCEINLINE void Reset()
 	{
 		Clear();
-		if( Data )
-		{
-			FMemory::Free(Data);
-		}
-		Capacity = 0;
-		Data = nullptr;
+		AllocatorInstance.ResizeAllocation(0, 0);
+		Capacity = AllocatorInstance.GetInitialCapacity();
 	}
 
 public:
@@ -159,7 +173,7 @@ public:
 	FORCEINLINE T& At(uint32 Index)
 	{
 		check(Index < Size);
-		return Data[Index];
+		return GetData()[Index];
 	}
 	/**
 		Access element at index.
@@ -167,7 +181,7 @@ public:
 	FORCEINLINE const T& At(uint32 Index) const
 	{
 		check(Index < Size);
-		return Data[Index];
+		return GetData()[Index];
 	}
 	/**
 		@return First element.
@@ -182,8 +196,8 @@ public:
 	/**
 		@return Array in C-style.
 	*/
-	FORCEINLINE T* GetData() noexcept { return Data; }
-	FORCEINLINE const T* GetData() const noexcept { return Data; }
+	FORCEINLINE T* GetData() noexcept { return AllocatorInstance.GetAllocation(); }
+	FORCEINLINE const T* GetData() const noexcept { return AllocatorInstance.GetAllocation(); }
 	/**
 		@return Count of elements in the array.
 	*/
@@ -204,34 +218,107 @@ public:
 public:
 
 	/**
-		Add Elem to the end of array.
+		Construct new element at the end of array in-place.
+
+		@param Args - arguments forwarded to the constructor of the new element.
+		@return index of the new element.
 	*/
-	FORCEINLINE void PushBack(T Elem)
+	template<typename... ArgsType>
+	FORCEINLINE uint32 Emplace(ArgsType&&... Args)
 	{
-		++Size;
-		Reserve(Size);
+		const uint32 Index = AddUninitialized();
+		new(GetData() + Index) T(Forward<ArgsType>(Args)...);
+		return Index;
+	}
+	/**
+		Construct new element at Index in-place and shift right other elements.
 
-		Back() = MoveTemp(Elem);
+		@param Index - position of the new element, can be equal to array size.
+		@param Args - arguments forwarded to the constructor of the new element.
+	*/
+	template<typename... ArgsType>
+	FORCEINLINE void EmplaceAt(uint32 Index, ArgsType&&... Args)
+	{
+		InsertUninitialized(Index);
+		new(GetData() + Index) T(Forward<ArgsType>(Args)...);
 	}
+
 	/**
-		Add Elem to the begin of array.
+		Add Count elements to the end of array without construction.
+		Caller must construct them before use.
+
+		@return index of the first new element.
 	*/
-	FORCEINLINE void PushFront(T Elem)
+	FORCEINLINE uint32 AddUninitialized(uint32 Count = 1)
 	{
-		++Size;
-		Reserve(Size);
+		const uint32 OldSize = Size;
+		Grow(Size + Count);
+		Size += Count;
+		return OldSize;
+	}
+	/**
+		Add Count zero filled elements to the end of array.
 
-		FMemory::MemMove(Data + 1, Data, sizeof(T) * (Size - 1));
-		begin() = MoveTemp(Elem);
+		@return index of the first new element.
+	*/
+	FORCEINLINE uint32 AddZeroed(uint32 Count = 1)
+	{
+		const uint32 Index = AddUninitialized(Count);
+		FMemory::MemZero(GetData() + Index, sizeof(T) * Count);
+		return Index;
+	}
+	/**
+		Add Count default constructed elements to the end of array.
+
+		@return index of the first new element.
+	*/
+	FORCEINLINE uint32 AddDefaulted(uint32 Count = 1)
+	{
+		const uint32 Index = AddUninitialized(Count);
+		DefaultConstructItems<T>(GetData() + Index, Count);
+		return Index;
+	}
+
+	/**
+		Add Elem to the end of array.
+	*/
+	FORCEINLINE void PushBack(const T& Elem)
+	{
+		CheckAddress(&Elem);
+		Emplace(Elem);
+	}
+	FORCEINLINE void PushBack(T&& Elem)
+	{
+		CheckAddress(&Elem);
+		Emplace(MoveTemp(Elem));
+	}
+	/**
+		Add Elem to the begin of array.
+	*/
+	FORCEINLINE void PushFront(const T& Elem)
+	{
+		CheckAddress(&Elem);
+		EmplaceAt(0, Elem);
+	}
+	FORCEINLINE void PushFront(T&& Elem)
+	{
+		CheckAddress(&Elem);
+		EmplaceAt(0, MoveTemp(Elem));
 	}
 	/**
 		Add Elem to the end of array.
 	*/
-	FORCEINLINE void Add(T Elem) { PushBack(MoveTemp(Elem)); }
+	FORCEINLINE void Add(const T& Elem) { PushBack(Elem); }
+	FORCEINLINE void Add(T&& Elem) { PushBack(MoveTemp(Elem)); }
 	/**
 		Add Elem to the end of the array, unless it is already in the array.
 	*/
-	FORCEINLINE void AddUnique(T Elem)
+	FORCEINLINE void AddUnique(const T& Elem)
+	{
+		if( Contains(Elem) ) return;
+		Add(Elem);
+	}
+	FORCEINLINE void AddUnique(T&& Elem)
 	{
 		if( Contains(Elem) ) return;
 		Add(MoveTemp(Elem));
@@ -239,12 +326,23 @@ public:
 	/**
 		Append other array to current.
 	*/
-	FORCEINLINE void Append(const TArray<T>& Other) 
+	FORCEINLINE void Append(const TArray& Other)
 	{
 		check(&Other != this);
+		Append(Other.GetData(), Other.Num());
+	}
+	/**
+		Append Count elements copied from Ptr.
+		Memory is reserved once for all of them.
+	*/
+	FORCEINLINE void Append(const T* Ptr, uint32 Count)
+	{
+		if( Count == 0 ) return;
+		check(Ptr != nullptr);
+		CheckAddress(Ptr);
 
-		Reserve(GetSize() + Other.GetSize());
-		CopyAssignItems(end(), Other.begin(), Other.GetSize());
+		const uint32 Index = AddUninitialized(Count);
+		ConstructItems<T>(GetData() + Index, Ptr, Count);
 	}
 
 	/**
@@ -265,34 +363,36 @@ public:
 		--Size;
 		DestructItem(begin());
 
-		FMemory::MemCpy(Data, Data + 1, sizeof(T) * Size);
+		RelocateConstructItems<T>(GetData(), GetData() + 1, Size);
 	}
 
 	/**
 		Add Elem at position index and shift rigth other elements.
 	*/
-	FORCEINLINE void Insert(uint32 Index, T Elem)
+	FORCEINLINE void Insert(uint32 Index, const T& Elem)
 	{
-		check(Index < Size);
-		++Size;
-		Reserve(Size);
-
-		FMemory::MemMove(Data + Index + 1, Data + Index, sizeof(T) * (Size - Index - 1));
-		At(Index) = MoveTemp(Elem);
+		CheckAddress(&Elem);
+		EmplaceAt(Index, Elem);
+	}
+	FORCEINLINE void Insert(uint32 Index, T&& Elem)
+	{
+		CheckAddress(&Elem);
+		EmplaceAt(Index, MoveTemp(Elem));
 	}
 
 	/**
 		Add Elem after stored elem at Index.
 		New elem will be at position = Index + 1
 	*/
-	FORCEINLINE void AddAfter(uint32 Index, T Elem)
+	FORCEINLINE void AddAfter(uint32 Index, const T& Elem)
 	{
 		check(Index < Size);
-		++Size;
-		Reserve(Size);
-
-		FMemory::MemMove(Data + Index + 2, Data + Index + 1, sizeof(T) * (Size - Index - 2));
-		At(Index + 1) = MoveTemp(Elem);
+		Insert(Index + 1, Elem);
+	}
+	FORCEINLINE void AddAfter(uint32 Index, T&& Elem)
+	{
+		check(Index < Size);
+		Insert(Index + 1, MoveTemp(Elem));
 	}
 
 	/**
@@ -304,9 +404,9 @@ public:
 	{
 		check(Index < Size);
 		--Size;
-		DestructItem(Data + Index);
+		DestructItem(GetData() + Index);
 
-		FMemory::MemCpy(Data + Index, Data + Index + 1, sizeof(T) * (Size - Index));
+		RelocateConstructItems<T>(GetData() + Index, GetData() + Index + 1, Size - Index);
 	}
 	/**
 		Remove element at Index.
@@ -321,9 +421,9 @@ public:
 		if( Count == 0 ) return;
 
 		Size -= Count;
-		DestructItems(Data + Index, Count);
+		DestructItems(GetData() + Index, Count);
 
-		FMemory::MemCpy(Data + Index, Data + Index + Count, sizeof(T) * (Size - Index));
+		RelocateConstructItems<T>(GetData() + Index, GetData() + Index + Count, Size - Index);
 	}
 	/**
 		Remove element at index and swapping it with last element.
@@ -334,66 +434,127 @@ public:
 	{
 		check(Index < Size);
 		--Size;
-		DestructItem(Data + Index);
+		DestructItem(GetData() + Index);
+
+		if( Index == Size ) return;
+		RelocateConstructItems<T>(GetData() + Index, GetData() + Size, 1);
+	}
+	/**
+		Remove elements at sorted unique Indices in one pass.
+		Order of other elements is kept.
+
+		@param Indices - ascending indices of elements to remove.
+	*/
+	template<typename OtherAllocator>
+	void RemoveAtIndices(const TArray<uint32, OtherAllocator>& Indices)
+	{
+		const uint32 Count = Indices.Num();
+		if( Count == 0 ) return;
 
-		if( Size == 0 ) return;
-		FMemory::MemCpy(Data + Index, Data + Size, sizeof(T));
+		T* Data = GetData();
+		uint32 Write = Indices[0];
+		for( uint32 i = 0; i < Count; ++i )
+		{
+			const uint32 Index = Indices[i];
+			checkf(Index < Size, TEXT("Index out of range"));
+			checkf(i == 0 || Index > Indices[i - 1], TEXT("Indices must be sorted and unique"));
+			DestructItem(Data + Index);
+
+			const uint32 RunStart = Index + 1;
+			const uint32 RunEnd = i + 1 < Count ? Indices[i + 1] : Size;
+			if( RunEnd > RunStart )
+			{
+				RelocateConstructItems<T>(Data + Write, Data + RunStart, RunEnd - RunStart);
+				Write += RunEnd - RunStart;
+			}
+		}
+		Size = Write;
 	}
 	/**
-		Remove all elements where Lambda returns true
+		Remove all elements where Lambda returns true.
+		Order of other elements is kept, kept runs are shifted once.
 		e.g [&](const T& Elem){ return Elem == 0; }
 	*/
 	template<typename Predicate>
-	FORCEINLINE void RemoveAll(Predicate NeedToRemove)
+	void RemoveAll(Predicate NeedToRemove)
 	{
-		const T* p = end() - 1;
-		while( p >= begin() )
+		T* Data = GetData();
+		uint32 Write = 0;
+		uint32 Read = 0;
+		while( Read < Size )
 		{
-			if( NeedToRemove(*p) )
+			const uint32 RunStart = Read;
+			while( Read < Size && !NeedToRemove(Data[Read]) )
+			{
+				++Read;
+			}
+
+			const uint32 RunLength = Read - RunStart;
+			if( RunLength > 0 && Write != RunStart )
+			{
+				RelocateConstructItems<T>(Data + Write, Data + RunStart, RunLength);
+			}
+			Write += RunLength;
+
+			if( Read < Size )
 			{
-				RemoveAt(p - begin());
+				DestructItem(Data + Read);
+				++Read;
 			}
-			--p;
 		}
+		Size = Write;
 	}
 	/**
 		Remove all elements where Lambda returns true using swapping.
+		Removed elements are filled from the tail, so order is not kept.
 		e.g [&](const T& Elem){ return Elem == 0; }
 	*/
 	template<typename Predicate>
-	FORCEINLINE void RemoveAllSwap(Predicate NeedToRemove)
+	void RemoveAllSwap(Predicate NeedToRemove)
 	{
-		const T* p = end() - 1;
-		while( p >= begin() )
+		T* Data = GetData();
+		uint32 Index = 0;
+		while( Index < Size )
 		{
-			if( NeedToRemove(*p) )
+			if( !NeedToRemove(Data[Index]) )
 			{
-				RemoveAtSwap(p - begin());
+				++Index;
+				continue;
+			}
+			DestructItem(Data + Index);
+
+			while( Size - 1 > Index && NeedToRemove(Data[Size - 1]) )
+			{
+				--Size;
+				DestructItem(Data + Size);
+			}
+
+			--Size;
+			if( Index != Size )
+			{
+				RelocateConstructItems<T>(Data + Index, Data + Size, 1);
+				++Index;
 			}
-			--p;
 		}
 	}
 
 	/**
 		Try to find Elem in array by operator==
 	*/
-	FORCEINLINE bool Contains(const T& Elem) const noexcept { return Find(Elem) != -1; }
+	FORCEINLINE bool Contains(const T& Elem) const noexcept { return Find(Elem) != INDEX_NONE; }
 	/**
-		@return index of first found Elem by operator==. If not found return -1
+		@return index of first found Elem by operator==. If not found return INDEX_NONE.
+		@note Arithmetic, enum and pointer elements are compared with SIMD.
 	*/
-	FORCEINLINE uint32 Find(const T& Elem) const noexcept
-	{
-		const T* p = begin();
-		while( p != end() )
-		{
-			if( *p == Elem )
-			{
-				return static_cast<uint32>(p - begin());
-			}
-			++p;
-		}
-		return -1;
-	}
+	FORCEINLINE uint32 Find(const T& Elem) const noexcept { return ArraySearch_Private::TArraySearch<T>::Find(GetData(), Size, Elem); }
+	/**
+		@return index of last found Elem by operator==. If not found return INDEX_NONE.
+	*/
+	FORCEINLINE uint32 FindLast(const T& Elem) const noexcept { return ArraySearch_Private::TArraySearch<T>::FindLast(GetData(), Size, Elem); }
+	/**
+		@return count of elements equal to Elem by operator==.
+	*/
+	FORCEINLINE uint32 Count(const T& Elem) const noexcept { return ArraySearch_Private::TArraySearch<T>::Count(GetData(), Size, Elem); }
 
 	/**
 		Sort array by Predicate.
@@ -404,15 +565,102 @@ public:
 	{
 		std::sort(begin(), end(), Compare);
 	}
+	/**
+		Sort array by Predicate keeping order of equal elements.
+		e.g [&](const T& A, const T& B){ return A < B; }
+	*/
+	template<typename Predicate>
+	FORCEINLINE void StableSort(Predicate Compare)
+	{
+		std::stable_sort(begin(), end(), Compare);
+	}
+	/**
+		Sort array by Predicate using several threads. Order of equal elements is not kept.
+		Small arrays are sorted on the calling thread.
+		Predicate is called concurrently and must not modify shared state.
+		e.g [](const T& A, const T& B){ return A < B; }
+	*/
+	template<typename Predicate>
+	FORCEINLINE void ParallelSort(Predicate Compare)
+	{
+		ArraySort_Private::ParallelSort(GetData(), Size, Compare);
+	}
+	/**
+		Stable LSD radix sort by integer or float key in linear time.
+		Elements are relocated once after keys are sorted.
+		e.g [](const T& Elem){ return Elem.Id; }
+
+		@param KeyOf - lambda that returns arithmetic key of element.
+	*/
+	template<typename KeyLambda>
+	void RadixSort(KeyLambda KeyOf)
+	{
+		if( Size <= 1 ) return;
+
+		uint32* Order = static_cast<uint32*>(FMemory::Malloc(sizeof(uint32) * Size));
+		ArraySort_Private::RadixSortOrder(GetData(), Size, KeyOf, Order);
+
+		TArray Sorted(AllocatorInstance);
+		Sorted.AddUninitialized(Size);
+		for( uint32 i = 0; i < Size; ++i )
+		{
+			RelocateConstructItems<T>(Sorted.GetData() + i, GetData() + Order[i], 1);
+		}
+		FMemory::Free(Order);
+
+		Size = 0;
+		*this = MoveTemp(Sorted);
+	}
+
+
+
+private:
+
+	/**
+		Elements passed by reference must not live in this array, growth could free them before they are copied.
+	*/
+	FORCEINLINE void CheckAddress(const T* Address) const noexcept
+	{
+		checkf(Address < GetData() || Address >= GetData() + Capacity, TEXT("Element is in the array, pass a copy"));
+	}
+
+	/**
+		Shift elements from Index right by one and leave the hole unconstructed.
+	*/
+	FORCEINLINE void InsertUninitialized(uint32 Index)
+	{
+		check(Index <= Size);
+		Grow(Size + 1);
+
+		RelocateConstructItems<T>(GetData() + Index + 1, GetData() + Index, Size - Index);
+		++Size;
+	}
+
+	/**
+		Ensure capacity for NewSize elements with slack for next additions.
+	*/
+	FORCEINLINE void Grow(uint32 NewSize)
+	{
+		if( NewSize > Capacity )
+		{
+			ResizeAllocation(AllocatorInstance.CalculateSlackGrow(NewSize));
+		}
+	}
+
+	FORCEINLINE void ResizeAllocation(uint32 NewCapacity)
+	{
+		AllocatorInstance.ResizeAllocation(Size, NewCapacity);
+		Capacity = NewCapacity;
+	}
 
 
 
 private:
 
 	/**
-		Data array.
+		Storage of elements.
 	*/
-	T* Data = nullptr;
+	ElementAllocatorType AllocatorInstance;
 	/**
 		Count of elements in the array.
 	*/
@@ -421,4 +669,16 @@ private:
 		Allocated memory for elements count.
 	*/
 	uint32 Capacity = 0;
-};
\ No newline at end of file
+};
+
+/**
+	Array with external storage can be moved with memcpy, inline storage requires relocatable elements.
+*/
+template<typename T, typename Allocator>
+struct TIsTriviallyRelocatable<TArray<T, Allocator>>
+{
+	enum
+	{
+		Value = !TAllocatorTraits<Allocator>::HasInlineStorage || TIsTriviallyRelocatable<T>::Value
+	};
+};
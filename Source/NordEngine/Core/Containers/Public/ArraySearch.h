@@ -0,0 +1,309 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "EngineMath.h"
+#include "CommonMacros.h"
+#include "TypeTraits/AreTypesEqual.h"
+#include "TypeTraits/RemoveCV.h"
+#include "TypeTraits/IsArithmetic.h"
+#include "TypeTraits/IsEnum.h"
+#include "TypeTraits/TypeSpecifier.h"
+
+// We require SSE2
+#include <emmintrin.h>
+#if PLATFORM_ALWAYS_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+
+
+
+namespace ArraySearch_Private
+{
+/**
+	Reinterpret bytes of Value as integer of the same or bigger size, unused bytes are zero.
+*/
+template<typename IntType, typename T>
+FORCEINLINE IntType BitCast(const T& Value) noexcept
+{
+	IntType Result = 0;
+	FMemory::MemCpy(&Result, &Value, sizeof(T) < sizeof(IntType) ? sizeof(T) : sizeof(IntType));
+	return Result;
+}
+
+/**
+	Comparison of elements as SIMD lanes.
+	Each lanes type provides:
+		VectorType,
+		Width - count of elements in one vector,
+		BitsPerElement - count of mask bits set by one matched element,
+		Splat(Value), Load(Address) and Match(A, B) that returns movemask of equal lanes.
+*/
+#if PLATFORM_ALWAYS_HAS_AVX2
+template<SIZE_T ElementSize>
+struct TIntegerLanes
+{
+	using VectorType = __m256i;
+
+	static constexpr uint32 Width = 32 / ElementSize;
+	static constexpr uint32 BitsPerElement = ElementSize;
+
+	template<typename T>
+	static FORCEINLINE VectorType Splat(const T& Value) noexcept
+	{
+		switch( ElementSize )
+		{
+		case 1: return _mm256_set1_epi8(BitCast<int8>(Value));
+		case 2: return _mm256_set1_epi16(BitCast<int16>(Value));
+		case 4: return _mm256_set1_epi32(BitCast<int32>(Value));
+		default: return _mm256_set1_epi64x(BitCast<int64>(Value));
+		}
+	}
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm256_loadu_si256(static_cast<const VectorType*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept
+	{
+		switch( ElementSize )
+		{
+		case 1: return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(A, B)));
+		case 2: return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(A, B)));
+		case 4: return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(A, B)));
+		default: return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(A, B)));
+		}
+	}
+};
+
+struct FFloatLanes
+{
+	using VectorType = __m256;
+
+	static constexpr uint32 Width = 8;
+	static constexpr uint32 BitsPerElement = 1;
+
+	static FORCEINLINE VectorType Splat(float Value) noexcept { return _mm256_set1_ps(Value); }
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm256_loadu_ps(static_cast<const float*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept { return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_EQ_OQ))); }
+};
+
+struct FDoubleLanes
+{
+	using VectorType = __m256d;
+
+	static constexpr uint32 Width = 4;
+	static constexpr uint32 BitsPerElement = 1;
+
+	static FORCEINLINE VectorType Splat(double Value) noexcept { return _mm256_set1_pd(Value); }
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm256_loadu_pd(static_cast<const double*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept { return static_cast<uint32>(_mm256_movemask_pd(_mm256_cmp_pd(A, B, _CMP_EQ_OQ))); }
+};
+#else
+template<SIZE_T ElementSize>
+struct TIntegerLanes
+{
+	using VectorType = __m128i;
+
+	static constexpr uint32 Width = 16 / ElementSize;
+	static constexpr uint32 BitsPerElement = ElementSize;
+
+	template<typename T>
+	static FORCEINLINE VectorType Splat(const T& Value) noexcept
+	{
+		switch( ElementSize )
+		{
+		case 1: return _mm_set1_epi8(BitCast<int8>(Value));
+		case 2: return _mm_set1_epi16(BitCast<int16>(Value));
+		case 4: return _mm_set1_epi32(BitCast<int32>(Value));
+		default: return _mm_set1_epi64x(BitCast<int64>(Value));
+		}
+	}
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm_loadu_si128(static_cast<const VectorType*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept
+	{
+		switch( ElementSize )
+		{
+		case 1: return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(A, B)));
+		case 2: return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi16(A, B)));
+		case 4: return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi32(A, B)));
+		default:
+		{
+			// SSE2 has no 64-bit compare, both 32-bit halves must match.
+			const __m128i Equal32 = _mm_cmpeq_epi32(A, B);
+			const __m128i Swapped = _mm_shuffle_epi32(Equal32, _MM_SHUFFLE(2, 3, 0, 1));
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_and_si128(Equal32, Swapped)));
+		}
+		}
+	}
+};
+
+struct FFloatLanes
+{
+	using VectorType = __m128;
+
+	static constexpr uint32 Width = 4;
+	static constexpr uint32 BitsPerElement = 1;
+
+	static FORCEINLINE VectorType Splat(float Value) noexcept { return _mm_set1_ps(Value); }
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm_loadu_ps(static_cast<const float*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept { return static_cast<uint32>(_mm_movemask_ps(_mm_cmpeq_ps(A, B))); }
+};
+
+struct FDoubleLanes
+{
+	using VectorType = __m128d;
+
+	static constexpr uint32 Width = 2;
+	static constexpr uint32 BitsPerElement = 1;
+
+	static FORCEINLINE VectorType Splat(double Value) noexcept { return _mm_set1_pd(Value); }
+	static FORCEINLINE VectorType Load(const void* Address) noexcept { return _mm_loadu_pd(static_cast<const double*>(Address)); }
+	static FORCEINLINE uint32 Match(VectorType A, VectorType B) noexcept { return static_cast<uint32>(_mm_movemask_pd(_mm_cmpeq_pd(A, B))); }
+};
+#endif // PLATFORM_ALWAYS_HAS_AVX2
+
+
+
+/**
+	Kind of search used for element type.
+*/
+enum class ESearchKind
+{
+	Scalar,
+	Integer,
+	Float,
+	Double
+};
+
+template<typename T>
+struct TSearchKind
+{
+	// clang-format off
+	static constexpr ESearchKind Value =
+		TAreTypesEqual<typename TRemoveCV<T>::Type, float>::Value ? ESearchKind::Float :
+		TAreTypesEqual<typename TRemoveCV<T>::Type, double>::Value ? ESearchKind::Double :
+		(TIsIntegral<T>::Value || TIsEnum<T>::Value || TIsPointer<T>::Value) && sizeof(T) <= 8 ? ESearchKind::Integer :
+		ESearchKind::Scalar;
+	// clang-format on
+};
+
+template<typename T, ESearchKind Kind = TSearchKind<T>::Value>
+struct TSearchLanes
+{
+	using Type = TIntegerLanes<sizeof(T)>;
+};
+template<typename T>
+struct TSearchLanes<T, ESearchKind::Float>
+{
+	using Type = FFloatLanes;
+};
+template<typename T>
+struct TSearchLanes<T, ESearchKind::Double>
+{
+	using Type = FDoubleLanes;
+};
+
+
+
+/**
+	Linear search by operator== for types without vector path.
+*/
+template<typename T, bool bVectorized = TSearchKind<T>::Value != ESearchKind::Scalar>
+struct TArraySearch
+{
+	static FORCEINLINE uint32 Find(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		for( uint32 i = 0; i < Num; ++i )
+		{
+			if( Data[i] == Value ) return i;
+		}
+		return INDEX_NONE;
+	}
+
+	static FORCEINLINE uint32 FindLast(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		for( uint32 i = Num; i > 0; --i )
+		{
+			if( Data[i - 1] == Value ) return i - 1;
+		}
+		return INDEX_NONE;
+	}
+
+	static FORCEINLINE uint32 Count(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		uint32 Result = 0;
+		for( uint32 i = 0; i < Num; ++i )
+		{
+			Result += Data[i] == Value;
+		}
+		return Result;
+	}
+};
+
+/**
+	Search that compares full vectors of elements at once and finishes the tail with scalar loop.
+*/
+template<typename T>
+struct TArraySearch<T, true>
+{
+	using Lanes = typename TSearchLanes<T>::Type;
+	using VectorType = typename Lanes::VectorType;
+
+	static uint32 Find(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		const VectorType Needle = Lanes::Splat(Value);
+
+		uint32 i = 0;
+		for( ; i + Lanes::Width <= Num; i += Lanes::Width )
+		{
+			const uint32 Mask = Lanes::Match(Lanes::Load(Data + i), Needle);
+			if( Mask != 0 )
+			{
+				return i + FMath::CountTrailingZeros(Mask) / Lanes::BitsPerElement;
+			}
+		}
+		for( ; i < Num; ++i )
+		{
+			if( Data[i] == Value ) return i;
+		}
+		return INDEX_NONE;
+	}
+
+	static uint32 FindLast(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		const VectorType Needle = Lanes::Splat(Value);
+
+		uint32 i = Num;
+		for( ; i % Lanes::Width != 0; --i )
+		{
+			if( Data[i - 1] == Value ) return i - 1;
+		}
+		for( ; i > 0; i -= Lanes::Width )
+		{
+			const uint32 Mask = Lanes::Match(Lanes::Load(Data + i - Lanes::Width), Needle);
+			if( Mask != 0 )
+			{
+				return i - Lanes::Width + (31 - FMath::CountLeadingZeros(Mask)) / Lanes::BitsPerElement;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	static uint32 Count(const T* Data, uint32 Num, const T& Value) noexcept
+	{
+		const VectorType Needle = Lanes::Splat(Value);
+
+		uint32 Result = 0;
+		uint32 i = 0;
+		for( ; i + Lanes::Width <= Num; i += Lanes::Width )
+		{
+			Result += FMath::CountBits(Lanes::Match(Lanes::Load(Data + i), Needle));
+		}
+		Result /= Lanes::BitsPerElement;
+		for( ; i < Num; ++i )
+		{
+			Result += Data[i] == Value;
+		}
+		return Result;
+	}
+};
+} // namespace ArraySearch_Private
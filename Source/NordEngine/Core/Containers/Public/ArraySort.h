@@ -0,0 +1,192 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "AssertionMacros.h"
+#include "TypeTraits/IsArithmetic.h"
+#include "TypeTraits/IsSigned.h"
+#include "TypeTraits/RemoveCV.h"
+#include "TypeTraits/TypeSpecifier.h"
+
+#include <algorithm>
+#include <thread>
+
+
+
+
+namespace ArraySort_Private
+{
+/**
+	Arrays smaller than this are sorted on the calling thread, starting threads costs more than it gives.
+*/
+static constexpr uint32 MinParallelSortItemsPerThread = 4096;
+/**
+	Upper limit of threads used by one parallel sort.
+*/
+static constexpr uint32 MaxParallelSortThreads = 64;
+
+/**
+	Maps arithmetic key to unsigned integer with the same order, so keys can be sorted digit by digit.
+	Signed integers get the sign bit flipped, negative floats get all bits flipped.
+*/
+template<typename KeyType>
+struct TRadixKey
+{
+	static_assert(TIsArithmetic<KeyType>::Value, "Radix sort key must be integer or float");
+
+	using UnsignedType = TUnsignedIntType_T<sizeof(KeyType)>;
+
+	static constexpr UnsignedType SignBit = static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyType) * 8 - 1));
+
+	static FORCEINLINE UnsignedType Encode(KeyType Key) noexcept
+	{
+		UnsignedType Bits;
+		FMemory::MemCpy(&Bits, &Key, sizeof(KeyType));
+
+		if( TIsFloatingPoint<KeyType>::Value )
+		{
+			return (Bits & SignBit) ? static_cast<UnsignedType>(~Bits) : static_cast<UnsignedType>(Bits | SignBit);
+		}
+		if( KeyType(-1) < KeyType(0) )
+		{
+			return static_cast<UnsignedType>(Bits ^ SignBit);
+		}
+		return Bits;
+	}
+};
+
+template<typename UnsignedType>
+struct TRadixItem
+{
+	UnsignedType Key;
+	uint32 Index;
+};
+
+/**
+	LSD radix sort of element indices by key, 8 bits per pass.
+	All digit histograms are built in one pass, digits equal for all keys are skipped.
+
+	@param Data - elements to sort.
+	@param Num - count of elements.
+	@param KeyOf - lambda that returns arithmetic key of element.
+	@param OutOrder - receives Num indices of elements in sorted order, stable for equal keys.
+*/
+template<typename T, typename KeyLambda>
+void RadixSortOrder(const T* Data, uint32 Num, KeyLambda& KeyOf, uint32* OutOrder)
+{
+	using KeyType = typename TRemoveCV<typename TRemoveReference<decltype(KeyOf(*Data))>::Type>::Type;
+	using RadixKey = TRadixKey<KeyType>;
+	using ItemType = TRadixItem<typename RadixKey::UnsignedType>;
+	static constexpr uint32 NumDigits = sizeof(KeyType);
+
+	if( Num == 0 ) return;
+
+	ItemType* Items = static_cast<ItemType*>(FMemory::Malloc(sizeof(ItemType) * Num * 2));
+	ItemType* Scratch = Items + Num;
+
+	uint32 Histograms[NumDigits][256] = {};
+	for( uint32 i = 0; i < Num; ++i )
+	{
+		Items[i].Key = RadixKey::Encode(KeyOf(Data[i]));
+		Items[i].Index = i;
+		for( uint32 Digit = 0; Digit < NumDigits; ++Digit )
+		{
+			++Histograms[Digit][(Items[i].Key >> (Digit * 8)) & 0xFF];
+		}
+	}
+
+	for( uint32 Digit = 0; Digit < NumDigits; ++Digit )
+	{
+		uint32* Histogram = Histograms[Digit];
+		if( Histogram[(Items[0].Key >> (Digit * 8)) & 0xFF] == Num ) continue;
+
+		uint32 Offset = 0;
+		for( uint32 Bucket = 0; Bucket < 256; ++Bucket )
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for( uint32 i = 0; i < Num; ++i )
+		{
+			Scratch[Histogram[(Items[i].Key >> (Digit * 8)) & 0xFF]++] = Items[i];
+		}
+
+		ItemType* Temp = Items;
+		Items = Scratch;
+		Scratch = Temp;
+	}
+
+	for( uint32 i = 0; i < Num; ++i )
+	{
+		OutOrder[i] = Items[i].Index;
+	}
+	FMemory::Free(Items < Scratch ? Items : Scratch);
+}
+
+/**
+	Call Lambda(Index) for each Index in [0, Count), each on its own thread.
+	Index 0 runs on the calling thread.
+*/
+template<typename LAMBDA>
+void RunOnThreads(uint32 Count, const LAMBDA& Lambda)
+{
+	check(Count <= MaxParallelSortThreads);
+
+	std::thread Threads[MaxParallelSortThreads];
+	for( uint32 i = 1; i < Count; ++i )
+	{
+		Threads[i] = std::thread(Lambda, i);
+	}
+	Lambda(0);
+	for( uint32 i = 1; i < Count; ++i )
+	{
+		Threads[i].join();
+	}
+}
+
+/**
+	Sort chunks of Data on separate threads, then merge neighbour chunks pairwise, also in parallel.
+	Compare is called concurrently and must not modify shared state.
+*/
+template<typename T, typename Predicate>
+void ParallelSort(T* Data, uint32 Num, const Predicate& Compare)
+{
+	uint32 NumThreads = std::thread::hardware_concurrency();
+	NumThreads = NumThreads < Num / MinParallelSortItemsPerThread ? NumThreads : Num / MinParallelSortItemsPerThread;
+	NumThreads = NumThreads < MaxParallelSortThreads ? NumThreads : MaxParallelSortThreads;
+	if( NumThreads <= 1 )
+	{
+		std::sort(Data, Data + Num, Compare);
+		return;
+	}
+
+	uint32 Bounds[MaxParallelSortThreads + 1];
+	for( uint32 i = 0; i <= NumThreads; ++i )
+	{
+		Bounds[i] = static_cast<uint32>(static_cast<uint64>(Num) * i / NumThreads);
+	}
+
+	RunOnThreads(NumThreads, [&](uint32 Chunk) { std::sort(Data + Bounds[Chunk], Data + Bounds[Chunk + 1], Compare); });
+
+	for( uint32 Width = 1; Width < NumThreads; Width *= 2 )
+	{
+		const uint32 NumMerges = (NumThreads + 2 * Width - 1) / (2 * Width);
+		RunOnThreads(
+			NumMerges,
+			[&](uint32 Merge)
+			{
+				const uint32 Left = 2 * Width * Merge;
+				const uint32 Middle = Left + Width < NumThreads ? Left + Width : NumThreads;
+				const uint32 Right = Left + 2 * Width < NumThreads ? Left + 2 * Width : NumThreads;
+				if( Middle < Right )
+				{
+					std::inplace_merge(Data + Bounds[Left], Data + Bounds[Middle], Data + Bounds[Right], Compare);
+				}
+			}
+		);
+	}
+}
+} // namespace ArraySort_Private
@@ -0,0 +1,160 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMath.h"
+#include "NumericLimits.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "TypeTraits/RemoveCV.h"
+#include "TypeTraits/EnableIf.h"
+#include "TypeTraits/AreTypesEqual.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+#include "ArraySearch.h"
+#include "Array.h"
+
+
+
+
+/**
+	Non-owning view of contiguous elements: pointer and count.
+	Use TArrayView<const T> to pass read-only ranges without copying TArray or C array.
+
+	@note View does not extend lifetime of viewed memory, and TArray reallocation invalidates it.
+*/
+template<typename T>
+struct TArrayView
+{
+public:
+
+	using ElementType = T;
+	using MutableElementType = typename TRemoveCV<T>::Type;
+
+public:
+
+	TArrayView() = default;
+	FORCEINLINE TArrayView(T* InData, uint32 InNum) noexcept : Data(InData), Size(InNum) { check(Data != nullptr || Size == 0); }
+	template<uint32 N>
+	FORCEINLINE TArrayView(T (&InArray)[N]) noexcept : Data(InArray), Size(N)
+	{
+	}
+	template<typename Allocator>
+	FORCEINLINE TArrayView(TArray<MutableElementType, Allocator>& InArray) noexcept : Data(InArray.GetData()), Size(InArray.Num())
+	{
+	}
+	/**
+		Only TArrayView<const T> can view const TArray.
+	*/
+	template<typename Allocator>
+	FORCEINLINE TArrayView(const TArray<MutableElementType, Allocator>& InArray) noexcept : Data(InArray.GetData()), Size(InArray.Num())
+	{
+	}
+	/**
+		TArrayView<T> converts to TArrayView<const T>. Only const is added, view of derived type can't become view of base.
+	*/
+	template<typename OtherT, typename = typename TEnableIf<TAreTypesEqual<T, const OtherT>::Value>::Type>
+	FORCEINLINE TArrayView(const TArrayView<OtherT>& Other) noexcept : Data(Other.GetData()), Size(Other.Num())
+	{
+	}
+
+
+public:
+
+	FORCEINLINE T& operator[](uint32 Index) const noexcept
+	{
+		check(Index < Size);
+		return Data[Index];
+	}
+
+	FORCEINLINE T* begin() const noexcept { return Data; }
+	FORCEINLINE T* end() const noexcept { return Data + Size; }
+
+public:
+
+	/**
+		@return count of viewed elements.
+	*/
+	FORCEINLINE uint32 Num() const noexcept { return Size; }
+	/**
+		Check that view has no elements.
+	*/
+	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
+	/**
+		Check that index is in view range.
+	*/
+	FORCEINLINE bool IsValidIndex(uint32 Index) const noexcept { return Index < Size; }
+	/**
+		@return pointer to first element.
+	*/
+	FORCEINLINE T* GetData() const noexcept { return Data; }
+
+	FORCEINLINE T& First() const noexcept { return (*this)[0]; }
+	FORCEINLINE T& Last() const noexcept { return (*this)[Size - 1]; }
+
+public:
+
+	/**
+		@return view of first Count elements.
+	*/
+	FORCEINLINE TArrayView Left(uint32 Count) const noexcept { return TArrayView(Data, FMath::Min(Count, Size)); }
+	/**
+		@return view without last Count elements.
+	*/
+	FORCEINLINE TArrayView LeftChop(uint32 Count) const noexcept { return TArrayView(Data, Size - FMath::Min(Count, Size)); }
+	/**
+		@return view of last Count elements.
+	*/
+	FORCEINLINE TArrayView Right(uint32 Count) const noexcept
+	{
+		Count = FMath::Min(Count, Size);
+		return TArrayView(Data + Size - Count, Count);
+	}
+	/**
+		@return view without first Count elements.
+	*/
+	FORCEINLINE TArrayView RightChop(uint32 Count) const noexcept
+	{
+		Count = FMath::Min(Count, Size);
+		return TArrayView(Data + Count, Size - Count);
+	}
+	/**
+		@return view of Count elements from Start position, clamped to this view.
+	*/
+	FORCEINLINE TArrayView Mid(uint32 Start, uint32 Count = MAX_uint32) const noexcept
+	{
+		Start = FMath::Min(Start, Size);
+		return TArrayView(Data + Start, FMath::Min(Count, Size - Start));
+	}
+
+	/**
+		@return index of first found Elem by operator==. If not found return INDEX_NONE.
+	*/
+	FORCEINLINE uint32 Find(const MutableElementType& Elem) const noexcept { return ArraySearch_Private::TArraySearch<MutableElementType>::Find(Data, Size, Elem); }
+	FORCEINLINE bool Contains(const MutableElementType& Elem) const noexcept { return Find(Elem) != INDEX_NONE; }
+
+	/**
+		Copy viewed elements into new array.
+	*/
+	FORCEINLINE TArray<MutableElementType> ToArray() const
+	{
+		TArray<MutableElementType> Result;
+		Result.Append(Data, Size);
+		return Result;
+	}
+
+
+
+private:
+
+	T* Data = nullptr;
+	uint32 Size = 0;
+};
+
+template<typename T>
+struct TIsTriviallyRelocatable<TArrayView<T>>
+{
+	enum
+	{
+		Value = true
+	};
+};
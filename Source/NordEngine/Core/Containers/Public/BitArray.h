@@ -0,0 +1,354 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "EngineMath.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+#include "Array.h"
+
+// We require SSE2
+#include <emmintrin.h>
+
+
+
+
+namespace BitArray_Private
+{
+static constexpr uint32 BitsPerWord = 64;
+
+FORCEINLINE uint32 NumWordsFor(uint32 NumBits) noexcept { return (NumBits + BitsPerWord - 1) / BitsPerWord; }
+
+/**
+	Apply Op to whole words of Dest and Source, two words per SSE2 operation.
+*/
+template<typename VectorOp, typename ScalarOp>
+FORCEINLINE void ApplyWords(uint64* Dest, const uint64* Source, uint32 NumWords, VectorOp Vector, ScalarOp Scalar) noexcept
+{
+	uint32 i = 0;
+	for( ; i + 2 <= NumWords; i += 2 )
+	{
+		const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Dest + i));
+		const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + i), Vector(A, B));
+	}
+	for( ; i < NumWords; ++i )
+	{
+		Dest[i] = Scalar(Dest[i], Source[i]);
+	}
+}
+} // namespace BitArray_Private
+
+
+
+/**
+	Dynamic array of bits packed in 64-bit words.
+	Search uses bit scan over whole words and set operations process several words at once,
+	so masks like "visible AND NOT pending kill" over many objects cost few instructions per 64 objects.
+
+	@note Bits after Num() in the last word are always zero.
+*/
+template<typename Allocator = FDefaultAllocator>
+struct TBitArray
+{
+public:
+
+	TBitArray() = default;
+	FORCEINLINE TBitArray(bool bValue, uint32 NumBits) { Init(bValue, NumBits); }
+	TBitArray(const TBitArray& Other) = default;
+	TBitArray(TBitArray&& Other) noexcept = default;
+	~TBitArray() = default;
+
+
+public:
+
+	TBitArray& operator=(const TBitArray& Other) = default;
+	TBitArray& operator=(TBitArray&& Other) noexcept = default;
+
+	FORCEINLINE bool operator[](uint32 Index) const noexcept { return Get(Index); }
+
+	FORCEINLINE bool operator==(const TBitArray& Other) const noexcept
+	{
+		if( NumBits != Other.NumBits ) return false;
+		return NumBits == 0 || FMemory::MemCmp(Words.GetData(), Other.Words.GetData(), Words.Num() * sizeof(uint64)) == 0;
+	}
+	FORCEINLINE bool operator!=(const TBitArray& Other) const noexcept { return !(*this == Other); }
+
+public:
+
+	/**
+		@return count of bits.
+	*/
+	FORCEINLINE uint32 Num() const noexcept { return NumBits; }
+	/**
+		Check that array has no bits.
+	*/
+	FORCEINLINE bool IsEmpty() const noexcept { return NumBits == 0; }
+	/**
+		@return words storage, NumWords() words long.
+	*/
+	FORCEINLINE const uint64* GetData() const noexcept { return Words.GetData(); }
+	FORCEINLINE uint32 NumWords() const noexcept { return Words.Num(); }
+
+public:
+
+	FORCEINLINE bool Get(uint32 Index) const noexcept
+	{
+		check(Index < NumBits);
+		return (Words[Index / BitArray_Private::BitsPerWord] >> (Index % BitArray_Private::BitsPerWord)) & 1;
+	}
+	FORCEINLINE void Set(uint32 Index, bool bValue) noexcept
+	{
+		check(Index < NumBits);
+		const uint64 Bit = 1ull << (Index % BitArray_Private::BitsPerWord);
+		uint64& Word = Words[Index / BitArray_Private::BitsPerWord];
+		Word = bValue ? (Word | Bit) : (Word & ~Bit);
+	}
+
+	/**
+		Add bit to the end of array.
+
+		@return index of the new bit.
+	*/
+	FORCEINLINE uint32 Add(bool bValue)
+	{
+		const uint32 Index = NumBits;
+		SetNum(NumBits + 1, false);
+		if( bValue )
+		{
+			Words[Index / BitArray_Private::BitsPerWord] |= 1ull << (Index % BitArray_Private::BitsPerWord);
+		}
+		return Index;
+	}
+
+	/**
+		Replace content with NewNumBits bits equal to bValue.
+	*/
+	FORCEINLINE void Init(bool bValue, uint32 NewNumBits)
+	{
+		Words.Clear();
+		NumBits = 0;
+		SetNum(NewNumBits, bValue);
+	}
+	/**
+		Resize array to NewNumBits, new bits are set to bValue.
+	*/
+	void SetNum(uint32 NewNumBits, bool bValue)
+	{
+		const uint32 OldNumBits = NumBits;
+		const uint32 NewNumWords = BitArray_Private::NumWordsFor(NewNumBits);
+		if( NewNumWords > Words.Num() )
+		{
+			const uint32 Index = Words.AddUninitialized(NewNumWords - Words.Num());
+			FMemory::MemSet(Words.GetData() + Index, bValue ? 0xFF : 0, (NewNumWords - Index) * sizeof(uint64));
+		}
+		else if( NewNumWords < Words.Num() )
+		{
+			Words.RemoveAt(NewNumWords, Words.Num() - NewNumWords);
+		}
+		NumBits = NewNumBits;
+
+		if( bValue && NewNumBits > OldNumBits && OldNumBits % BitArray_Private::BitsPerWord != 0 )
+		{
+			Words[OldNumBits / BitArray_Private::BitsPerWord] |= ~0ull << (OldNumBits % BitArray_Private::BitsPerWord);
+		}
+		ClearSlackBits();
+	}
+	/**
+		Set all bits to bValue.
+	*/
+	FORCEINLINE void SetAll(bool bValue) noexcept
+	{
+		if( Words.IsEmpty() ) return;
+
+		FMemory::MemSet(Words.GetData(), bValue ? 0xFF : 0, Words.Num() * sizeof(uint64));
+		ClearSlackBits();
+	}
+
+	/**
+		Remove all bits without physical resizing to 0.
+	*/
+	FORCEINLINE void Clear()
+	{
+		Words.Clear();
+		NumBits = 0;
+	}
+	/**
+		Physically resize to 0 size.
+	*/
+	FORCEINLINE void Reset()
+	{
+		Words.Reset();
+		NumBits = 0;
+	}
+
+public:
+
+	/**
+		@return index of first set bit or INDEX_NONE.
+	*/
+	FORCEINLINE uint32 FindFirstSet() const noexcept { return FindNextSet(0); }
+	/**
+		@return index of first set bit not less than Start or INDEX_NONE.
+	*/
+	uint32 FindNextSet(uint32 Start) const noexcept
+	{
+		if( Start >= NumBits ) return INDEX_NONE;
+
+		uint32 WordIndex = Start / BitArray_Private::BitsPerWord;
+		uint64 Word = Words[WordIndex] & (~0ull << (Start % BitArray_Private::BitsPerWord));
+		for( ;; )
+		{
+			if( Word != 0 )
+			{
+				return WordIndex * BitArray_Private::BitsPerWord + FMath::CountTrailingZeros64(Word);
+			}
+			if( ++WordIndex == Words.Num() ) return INDEX_NONE;
+			Word = Words[WordIndex];
+		}
+	}
+	/**
+		@return index of first clear bit or INDEX_NONE.
+	*/
+	uint32 FindFirstClear() const noexcept
+	{
+		for( uint32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex )
+		{
+			const uint64 Word = ~Words[WordIndex];
+			if( Word != 0 )
+			{
+				const uint32 Index = WordIndex * BitArray_Private::BitsPerWord + FMath::CountTrailingZeros64(Word);
+				return Index < NumBits ? Index : INDEX_NONE;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/**
+		@return count of set bits.
+	*/
+	uint32 CountSetBits() const noexcept
+	{
+		uint32 Result = 0;
+		for( uint32 i = 0; i < Words.Num(); ++i )
+		{
+			Result += FMath::CountBits64(Words[i]);
+		}
+		return Result;
+	}
+
+	/**
+		Call Lambda for index of each set bit in increasing order.
+
+		@param Lambda - lambda , e.g [](uint32 Index) {}
+	*/
+	template<typename LAMBDA>
+	void ForEachSetBit(LAMBDA Lambda) const
+	{
+		for( uint32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex )
+		{
+			uint64 Word = Words[WordIndex];
+			while( Word != 0 )
+			{
+				Lambda(WordIndex * BitArray_Private::BitsPerWord + FMath::CountTrailingZeros64(Word));
+				Word &= Word - 1;
+			}
+		}
+	}
+
+public:
+
+	/**
+		this = this AND Other. Arrays must have the same size.
+	*/
+	FORCEINLINE TBitArray& BitwiseAnd(const TBitArray& Other) noexcept
+	{
+		check(NumBits == Other.NumBits);
+		BitArray_Private::ApplyWords(
+			Words.GetData(), Other.Words.GetData(), Words.Num(), [](__m128i A, __m128i B) { return _mm_and_si128(A, B); }, [](uint64 A, uint64 B) { return A & B; }
+		);
+		return *this;
+	}
+	/**
+		this = this OR Other. Arrays must have the same size.
+	*/
+	FORCEINLINE TBitArray& BitwiseOr(const TBitArray& Other) noexcept
+	{
+		check(NumBits == Other.NumBits);
+		BitArray_Private::ApplyWords(
+			Words.GetData(), Other.Words.GetData(), Words.Num(), [](__m128i A, __m128i B) { return _mm_or_si128(A, B); }, [](uint64 A, uint64 B) { return A | B; }
+		);
+		return *this;
+	}
+	/**
+		this = this AND NOT Other. Arrays must have the same size.
+	*/
+	FORCEINLINE TBitArray& BitwiseAndNot(const TBitArray& Other) noexcept
+	{
+		check(NumBits == Other.NumBits);
+		// _mm_andnot_si128 negates its first operand
+		BitArray_Private::ApplyWords(
+			Words.GetData(), Other.Words.GetData(), Words.Num(), [](__m128i A, __m128i B) { return _mm_andnot_si128(B, A); }, [](uint64 A, uint64 B) { return A & ~B; }
+		);
+		return *this;
+	}
+	/**
+		this = this XOR Other. Arrays must have the same size.
+	*/
+	FORCEINLINE TBitArray& BitwiseXor(const TBitArray& Other) noexcept
+	{
+		check(NumBits == Other.NumBits);
+		BitArray_Private::ApplyWords(
+			Words.GetData(), Other.Words.GetData(), Words.Num(), [](__m128i A, __m128i B) { return _mm_xor_si128(A, B); }, [](uint64 A, uint64 B) { return A ^ B; }
+		);
+		return *this;
+	}
+	/**
+		Invert all bits.
+	*/
+	FORCEINLINE TBitArray& BitwiseNot() noexcept
+	{
+		for( uint32 i = 0; i < Words.Num(); ++i )
+		{
+			Words[i] = ~Words[i];
+		}
+		ClearSlackBits();
+		return *this;
+	}
+
+
+
+private:
+
+	/**
+		Keep bits after NumBits zero, so search and count can work on whole words.
+	*/
+	FORCEINLINE void ClearSlackBits() noexcept
+	{
+		const uint32 UsedBits = NumBits % BitArray_Private::BitsPerWord;
+		if( UsedBits != 0 )
+		{
+			Words[Words.Num() - 1] &= (1ull << UsedBits) - 1;
+		}
+	}
+
+
+
+private:
+
+	TArray<uint64, Allocator> Words;
+	uint32 NumBits = 0;
+};
+
+template<typename Allocator>
+struct TIsTriviallyRelocatable<TBitArray<Allocator>>
+{
+	enum
+	{
+		Value = TIsTriviallyRelocatable<TArray<uint64, Allocator>>::Value
+	};
+};
+
+using FBitArray = TBitArray<>;
@@ -3,6 +3,7 @@
 
 #include "GenericPlatform.h"
 #include "EngineMath.h"
+#include "TypeHash.h"
 #include "Array.h"
 
 
@@ -530,11 +531,11 @@ public:
 
 FORCEINLINE uint64 GetTypeHash(const FColor& Color) noexcept
 {
-	return Color.DWColor();
+	return HashMix64(Color.DWColor());
 }
 
 FORCEINLINE uint64 GetTypeHash(const FLinearColor& Color) noexcept
 {
 	const double tmp = static_cast<double>(Color.R) + static_cast<double>(Color.G) * 257.0 + static_cast<double>(Color.B) * 557.0 + static_cast<double>(Color.A) * 977.0;
-	return *(uint64*)&(tmp);
+	return HashMix64(*(uint64*)&(tmp));
 }
\ No newline at end of file
@@ -0,0 +1,468 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "MemoryArena.h"
+#include "FrameAllocator.h"
+#include "AssertionMacros.h"
+#include "MemoryOps.h"
+#include "TypeCompatibleBytes.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+
+
+
+
+/*
+	Allocator policies for TArray.
+
+	Each policy declares template class ForElementType<T> that owns storage of the array:
+		GetAllocation() - pointer to the first element.
+		ResizeAllocation(NumLive, NumElements) - reallocate storage for NumElements, first NumLive elements are relocated.
+		CalculateSlackGrow(NumElements) - capacity to allocate when array grows to NumElements.
+		CalculateSlackReserve(NumElements) - capacity to allocate for exactly NumElements.
+		GetInitialCapacity() - capacity available without any allocation.
+		HasAllocation() - true if storage was allocated.
+		MoveToEmpty(Other, NumLive) - take storage and NumLive elements of Other, this must be empty. Other becomes empty.
+	Copy constructed instance copies the policy settings (e.g. arena), but never the allocation.
+*/
+
+
+
+
+
+/**
+	Policy that stores elements in one heap block from FMemory aligned to at least MinAlignment.
+	Storage is always aligned to alignof(ElementType), so over-aligned SIMD types can use aligned loads.
+	e.g TArray<float, TAlignedHeapAllocator<32>> for AVX loads over plain floats.
+*/
+template<uint32 MinAlignment>
+struct TAlignedHeapAllocator
+{
+	static_assert(MinAlignment == 0 || (MinAlignment & (MinAlignment - 1)) == 0, "Alignment must be power of two");
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType() = default;
+		FORCEINLINE ForElementType(const ForElementType&) noexcept { }
+		FORCEINLINE ~ForElementType()
+		{
+			if( Data )
+			{
+				Deallocate(Data);
+			}
+		}
+
+		ForElementType& operator=(const ForElementType&) = delete;
+
+
+	public:
+
+		FORCEINLINE ElementType* GetAllocation() const noexcept { return Data; }
+
+		FORCEINLINE void ResizeAllocation(uint32 NumLive, uint32 NumElements)
+		{
+			if( NumElements == 0 )
+			{
+				if( Data )
+				{
+					Deallocate(Data);
+					Data = nullptr;
+				}
+				return;
+			}
+
+			if( Data == nullptr )
+			{
+				Data = Allocate(NumElements);
+			}
+			else if( TIsTriviallyRelocatable<ElementType>::Value )
+			{
+				Data = Reallocate(Data, NumElements);
+			}
+			else
+			{
+				ElementType* NewData = Allocate(NumElements);
+				RelocateConstructItems<ElementType>(NewData, Data, NumLive);
+				Deallocate(Data);
+				Data = NewData;
+			}
+		}
+
+		FORCEINLINE uint32 CalculateSlackGrow(uint32 NumElements) const noexcept { return NumElements * 2; } // do not reduce the growth factor
+		FORCEINLINE uint32 CalculateSlackReserve(uint32 NumElements) const noexcept { return NumElements; }
+		FORCEINLINE uint32 GetInitialCapacity() const noexcept { return 0; }
+		FORCEINLINE bool HasAllocation() const noexcept { return Data != nullptr; }
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other, uint32 NumLive) noexcept
+		{
+			check(this != &Other && Data == nullptr);
+
+			Data = Other.Data;
+			Other.Data = nullptr;
+		}
+
+	private:
+
+		static constexpr SIZE_T Alignment = MinAlignment > alignof(ElementType) ? MinAlignment : alignof(ElementType);
+		/**
+			FMemory::Malloc alignment is enough for most types, only wider alignment pays for aligned API.
+		*/
+		static constexpr bool bOverAligned = Alignment > FMalloc::DefaultAlignment;
+
+		static FORCEINLINE ElementType* Allocate(uint32 NumElements)
+		{
+			if constexpr( bOverAligned ) return static_cast<ElementType*>(FMemory::MallocAligned(sizeof(ElementType) * NumElements, Alignment));
+			else return static_cast<ElementType*>(FMemory::Malloc(sizeof(ElementType) * NumElements));
+		}
+		static FORCEINLINE ElementType* Reallocate(ElementType* Ptr, uint32 NumElements)
+		{
+			if constexpr( bOverAligned ) return static_cast<ElementType*>(FMemory::ReallocAligned(Ptr, sizeof(ElementType) * NumElements, Alignment));
+			else return static_cast<ElementType*>(FMemory::Realloc(Ptr, sizeof(ElementType) * NumElements));
+		}
+		static FORCEINLINE void Deallocate(ElementType* Ptr)
+		{
+			if constexpr( bOverAligned ) FMemory::FreeAligned(Ptr);
+			else FMemory::Free(Ptr);
+		}
+
+
+
+	private:
+
+		ElementType* Data = nullptr;
+	};
+};
+
+/**
+	Default policy. Elements are stored in one heap block from FMemory aligned to alignof(ElementType).
+*/
+using FHeapAllocator = TAlignedHeapAllocator<0>;
+
+/**
+	Policy for arrays that are processed by several threads or streamed with SIMD, storage starts at cache line.
+*/
+using FCacheAlignedHeapAllocator = TAlignedHeapAllocator<PLATFORM_CACHE_LINE_SIZE>;
+
+/**
+	Policy with space for NumInlineElements inside the array object.
+	When the array grows beyond it, elements spill to the SecondaryAllocator and return back after shrinking.
+*/
+template<uint32 NumInlineElements, typename SecondaryAllocator = FHeapAllocator>
+struct TInlineAllocator
+{
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType() = default;
+		FORCEINLINE ForElementType(const ForElementType& Other) noexcept : Secondary(Other.Secondary) { }
+		~ForElementType() = default;
+
+		ForElementType& operator=(const ForElementType&) = delete;
+
+
+	public:
+
+		FORCEINLINE ElementType* GetAllocation() const noexcept
+		{
+			ElementType* SecondaryData = Secondary.GetAllocation();
+			return SecondaryData ? SecondaryData : GetInlineElements();
+		}
+
+		void ResizeAllocation(uint32 NumLive, uint32 NumElements)
+		{
+			if( NumElements <= NumInlineElements )
+			{
+				// Return elements to the inline storage
+				if( Secondary.HasAllocation() )
+				{
+					RelocateConstructItems<ElementType>(GetInlineElements(), Secondary.GetAllocation(), NumLive);
+					Secondary.ResizeAllocation(0, 0);
+				}
+			}
+			else if( Secondary.HasAllocation() )
+			{
+				Secondary.ResizeAllocation(NumLive, NumElements);
+			}
+			else
+			{
+				Secondary.ResizeAllocation(0, NumElements);
+				RelocateConstructItems<ElementType>(Secondary.GetAllocation(), GetInlineElements(), NumLive);
+			}
+		}
+
+		FORCEINLINE uint32 CalculateSlackGrow(uint32 NumElements) const noexcept { return NumElements <= NumInlineElements ? NumInlineElements : Secondary.CalculateSlackGrow(NumElements); }
+		FORCEINLINE uint32 CalculateSlackReserve(uint32 NumElements) const noexcept { return NumElements <= NumInlineElements ? NumInlineElements : Secondary.CalculateSlackReserve(NumElements); }
+		FORCEINLINE uint32 GetInitialCapacity() const noexcept { return NumInlineElements; }
+		FORCEINLINE bool HasAllocation() const noexcept { return Secondary.HasAllocation(); }
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other, uint32 NumLive) noexcept
+		{
+			check(this != &Other && !Secondary.HasAllocation());
+
+			if( Other.Secondary.HasAllocation() )
+			{
+				Secondary.MoveToEmpty(Other.Secondary, NumLive);
+			}
+			else
+			{
+				RelocateConstructItems<ElementType>(GetInlineElements(), Other.GetInlineElements(), NumLive);
+			}
+		}
+
+	private:
+
+		FORCEINLINE ElementType* GetInlineElements() const noexcept { return const_cast<ElementType*>(InlineData[0].GetTypedPtr()); }
+
+
+
+	private:
+
+		/**
+			Inline storage, used while the secondary allocation is empty.
+		*/
+		TTypeCompatibleBytes<ElementType> InlineData[NumInlineElements];
+		/**
+			Storage for elements that do not fit inline.
+		*/
+		typename SecondaryAllocator::template ForElementType<ElementType> Secondary;
+	};
+};
+
+/**
+	Policy with space for NumInlineElements inside the array object and no heap fallback.
+	Growing beyond NumInlineElements is an error.
+*/
+template<uint32 NumInlineElements>
+struct TFixedAllocator
+{
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType() = default;
+		FORCEINLINE ForElementType(const ForElementType&) noexcept { }
+		~ForElementType() = default;
+
+		ForElementType& operator=(const ForElementType&) = delete;
+
+
+	public:
+
+		FORCEINLINE ElementType* GetAllocation() const noexcept { return const_cast<ElementType*>(InlineData[0].GetTypedPtr()); }
+
+		FORCEINLINE void ResizeAllocation(uint32 NumLive, uint32 NumElements) { checkf(NumElements <= NumInlineElements, TEXT("TFixedAllocator overflow")); }
+
+		FORCEINLINE uint32 CalculateSlackGrow(uint32 NumElements) const noexcept
+		{
+			checkf(NumElements <= NumInlineElements, TEXT("TFixedAllocator overflow"));
+			return NumInlineElements;
+		}
+		FORCEINLINE uint32 CalculateSlackReserve(uint32 NumElements) const noexcept
+		{
+			checkf(NumElements <= NumInlineElements, TEXT("TFixedAllocator overflow"));
+			return NumInlineElements;
+		}
+		FORCEINLINE uint32 GetInitialCapacity() const noexcept { return NumInlineElements; }
+		FORCEINLINE bool HasAllocation() const noexcept { return false; }
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other, uint32 NumLive) noexcept
+		{
+			check(this != &Other);
+			RelocateConstructItems<ElementType>(GetAllocation(), Other.GetAllocation(), NumLive);
+		}
+
+
+
+	private:
+
+		TTypeCompatibleBytes<ElementType> InlineData[NumInlineElements];
+	};
+};
+
+/**
+	Policy that takes memory from FMemoryArena.
+	Old blocks are not freed on growth, they are released with the arena, so the arena must outlive the array.
+	e.g TArray<int32, FArenaAllocator> Array(Arena);
+*/
+struct FArenaAllocator
+{
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType() = default;
+		FORCEINLINE ForElementType(FMemoryArena& InArena) noexcept : Arena(&InArena) { }
+		FORCEINLINE ForElementType(const ForElementType& Other) noexcept : Arena(Other.Arena) { }
+		~ForElementType() = default;
+
+		ForElementType& operator=(const ForElementType&) = delete;
+
+
+	public:
+
+		FORCEINLINE ElementType* GetAllocation() const noexcept { return Data; }
+
+		FORCEINLINE void ResizeAllocation(uint32 NumLive, uint32 NumElements)
+		{
+			if( NumElements == 0 )
+			{
+				Data = nullptr;
+				return;
+			}
+
+			checkf(Arena, TEXT("FArenaAllocator is used without arena"));
+			ElementType* NewData = static_cast<ElementType*>(Arena->Allocate(sizeof(ElementType) * NumElements, alignof(ElementType)));
+			if( Data && NumLive )
+			{
+				RelocateConstructItems<ElementType>(NewData, Data, NumLive);
+			}
+			Data = NewData;
+		}
+
+		FORCEINLINE uint32 CalculateSlackGrow(uint32 NumElements) const noexcept { return NumElements * 2; }
+		FORCEINLINE uint32 CalculateSlackReserve(uint32 NumElements) const noexcept { return NumElements; }
+		FORCEINLINE uint32 GetInitialCapacity() const noexcept { return 0; }
+		FORCEINLINE bool HasAllocation() const noexcept { return Data != nullptr; }
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other, uint32 NumLive) noexcept
+		{
+			check(this != &Other && Data == nullptr);
+
+			Arena = Other.Arena;
+			Data = Other.Data;
+			Other.Data = nullptr;
+		}
+
+
+
+	private:
+
+		FMemoryArena* Arena = nullptr;
+		ElementType* Data = nullptr;
+	};
+};
+
+/**
+	Policy that takes memory from FFrameAllocator, so the array must not outlive its frame memory lifetime.
+	Old blocks are not freed on growth, they are dropped with the frame arena.
+	e.g TArray<F2DView, TFrameArrayAllocator<>> for scene data rebuilt every frame.
+*/
+template<EFrameMemoryLifetime Lifetime = EFrameMemoryLifetime::OneFrame>
+struct TFrameArrayAllocator
+{
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		ForElementType() = default;
+		FORCEINLINE ForElementType(const ForElementType&) noexcept { }
+		~ForElementType() = default;
+
+		ForElementType& operator=(const ForElementType&) = delete;
+
+
+	public:
+
+		FORCEINLINE ElementType* GetAllocation() const noexcept { return Data; }
+
+		FORCEINLINE void ResizeAllocation(uint32 NumLive, uint32 NumElements)
+		{
+			checkf(Data == nullptr || FFrameAllocator::GetFrameNumber() - Frame < (Lifetime == EFrameMemoryLifetime::OneFrame ? 1u : 2u),
+				TEXT("Frame array is used after its frame"));
+
+			if( NumElements == 0 )
+			{
+				Data = nullptr;
+				return;
+			}
+
+			ElementType* NewData = static_cast<ElementType*>(FFrameAllocator::Allocate(sizeof(ElementType) * NumElements, alignof(ElementType), Lifetime));
+			if( Data && NumLive )
+			{
+				RelocateConstructItems<ElementType>(NewData, Data, NumLive);
+			}
+			Data = NewData;
+			Frame = FFrameAllocator::GetFrameNumber();
+		}
+
+		FORCEINLINE uint32 CalculateSlackGrow(uint32 NumElements) const noexcept { return NumElements * 2; }
+		FORCEINLINE uint32 CalculateSlackReserve(uint32 NumElements) const noexcept { return NumElements; }
+		FORCEINLINE uint32 GetInitialCapacity() const noexcept { return 0; }
+		FORCEINLINE bool HasAllocation() const noexcept { return Data != nullptr; }
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other, uint32 NumLive) noexcept
+		{
+			check(this != &Other && Data == nullptr);
+
+			Data = Other.Data;
+			Frame = Other.Frame;
+			Other.Data = nullptr;
+		}
+
+
+
+	private:
+
+		ElementType* Data = nullptr;
+		/**
+			Frame of the current allocation.
+		*/
+		uint64 Frame = 0;
+	};
+};
+
+/**
+	Policy for arrays valid until the end of the frame.
+*/
+using FFrameArrayAllocator = TFrameArrayAllocator<EFrameMemoryLifetime::OneFrame>;
+/**
+	Policy for arrays handed to render thread, valid until the end of the next frame.
+*/
+using FDoubleBufferedFrameArrayAllocator = TFrameArrayAllocator<EFrameMemoryLifetime::TwoFrames>;
+
+/**
+	Compile-time properties of allocator policy.
+*/
+template<typename AllocatorType>
+struct TAllocatorTraits
+{
+	enum
+	{
+		/**
+			Elements may live inside the container object, so moving the container moves the elements.
+		*/
+		HasInlineStorage = false
+	};
+};
+
+template<uint32 NumInlineElements, typename SecondaryAllocator>
+struct TAllocatorTraits<TInlineAllocator<NumInlineElements, SecondaryAllocator>>
+{
+	enum
+	{
+		HasInlineStorage = true
+	};
+};
+
+template<uint32 NumInlineElements>
+struct TAllocatorTraits<TFixedAllocator<NumInlineElements>>
+{
+	enum
+	{
+		HasInlineStorage = true
+	};
+};
+
+/**
+	Policy used by containers by default.
+*/
+using FDefaultAllocator = FHeapAllocator;
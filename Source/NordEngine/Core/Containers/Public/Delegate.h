@@ -325,8 +325,9 @@ private:
 
 	/**
 		Array of subscribed objects.
+		Most delegates have few subscribers, so they are stored inline.
 	*/
-	TArray<TBaseDelegateHandler<ParamTypes...>*> Handlers;
+	TArray<TBaseDelegateHandler<ParamTypes...>*, TInlineAllocator<4>> Handlers;
 
 	/**
 		True while Broadcasting.
@@ -384,7 +385,7 @@ public:
 	template<typename Predicate>
 	FORCEINLINE void Broadcast(ParamTypes... Params, Predicate Condition)
 	{
-		Delegate.Broadcast<Predicate>(Params..., Condition);
+		Delegate.template Broadcast<Predicate>(Params..., Condition);
 	}
 
 
@@ -596,7 +597,7 @@ public:
 	template<typename Predicate>
 	FORCEINLINE void Broadcast(ParamTypes... Params, Predicate Condition)
 	{
-		Delegate.Broadcast<Predicate>(Params..., Condition);
+		Delegate.template Broadcast<Predicate>(Params..., Condition);
 	}
 
 
@@ -4,6 +4,10 @@
 #include "GenericPlatform.h"
 #include "GenericPlatformString.h"
 #include "StringBuffer.h"
+#include "StringView.h"
+#include "StringTokenizer.h"
+#include "StringBuilder.h"
+#include "StringConversion.h"
 #include "Char.h"
 
 #include "EngineMath.h"
@@ -11,37 +15,15 @@
 #include "EngineMemory.h"
 
 #include "MoveSemantic.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+#include "TypeTraits/IsArithmetic.h"
+#include "TypeTraits/EnableIf.h"
 
 #include "Array.h"
 
 
 
 
-/** 
-	Determines case sensitivity options for string comparisons. 
-*/
-enum class ESearchCase : uint8
-{
-	// Case sensitive. Upper/lower casing must match for strings to be considered equal.
-	CaseSensitive,
-
-	// Ignore case. Upper/lower casing does not matter when making a comparison.
-	IgnoreCase
-};
-
-/** 
-	Determines search direction for string operations. 
-*/
-enum class ESearchDir : uint8
-{
-	// Search from the start, moving forward through the string.
-	FromStart,
-
-	// Search from the end, moving backward through the string.
-	FromEnd
-};
-
-
 /**
 	Engine version of std::string.
 */
@@ -52,8 +34,9 @@ public:
 	FORCEINLINE explicit FString(uint32 UnitializedSize = 0) noexcept { SetNumUninitialized(UnitializedSize); }
 	FORCEINLINE FString(const TCHAR NewString[]) noexcept
 	{
-		StringBuffer.Resize(FPlatformString::Strlen(NewString));
-		FPlatformString::Strcpy(StringBuffer.GetBuffer(), StringBuffer.GetBufferSize(), NewString);
+		const uint32 NewLength = FPlatformString::Strlen(NewString);
+		StringBuffer.Resize(NewLength);
+		FMemory::MemCpy(StringBuffer.GetBuffer(), NewString, sizeof(TCHAR) * NewLength);
 	}
 	FORCEINLINE FString(const TCHAR NewString[], uint32 Count) noexcept
 	{
@@ -63,10 +46,17 @@ public:
 	FORCEINLINE FString(const FString& Other) noexcept
 	{
 		StringBuffer.Resize(Other.Length());
-		FPlatformString::Strcpy(StringBuffer.GetBuffer(), StringBuffer.GetBufferSize(), Other.GetStr());
+		FMemory::MemCpy(StringBuffer.GetBuffer(), Other.GetStr(), sizeof(TCHAR) * Other.Length());
 	}
 	FORCEINLINE FString(FString&& Other) noexcept : StringBuffer(MoveTemp(Other.StringBuffer)) { }
 	FORCEINLINE FString(FStringBuffer&& Buffer) noexcept : StringBuffer(MoveTemp(Buffer)) { }
+	FORCEINLINE explicit FString(FStringView View) noexcept
+	{
+		if( View.IsEmpty() ) return;
+
+		StringBuffer.Resize(View.Len());
+		FMemory::MemCpy(StringBuffer.GetBuffer(), View.GetData(), sizeof(TCHAR) * View.Len());
+	}
 
 
 public:
@@ -76,7 +66,7 @@ public:
 		if( this == &Other ) return *this;
 
 		StringBuffer.Resize(Other.Length());
-		FPlatformString::Strcpy(StringBuffer.GetBuffer(), StringBuffer.GetBufferSize(), Other.GetStr());
+		FMemory::MemCpy(StringBuffer.GetBuffer(), Other.GetStr(), sizeof(TCHAR) * Other.Length());
 
 		return *this;
 	}
@@ -97,8 +87,9 @@ public:
 	{
 		if( StringBuffer.GetBuffer() == S ) return *this;
 
-		StringBuffer.Resize(FPlatformString::Strlen(S));
-		FPlatformString::Strcpy(StringBuffer.GetBuffer(), StringBuffer.GetBufferSize(), S);
+		const uint32 SLength = FPlatformString::Strlen(S);
+		StringBuffer.Resize(SLength);
+		FMemory::MemMove(StringBuffer.GetBuffer(), S, sizeof(TCHAR) * SLength);
 
 		return *this;
 	}
@@ -109,7 +100,7 @@ public:
 	{
 		const uint32 OldLength = Length();
 		StringBuffer.Resize(Length() + Other.Length());
-		FPlatformString::Strcpy(StringBuffer.GetAtByPointer(OldLength), Other.Length(), Other.GetStr());
+		FMemory::MemCpy(StringBuffer.GetAtByPointer(OldLength), Other.GetStr(), sizeof(TCHAR) * Other.Length());
 
 		return *this;
 	}
@@ -125,7 +116,7 @@ public:
 		const uint32 SLength = FPlatformString::Strlen(S);
 		const uint32 OldLength = Length();
 		StringBuffer.Resize(Length() + SLength);
-		FPlatformString::Strcpy(StringBuffer.GetAtByPointer(OldLength), SLength, S);
+		FMemory::MemCpy(StringBuffer.GetAtByPointer(OldLength), S, sizeof(TCHAR) * SLength);
 
 		return *this;
 	}
@@ -133,8 +124,8 @@ public:
 	{
 		FStringBuffer Buff(lhs.Length() + rhs.Length());
 
-		FPlatformString::Strcpy(Buff.GetBuffer(), lhs.Length(), lhs.GetStr());
-		FPlatformString::Strcpy(Buff.GetAtByPointer(lhs.Length()), rhs.Length(), rhs.GetStr());
+		FMemory::MemCpy(Buff.GetBuffer(), lhs.GetStr(), sizeof(TCHAR) * lhs.Length());
+		FMemory::MemCpy(Buff.GetAtByPointer(lhs.Length()), rhs.GetStr(), sizeof(TCHAR) * rhs.Length());
 
 		return FString(MoveTemp(Buff));
 	}
@@ -143,7 +134,7 @@ public:
 		uint32 lhsOldLength = lhs.Length();
 		lhs.StringBuffer.Resize(lhs.Length() + rhs.Length());
 
-		FPlatformString::Strcpy(lhs.StringBuffer.GetAtByPointer(lhsOldLength), rhs.Length(), rhs.GetStr());
+		FMemory::MemCpy(lhs.StringBuffer.GetAtByPointer(lhsOldLength), rhs.GetStr(), sizeof(TCHAR) * rhs.Length());
 
 		return FString(MoveTemp(lhs));
 	}
@@ -152,8 +143,7 @@ public:
 		uint32 lhsOldLength = lhs.Length();
 		lhs.StringBuffer.Resize(lhs.Length() + rhs.Length());
 
-		FPlatformString::Strcpy(lhs.StringBuffer.GetBuffer(), lhsOldLength, lhs.GetStr());
-		FPlatformString::Strcpy(lhs.StringBuffer.GetAtByPointer(lhsOldLength), rhs.Length(), rhs.GetStr());
+		FMemory::MemCpy(lhs.StringBuffer.GetAtByPointer(lhsOldLength), rhs.GetStr(), sizeof(TCHAR) * rhs.Length());
 
 		return FString(MoveTemp(lhs));
 	}
@@ -168,19 +158,12 @@ public:
 		if( this == &Other ) return true;
 		if( Length() != Other.Length() ) return false;
 
-		const TCHAR* A = StringBuffer.begin();
-		const TCHAR* B = Other.StringBuffer.begin();
-		while( A != StringBuffer.end() )
-		{
-			if( *A != *B ) return false;
-			++A;
-			++B;
-		}
-
-		return true;
+		return StringSearch_Private::Equals(GetStr(), Other.GetStr(), Length(), ESearchCase::CaseSensitive);
 	}
 	FORCEINLINE bool operator!=(const FString& Other) const noexcept { return !(*this == Other); }
 
+	FORCEINLINE operator FStringView() const noexcept { return FStringView(GetStr(), Length()); }
+
 	FORCEINLINE const TCHAR* begin() const noexcept { return StringBuffer.begin(); }
 	FORCEINLINE TCHAR* begin() noexcept { return StringBuffer.begin(); }
 	FORCEINLINE const TCHAR* end() const noexcept { return StringBuffer.end(); }
@@ -192,6 +175,10 @@ public:
 	FORCEINLINE uint32 Length() const noexcept { return StringBuffer.GetLength(); }
 	FORCEINLINE const TCHAR* const GetStr() const noexcept { return StringBuffer.GetBuffer(); }
 	FORCEINLINE TCHAR* const GetBuffer() const noexcept { return StringBuffer.GetBuffer(); }
+	/**
+		Check that string is short enough to be stored without heap allocation.
+	*/
+	FORCEINLINE bool IsInline() const noexcept { return StringBuffer.IsInline(); }
 
 public:
 
@@ -242,15 +229,15 @@ public:
 		const uint32 ArgsSize = (args.Length() + ...);
 		FStringBuffer Buff(First.Length() + Second.Length() + ArgsSize);
 
-		FPlatformString::Strcpy(Buff.GetBuffer(), First.Length(), First.GetStr());
-		FPlatformString::Strcpy(Buff.GetAtByPointer(First.Length()), Second.Length(), Second.GetStr());
+		FMemory::MemCpy(Buff.GetBuffer(), First.GetStr(), sizeof(TCHAR) * First.Length());
+		FMemory::MemCpy(Buff.GetAtByPointer(First.Length()), Second.GetStr(), sizeof(TCHAR) * Second.Length());
 
 		uint32 ConcatPosition = First.Length() + Second.Length();
 		// clang-format off
 		(
 			[&]
 			{
-				FPlatformString::Strcat(Buff.GetAtByPointer(ConcatPosition), args.Length(), args.GetStr());
+				FMemory::MemCpy(Buff.GetAtByPointer(ConcatPosition), args.GetStr(), sizeof(TCHAR) * args.Length());
 				ConcatPosition += args.Length();
 			}(),
 		...);
@@ -270,6 +257,32 @@ public:
 		@return The number of elements in InArray.
 	*/
 	int32 ParseIntoArray(TArray<FString>& OutArray, const TCHAR* pchDelim, bool InCullEmpty = true) const noexcept;
+	/**
+		Breaks up a delimited string into views of this string without copying chars.
+		Views are valid until this string is modified or destroyed.
+
+		@param OutArray - The array to fill with the string pieces.
+		@param Delimiter - The string to delimit on, case sensitive.
+		@param InCullEmpty - If true, empty pieces are not added to the array.
+		@return The number of elements in OutArray.
+	*/
+	int32 ParseIntoArray(TArray<FStringView>& OutArray, FStringView Delimiter, bool InCullEmpty = true) const noexcept;
+	/**
+		@return lazy tokenizer over this string, see FStringTokenizer.
+	*/
+	FORCEINLINE FStringTokenizer Tokenize(FStringView Delimiter, bool InCullEmpty = true) const noexcept { return FStringTokenizer(*this, Delimiter, InCullEmpty); }
+
+	/**
+		Splits this string at given delimiter into views of this string.
+
+		@param OutLeft - Part before delimiter, can be null.
+		@param OutRight - Part after delimiter, can be null.
+		@return false and keeps outputs if delimiter is not found.
+	*/
+	FORCEINLINE bool Split(FStringView Delimiter, FStringView* OutLeft, FStringView* OutRight, ESearchCase SearchCase = ESearchCase::IgnoreCase, ESearchDir SearchDir = ESearchDir::FromStart) const noexcept
+	{
+		return FStringView(*this).Split(Delimiter, OutLeft, OutRight, SearchCase, SearchDir);
+	}
 
 	/**
 		@return a copy of this string, with the characters in reverse order.
@@ -405,12 +418,7 @@ public:
 
 		@return copy of this string with removement made.
 	*/
-	FORCEINLINE FString TrimLeft() const& noexcept
-	{
-		FString FinalString(*this);
-		FinalString.TrimLeftInline();
-		return FinalString;
-	}
+	FORCEINLINE FString TrimLeft() const& noexcept { return FString(TrimLeftView()); }
 	/**
 		Remove leading whitespaces.
 
@@ -424,28 +432,17 @@ public:
 	/**
 		Remove leading whitespaces.
 	*/
-	FORCEINLINE void TrimLeftInline() noexcept
-	{
-		TCHAR* p = begin();
-
-		while( p != end() && FChar::IsWhitespace(*p) )
-		{
-			++p;
-		}
-
-		RemoveAt(0, static_cast<uint32>(p - begin()));
-	}
+	FORCEINLINE void TrimLeftInline() noexcept { RemoveAt(0, Length() - TrimLeftView().Len()); }
+	/**
+		@return view of this string without leading whitespaces.
+	*/
+	FORCEINLINE FStringView TrimLeftView() const noexcept { return FStringView(*this).TrimLeft(); }
 	/**
 		Remove trailing whitespaces.
 
 		@return copy of this string with removement made.
 	*/
-	FORCEINLINE FString TrimRight() const& noexcept
-	{
-		FString FinalString(*this);
-		FinalString.TrimRightInline();
-		return FinalString;
-	}
+	FORCEINLINE FString TrimRight() const& noexcept { return FString(TrimRightView()); }
 	/**
 		Remove trailing whitespaces.
 
@@ -459,27 +456,17 @@ public:
 	/**
 		Remove trailing whitespaces.
 	*/
-	FORCEINLINE void TrimRightInline() noexcept
-	{
-		TCHAR* p = end() - 1;
-		while( p >= begin() && FChar::IsWhitespace(*p) )
-		{
-			--p;
-		}
-
-		RemoveAt(static_cast<uint32>(p - begin()), static_cast<uint32>(end() - 1 - p));
-	}
+	FORCEINLINE void TrimRightInline() noexcept { LeftInline(TrimRightView().Len()); }
+	/**
+		@return view of this string without trailing whitespaces.
+	*/
+	FORCEINLINE FStringView TrimRightView() const noexcept { return FStringView(*this).TrimRight(); }
 	/**
 		Remove leading and trailing whitespaces.
 
 		@return copy of this string with removement made.
 	*/
-	FORCEINLINE FString Trim() const& noexcept
-	{
-		FString FinalString(*this);
-		FinalString.TrimInline();
-		return FinalString;
-	}
+	FORCEINLINE FString Trim() const& noexcept { return FString(TrimView()); }
 	/**
 		Remove leading and trailing whitespaces.
 
@@ -498,6 +485,10 @@ public:
 		TrimRightInline();
 		TrimLeftInline();
 	}
+	/**
+		@return view of this string without leading and trailing whitespaces.
+	*/
+	FORCEINLINE FStringView TrimView() const noexcept { return FStringView(*this).Trim(); }
 
 	/**
 		Test whether this string starts with given string.
@@ -505,34 +496,14 @@ public:
 		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
 		@return true if this string begins with specified text, false otherwise.
 	*/
-	FORCEINLINE bool StartsWith(const TCHAR* InPrefix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept
-	{
-		if( SearchCase == ESearchCase::IgnoreCase )
-		{
-			return InPrefix && *InPrefix && !FPlatformString::Strnicmp(GetStr(), InPrefix, FPlatformString::Strlen(InPrefix));
-		}
-		else
-		{
-			return InPrefix && *InPrefix && !FPlatformString::Strncmp(GetStr(), InPrefix, FPlatformString::Strlen(InPrefix));
-		}
-	}
+	FORCEINLINE bool StartsWith(const TCHAR* InPrefix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return FStringView(*this).StartsWith(InPrefix, SearchCase); }
 	/**
 		Test whether this string starts with given string.
 	 
 		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
 		@return true if this string begins with specified text, false otherwise.
 	*/
-	FORCEINLINE bool StartsWith(const FString& InPrefix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept
-	{
-		if( SearchCase == ESearchCase::IgnoreCase )
-		{
-			return InPrefix.Length() > 0 && !FPlatformString::Strnicmp(GetStr(), InPrefix.GetStr(), InPrefix.Length());
-		}
-		else
-		{
-			return InPrefix.Length() > 0 && !FPlatformString::Strncmp(GetStr(), InPrefix.GetStr(), InPrefix.Length());
-		}
-	}
+	FORCEINLINE bool StartsWith(const FString& InPrefix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return FStringView(*this).StartsWith(InPrefix, SearchCase); }
 
 	/**
 		Test whether this string ends with given string.
@@ -540,39 +511,14 @@ public:
 		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
 		@return true if this string ends with specified text, false otherwise.
 	*/
-	FORCEINLINE bool EndsWith(const TCHAR* InSuffix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept
-	{
-		if( !InSuffix || *InSuffix == TEXT('\0') ) return false;
-
-		const int32 SuffixLen = FPlatformString::Strlen(InSuffix);
-		if( SuffixLen > (int32)Length() ) return false;
-
-		if( SearchCase == ESearchCase::IgnoreCase )
-		{
-			return !FPlatformString::Stricmp(StringBuffer.GetAtByPointer(Length() - SuffixLen), InSuffix);
-		}
-		else
-		{
-			return !FPlatformString::Strcmp(StringBuffer.GetAtByPointer(Length() - SuffixLen), InSuffix);
-		}
-	}
+	FORCEINLINE bool EndsWith(const TCHAR* InSuffix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return FStringView(*this).EndsWith(InSuffix, SearchCase); }
 	/**
 		Test whether this string ends with given string.
 	 
 		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
 		@return true if this string ends with specified text, false otherwise.
 	*/
-	FORCEINLINE bool EndsWith(const FString& InSuffix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept
-	{
-		if( SearchCase == ESearchCase::IgnoreCase )
-		{
-			return InSuffix.Length() > 0 && Length() >= InSuffix.Length() && !FPlatformString::Stricmp(StringBuffer.GetAtByPointer(Length() - InSuffix.Length()), InSuffix.GetStr());
-		}
-		else
-		{
-			return InSuffix.Length() > 0 && Length() >= InSuffix.Length() && !FPlatformString::Strcmp(StringBuffer.GetAtByPointer(Length() - InSuffix.Length()), InSuffix.GetStr());
-		}
-	}
+	FORCEINLINE bool EndsWith(const FString& InSuffix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return FStringView(*this).EndsWith(InSuffix, SearchCase); }
 
 	/**
 		Removes characters within the string.
@@ -587,7 +533,7 @@ public:
 		if( Index + Count > Length() ) Count = Length() - Index;
 		if( Count == 0 ) return;
 
-		FMemory::MemCpy(StringBuffer.GetAtByPointer(Index), StringBuffer.GetAtByPointer(Index + Count), sizeof(TCHAR) * (Length() - Index - Count));
+		FMemory::MemMove(StringBuffer.GetAtByPointer(Index), StringBuffer.GetAtByPointer(Index + Count), sizeof(TCHAR) * (Length() - Index - Count));
 		StringBuffer.Resize(Length() - Count);
 	}
 	/**
@@ -691,7 +637,7 @@ public:
 		{
 			StringBuffer.Resize(Length() + S.Length());
 			FMemory::MemMove(StringBuffer.GetAtByPointer(Index + S.Length()), StringBuffer.GetAtByPointer(Index), sizeof(TCHAR) * (Length() - Index - S.Length()));
-			FPlatformString::Strncpy(StringBuffer.GetAtByPointer(Index), S.GetBuffer(), S.Length());
+			FMemory::MemCpy(StringBuffer.GetAtByPointer(Index), S.GetStr(), sizeof(TCHAR) * S.Length());
 		}
 	}
 
@@ -717,13 +663,7 @@ public:
 	/**
 		Converts all characters in this string to uppercase.
 	*/
-	FORCEINLINE void ToUpperInline() noexcept
-	{
-		for( TCHAR& LChar : StringBuffer )
-		{
-			LChar = FChar::ToUpper(LChar);
-		}
-	}
+	FORCEINLINE void ToUpperInline() noexcept { StringSearch_Private::ToUpperInline(StringBuffer.GetBuffer(), Length()); }
 
 	/**
 		@return a new string with the characters of this converted to lowercase.
@@ -747,22 +687,12 @@ public:
 	/** 
 		Converts all characters in this string to lowercase.
 	*/
-	FORCEINLINE void ToLowerInline() noexcept
-	{
-		for( TCHAR& LChar : StringBuffer )
-		{
-			LChar = FChar::ToLower(LChar);
-		}
-	}
+	FORCEINLINE void ToLowerInline() noexcept { StringSearch_Private::ToLowerInline(StringBuffer.GetBuffer(), Length()); }
 
 	/** 
 		@return the left most given number of characters.
 	*/
-	FORCEINLINE FString Left(uint32 Count) const& noexcept
-	{
-		if( Count > Length() ) Count = Length();
-		return FString(GetStr(), Count);
-	}
+	FORCEINLINE FString Left(uint32 Count) const& noexcept { return FString(LeftView(Count)); }
 	FORCEINLINE FString Left(uint32 Count) && noexcept
 	{
 		LeftInline(Count);
@@ -776,14 +706,14 @@ public:
 		if( Count > Length() ) Count = Length();
 		RemoveAt(Count, Length() - Count);
 	}
+	/** 
+		@return view of the left most given number of characters.
+	*/
+	FORCEINLINE FStringView LeftView(uint32 Count) const noexcept { return FStringView(*this).Left(Count); }
 	/** 
 		@return the left most characters from the string chopping the given number of characters from the end.
 	*/
-	FORCEINLINE FString LeftChop(uint32 Count) const& noexcept
-	{
-		if( Count > Length() ) Count = Length();
-		return FString(GetStr(), Length() - Count);
-	}
+	FORCEINLINE FString LeftChop(uint32 Count) const& noexcept { return FString(LeftChopView(Count)); }
 	FORCEINLINE FString LeftChop(uint32 Count) && noexcept
 	{
 		LeftChopInline(Count);
@@ -797,15 +727,15 @@ public:
 		if( Count > Length() ) Count = Length();
 		RemoveAt(Length() - Count, Count);
 	}
+	/** 
+		@return view of the left most characters chopping the given number of characters from the end.
+	*/
+	FORCEINLINE FStringView LeftChopView(uint32 Count) const noexcept { return FStringView(*this).LeftChop(Count); }
 
 	/**
 		@return the string to the right of the specified location, counting back from the right (end of the word). 
 	*/
-	FORCEINLINE FString Right(uint32 Count) const& noexcept
-	{
-		if( Count > Length() ) Count = Length();
-		return FString(StringBuffer[Length() - Count]);
-	}
+	FORCEINLINE FString Right(uint32 Count) const& noexcept { return FString(RightView(Count)); }
 	FORCEINLINE FString Right(uint32 Count) && noexcept
 	{
 		RightInline(Count);
@@ -819,14 +749,14 @@ public:
 		if( Count > Length() ) Count = Length();
 		RemoveAt(0, Length() - Count);
 	}
+	/** 
+		@return view of the right most given number of characters.
+	*/
+	FORCEINLINE FStringView RightView(uint32 Count) const noexcept { return FStringView(*this).Right(Count); }
 	/** 
 		@return the string to the right of the specified location, counting forward from the left (from the beginning of the word). 
 	*/
-	FORCEINLINE FString RightChop(uint32 Count) const& noexcept
-	{
-		if( Count > Length() ) Count = Length();
-		return FString(StringBuffer[Count]);
-	}
+	FORCEINLINE FString RightChop(uint32 Count) const& noexcept { return FString(RightChopView(Count)); }
 	FORCEINLINE FString RightChop(uint32 Count) && noexcept
 	{
 		RightChopInline(Count);
@@ -840,23 +770,15 @@ public:
 		if( Count > Length() ) Count = Length();
 		RemoveAt(0, Count);
 	}
+	/** 
+		@return view of the string to the right of the specified location, counting forward from the left (from the beginning of the word).
+	*/
+	FORCEINLINE FStringView RightChopView(uint32 Count) const noexcept { return FStringView(*this).RightChop(Count); }
 
 	/** 
 		@return the substring from Start position for Count characters.
 	*/
-	FORCEINLINE FString Mid(uint32 Start, int32 Count = MAX_int32) const& noexcept
-	{
-		FString Result;
-		if( Count >= 0 )
-		{
-			const int32 RequestedStart = Start;
-			if( Start > Length() ) Start = Length();
-			const int32 End = (int32)FMath::Clamp(static_cast<int64>(Count) + static_cast<int64>(RequestedStart), static_cast<int64>(Start), static_cast<int64>(Length()));
-			Result = FString(StringBuffer.GetAtByPointer(Start), End - Start);
-		}
-
-		return Result;
-	}
+	FORCEINLINE FString Mid(uint32 Start, int32 Count = MAX_int32) const& noexcept { return FString(MidView(Start, Count)); }
 	FORCEINLINE FString Mid(uint32 Start, int32 Count = MAX_int32) && noexcept
 	{
 		MidInline(Start, Count);
@@ -870,6 +792,14 @@ public:
 		LeftInline((int32)FMath::Min(static_cast<int64>(Count) + static_cast<int64>(Start), static_cast<int64>(MAX_int32)));
 		RightChopInline(Start);
 	}
+	/** 
+		@return view of the substring from Start position for Count characters.
+	*/
+	FORCEINLINE FStringView MidView(uint32 Start, int32 Count = MAX_int32) const noexcept
+	{
+		if( Count < 0 ) return FStringView();
+		return FStringView(*this).Mid(Start, static_cast<uint32>(Count));
+	}
 	/** 
 		Alias for Mid.
 		@return the substring from Start position for Count characters.
@@ -938,20 +868,20 @@ public:
 public:
 
 	/** 
-		Converts an ANSI string to a string.
+		Converts an ANSI string to a string. Every byte is taken as Latin-1 code point.
 	*/
 	static FORCEINLINE FString FromAnsi(const ANSICHAR* S) noexcept
 	{
-		FString Ret(FPlatformString::Strlen(S));
+		const uint32 Len = FPlatformString::Strlen(S);
+		FString Ret(Len);
 
-		TCHAR* p = Ret.begin();
-		TCHAR* pEnd = Ret.end();
-
-		while( p != pEnd )
+		if constexpr( sizeof(TCHAR) == sizeof(ANSICHAR) )
 		{
-			*p = *S;
-			++p;
-			++S;
+			FMemory::MemCpy(Ret.GetBuffer(), S, sizeof(TCHAR) * Len);
+		}
+		else
+		{
+			FStringConversion::Latin1ToWide(S, Len, reinterpret_cast<WIDECHAR*>(Ret.GetBuffer()));
 		}
 
 		return Ret;
@@ -961,20 +891,65 @@ public:
 	*/
 	static FORCEINLINE FString FromWide(const WIDECHAR* S) noexcept
 	{
-		FString Ret(FPlatformString::Strlen(S));
-
-		TCHAR* p = Ret.begin();
-		TCHAR* pEnd = Ret.end();
+		const uint32 Len = FPlatformString::Strlen(S);
+		FString Ret(Len);
 
-		while( p != pEnd )
+		if constexpr( sizeof(TCHAR) == sizeof(WIDECHAR) )
 		{
-			*p = *S;
-			++p;
-			++S;
+			FMemory::MemCpy(Ret.GetBuffer(), S, sizeof(TCHAR) * Len);
+		}
+		else
+		{
+			FStringConversion::WideToLatin1(S, Len, reinterpret_cast<ANSICHAR*>(Ret.GetBuffer()));
 		}
 
 		return Ret;
 	}
+	/**
+		Decodes UTF-8 string. Malformed sequences become U+FFFD.
+		Output length is counted first, so the string is allocated once.
+	*/
+	static FORCEINLINE FString FromUtf8(const ANSICHAR* S, uint32 Len) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == sizeof(ANSICHAR) )
+		{
+			FString Ret(Len);
+			FMemory::MemCpy(Ret.GetBuffer(), S, sizeof(TCHAR) * Len);
+			return Ret;
+		}
+		else
+		{
+			FString Ret(FStringConversion::GetUtf8ToWideLength(S, Len));
+			FStringConversion::Utf8ToWide(S, Len, reinterpret_cast<WIDECHAR*>(Ret.GetBuffer()));
+			return Ret;
+		}
+	}
+	static FORCEINLINE FString FromUtf8(const ANSICHAR* S) noexcept { return FromUtf8(S, FPlatformString::Strlen(S)); }
+
+	/**
+		Encodes string to UTF-8. Unpaired surrogates become U+FFFD.
+
+		@return null terminated bytes, the terminator is included in Num().
+	*/
+	FORCEINLINE TArray<ANSICHAR> ToUtf8() const noexcept
+	{
+		TArray<ANSICHAR> Result;
+		if constexpr( sizeof(TCHAR) == sizeof(ANSICHAR) )
+		{
+			Result.Reserve(Length() + 1);
+			Result.Append(reinterpret_cast<const ANSICHAR*>(GetStr()), Length());
+		}
+		else
+		{
+			const WIDECHAR* const Src = reinterpret_cast<const WIDECHAR*>(GetStr());
+			const uint32 NumBytes = FStringConversion::GetWideToUtf8Length(Src, Length());
+			Result.Reserve(NumBytes + 1);
+			Result.AddUninitialized(NumBytes);
+			FStringConversion::WideToUtf8(Src, Length(), Result.GetData());
+		}
+		Result.PushBack('\0');
+		return Result;
+	}
 
 	/**
 		Takes the number passed in and formats the string in comma format(12345 becomes "12,345").
@@ -991,8 +966,24 @@ public:
 	}
 
 	/**
-		Converts a float string with the trailing zeros stripped.
-		For example - 1.234 will be "1.234" rather than "1.234000".
+		Format arguments by compile time checked format string.
+		Arguments are written directly into stack string builder, so the result is the only allocation.
+		FString::Format(FORMAT_TEXT("Score: {}, time: {:.2}"), Score, Time);
+
+		@see FORMAT_TEXT, TStringBuilder::AppendFormat.
+	*/
+	template<typename ProviderType, typename... ArgTypes>
+	static FORCEINLINE FString Format(TFormatString<ProviderType> FormatString, const ArgTypes&... Args) noexcept
+	{
+		FStringBuilder Builder;
+		Builder.AppendFormat(FormatString, Args...);
+		return FString(Builder.ToView());
+	}
+
+	/**
+		Converts a float to the shortest string that parses back to the same value.
+		For example - 1.234 will be "1.234" rather than "1.234000", 0.1f will be "0.1" rather than "0.100000001".
+		Magnitudes out of [1e-4, 1e15) are written in scientific notation without padding, e.g "1e+20".
 	 
 		@param InFloat - The float to sanitize.
 		@param InMinFractionalDigits - The minimum number of fractional digits the number should have (will be padded with zero).
@@ -1000,6 +991,15 @@ public:
 		@return sanitized string version of float.
 	*/
 	static FString SanitizeFloat(double InFloat, const int32 InMinFractionalDigits = 1) noexcept;
+	static FString SanitizeFloat(float InFloat, const int32 InMinFractionalDigits = 1) noexcept;
+	/**
+		Integers and other arithmetic types are sanitized as double, e.g SanitizeFloat(5) is "5.0".
+	*/
+	template<typename T, typename = typename TEnableIf<TIsArithmetic<T>::Value>::Type>
+	static FORCEINLINE FString SanitizeFloat(T InValue, const int32 InMinFractionalDigits = 1) noexcept
+	{
+		return SanitizeFloat(static_cast<double>(InValue), InMinFractionalDigits);
+	}
 
 	/**
 		Convert an array of bytes to a TCHAR.
@@ -1066,41 +1066,65 @@ public:
 	{
 		if( Find == nullptr || Str == nullptr ) return nullptr;
 
-		// get upper-case first letter of the find string (to reduce the number of full strnicmps)
-		const TCHAR FindInitial = TChar<TCHAR>::ToUpper(*Find);
-		// get length of find string, and increment past first letter
-		const int32 Length = FPlatformString::Strlen(++Find) - 1;
-		// get the first letter of the search string, and increment past it
-		TCHAR StrChar = *Str++;
-		while( StrChar )
+		const FStringView StrView(Str);
+		const int32 Index = StrView.Find(Find, ESearchCase::IgnoreCase);
+		return Index != INDEX_NONE ? Str + Index : nullptr;
+	}
+
+public:
+
+	/**
+		Parse number from the beginning of Buffer skipping leading whitespace.
+		OutValue is zero if Buffer does not start with number or number does not fit the type.
+	*/
+	static FORCEINLINE void LexFromString(int8& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(int16& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(int32& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(int64& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(uint8& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(uint16& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(uint32& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	/**
+		Also accepts hexadecimal number with "0x" prefix.
+	*/
+	static FORCEINLINE void LexFromString(uint64& OutValue, const TCHAR* Buffer) noexcept
+	{
+		const FStringView Text = FStringView(Buffer).TrimLeft();
+		if( Text.Len() > 2 && Text[0] == '0' && (Text[1] == 'x' || Text[1] == 'X') )
 		{
-			// make sure it's upper-case
-			StrChar = TChar<TCHAR>::ToUpper(StrChar);
-			// if it matches the first letter of the find string, do a case-insensitive string compare for the length of the find string
-			if( StrChar == FindInitial && !FPlatformString::Strnicmp(Str, Find, Length) )
-			{
-				// if we found the string, then return a pointer to the beginning of it in the search string
-				return Str - 1;
-			}
-			StrChar = *Str++;
+			OutValue = 0;
+			FNumberConversion::ParseInt(Text.begin() + 2, Text.end(), OutValue, 16);
+			return;
 		}
+		LexNumberFromString(OutValue, Buffer);
+	}
+	static FORCEINLINE void LexFromString(float& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(double& OutValue, const TCHAR* Buffer) noexcept { LexNumberFromString(OutValue, Buffer); }
+	static FORCEINLINE void LexFromString(FString& OutValue, const TCHAR* Buffer) noexcept { OutValue = Buffer; }
+
+	/**
+		Parse whole Buffer as number, surrounding whitespace is allowed.
 
-		return nullptr;
+		@return false and keeps OutValue if Buffer has other chars or number does not fit the type.
+	*/
+	template<typename T>
+	static FORCEINLINE bool LexTryParseString(T& OutValue, const TCHAR* Buffer) noexcept
+	{
+		const FStringView Text = FStringView(Buffer).Trim();
+		return FNumberConversion::TryParse(Text.begin(), Text.end(), OutValue);
 	}
 
-public:
 
-	static FORCEINLINE void LexFromString(int8& OutValue, const TCHAR* Buffer) noexcept { OutValue = (int8)FPlatformString::Atoi(Buffer); }
-	static FORCEINLINE void LexFromString(int16& OutValue, const TCHAR* Buffer) noexcept { OutValue = (int16)FPlatformString::Atoi(Buffer); }
-	static FORCEINLINE void LexFromString(int32& OutValue, const TCHAR* Buffer) noexcept { OutValue = (int32)FPlatformString::Atoi(Buffer); }
-	static FORCEINLINE void LexFromString(int64& OutValue, const TCHAR* Buffer) noexcept { OutValue = FPlatformString::Atoi64(Buffer); }
-	static FORCEINLINE void LexFromString(uint8& OutValue, const TCHAR* Buffer) noexcept { OutValue = (uint8)FPlatformString::Atoi(Buffer); }
-	static FORCEINLINE void LexFromString(uint16& OutValue, const TCHAR* Buffer) noexcept { OutValue = (uint16)FPlatformString::Atoi(Buffer); }
-	static FORCEINLINE void LexFromString(uint32& OutValue, const TCHAR* Buffer) noexcept { OutValue = (uint32)FPlatformString::Atoi64(Buffer); } //64 because this unsigned and so Atoi might overflow
-	static FORCEINLINE void LexFromString(uint64& OutValue, const TCHAR* Buffer) noexcept { OutValue = FPlatformString::Strtoui64(Buffer, nullptr, 0); }
-	static FORCEINLINE void LexFromString(float& OutValue, const TCHAR* Buffer) noexcept { OutValue = FPlatformString::Atof(Buffer); }
-	static FORCEINLINE void LexFromString(double& OutValue, const TCHAR* Buffer) noexcept { OutValue = FPlatformString::Atod(Buffer); }
-	static FORCEINLINE void LexFromString(FString& OutValue, const TCHAR* Buffer) noexcept { OutValue = Buffer; }
+
+private:
+
+	template<typename T>
+	static FORCEINLINE void LexNumberFromString(T& OutValue, const TCHAR* Buffer) noexcept
+	{
+		const FStringView Text = FStringView(Buffer).TrimLeft();
+		OutValue = T();
+		FNumberConversion::Parse(Text.begin(), Text.end(), OutValue);
+	}
 
 
 
@@ -1112,25 +1136,21 @@ private:
 	FStringBuffer StringBuffer;
 };
 
-
-
-namespace FString_Private
-{
 /**
-	Table of 65537^x where x in [0, 1023]
+	String buffer addresses its inline storage by offset and never stores pointer to itself, so it can be moved with memcpy.
 */
-extern const uint64 StringP[1024];
-} // namespace FString_Private
-
-FORCEINLINE uint64 GetTypeHash(const FString& S) noexcept
+template<>
+struct TIsTriviallyRelocatable<FString>
 {
-	check(S.Length() <= 1024);
-
-	uint64 Result = 0;
-	for( uint32 i = 0; i < S.Length(); ++i )
+	enum
 	{
-		Result += static_cast<uint64>(S[i]) * FString_Private::StringP[i];
-	}
+		Value = true
+	};
+};
+
 
-	return Result;
-}
\ No newline at end of file
+
+FORCEINLINE uint64 GetTypeHash(const FString& S) noexcept
+{
+	return GetTypeHash(FStringView(S));
+}
@@ -3,6 +3,7 @@
 
 #include "GenericPlatform.h"
 #include "Float32.h"
+#include "TypeHash.h"
 #include "EngineMath.h"
 
 
@@ -100,5 +101,5 @@ public:
 
 FORCEINLINE uint64 GetTypeHash(FFloat16 Value) noexcept
 {
-	return Value.Encoded;
+	return HashMix64(Value.Encoded);
 }
\ No newline at end of file
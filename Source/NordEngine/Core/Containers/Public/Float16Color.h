@@ -63,5 +63,5 @@ public:
 
 FORCEINLINE uint64 GetTypeHash(const FFloat16Color& Color)
 {
-	return *(uint64*)&Color;
+	return HashMix64(*(uint64*)&Color);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "GenericPlatform.h"
+#include "TypeHash.h"
 
 
 
@@ -38,5 +39,5 @@ public:
 
 FORCEINLINE uint64 GetTypeHash(FFloat32 Value) noexcept
 {
-	return *(uint32*)&(Value.FloatValue);
+	return HashMix64(*(uint32*)&(Value.FloatValue));
 }
\ No newline at end of file
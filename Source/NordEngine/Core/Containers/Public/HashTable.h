@@ -0,0 +1,524 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "EngineMath.h"
+#include "MemoryOps.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "MoveSemantic.h"
+#include "TypeHash.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+
+// We require SSE2
+#include <emmintrin.h>
+#include <new>
+
+
+
+
+namespace HashTable_Private
+{
+/**
+	Control byte of the slot that holds no element.
+	Full slots store 7 bits of the element hash (H2), so the top bit alone tells empty from full.
+*/
+static constexpr uint8 EmptyControl = 0x80;
+/**
+	Count of control bytes probed by one SSE2 compare.
+*/
+static constexpr uint32 GroupWidth = 16;
+/**
+	Smallest allocated capacity. Must be power of two and not less than GroupWidth.
+*/
+static constexpr uint32 MinCapacity = 16;
+
+/**
+	@return home slot part of the hash.
+*/
+FORCEINLINE uint32 GetH1(uint64 Hash) noexcept
+{
+	return static_cast<uint32>(Hash >> 7);
+}
+/**
+	@return control byte part of the hash.
+*/
+FORCEINLINE uint8 GetH2(uint64 Hash) noexcept
+{
+	return static_cast<uint8>(Hash & 0x7F);
+}
+
+/**
+	16 control bytes loaded into one SSE register.
+	Every Match* function returns bit mask where bit i corresponds to the i-th control byte of the group.
+*/
+struct FControlGroup
+{
+public:
+
+	FORCEINLINE explicit FControlGroup(const uint8* Control) noexcept : Group(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Control))) { }
+
+
+public:
+
+	FORCEINLINE uint32 Match(uint8 H2) const noexcept { return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Group, _mm_set1_epi8(static_cast<char>(H2))))); }
+	FORCEINLINE uint32 MatchEmpty() const noexcept { return static_cast<uint32>(_mm_movemask_epi8(Group)); }
+	FORCEINLINE uint32 MatchFull() const noexcept { return ~MatchEmpty() & 0xFFFF; }
+
+
+
+private:
+
+	__m128i Group;
+};
+} // namespace HashTable_Private
+
+
+
+
+
+/**
+	Iterator over full slots of THashTable.
+*/
+template<typename ElementType>
+struct THashTableIterator
+{
+public:
+
+	FORCEINLINE THashTableIterator(const uint8* InControl, ElementType* InSlots, uint32 InIndex, uint32 InCapacity) noexcept :
+		Control(InControl), Slots(InSlots), Index(InIndex), Capacity(InCapacity)
+	{
+		if( Index < Capacity && Control[Index] == HashTable_Private::EmptyControl )
+		{
+			++(*this);
+		}
+	}
+
+
+public:
+
+	FORCEINLINE ElementType& operator*() const noexcept { return Slots[Index]; }
+	FORCEINLINE ElementType* operator->() const noexcept { return Slots + Index; }
+
+	FORCEINLINE THashTableIterator& operator++() noexcept
+	{
+		++Index;
+		while( Index < Capacity )
+		{
+			// Tail of the last group reads the cloned control bytes, mask them out
+			uint32 FullMask = HashTable_Private::FControlGroup(Control + Index).MatchFull();
+			if( Capacity - Index < HashTable_Private::GroupWidth )
+			{
+				FullMask &= (1u << (Capacity - Index)) - 1;
+			}
+
+			if( FullMask != 0 )
+			{
+				Index += FMath::CountTrailingZeros(FullMask);
+				return *this;
+			}
+			Index += HashTable_Private::GroupWidth;
+		}
+
+		Index = Capacity;
+		return *this;
+	}
+	FORCEINLINE THashTableIterator operator++(int) noexcept
+	{
+		THashTableIterator Tmp = *this;
+		++(*this);
+		return Tmp;
+	}
+
+public:
+
+	FORCEINLINE friend bool operator==(const THashTableIterator& A, const THashTableIterator& B) noexcept { return A.Index == B.Index && A.Slots == B.Slots; }
+	FORCEINLINE friend bool operator!=(const THashTableIterator& A, const THashTableIterator& B) noexcept { return A.Index != B.Index || A.Slots != B.Slots; }
+
+
+
+private:
+
+	const uint8* Control = nullptr;
+	ElementType* Slots = nullptr;
+	uint32 Index = 0;
+	uint32 Capacity = 0;
+};
+
+/**
+	Open-addressing hash table shared by TMap and TSet.
+
+	Control bytes and slots live in one allocation: [Capacity + GroupWidth control bytes][Capacity slots].
+	The first GroupWidth control bytes are cloned past the end, so a group can be loaded from any slot index without wrapping.
+	Probing is linear by groups of 16 control bytes compared with SSE2, candidates are confirmed with full key equality.
+	Since probing is linear, Remove shifts the following elements back instead of leaving tombstones.
+	GetTypeHash results are used as is, so they must be spread over all 64 bits, e.g finalized by HashMix64.
+
+	@param KeyFuncs - struct with KeyType typedef and static GetKey(const ElementType&) returning the element key.
+	@note Remove invalidates iterators.
+*/
+template<typename ElementType, typename KeyFuncs>
+struct THashTable
+{
+public:
+
+	using KeyType = typename KeyFuncs::KeyType;
+
+public:
+
+	THashTable() = default;
+	FORCEINLINE THashTable(const THashTable& Other) { CopyFrom(Other); }
+	FORCEINLINE THashTable(THashTable&& Other) noexcept : Control(Other.Control), Slots(Other.Slots), Capacity(Other.Capacity), Count(Other.Count)
+	{
+		Other.Control = nullptr;
+		Other.Slots = nullptr;
+		Other.Capacity = 0;
+		Other.Count = 0;
+	}
+	~THashTable() { Reset(); }
+
+
+public:
+
+	FORCEINLINE THashTable& operator=(const THashTable& Other)
+	{
+		if( &Other == this ) return *this;
+
+		Reset();
+		CopyFrom(Other);
+
+		return *this;
+	}
+	FORCEINLINE THashTable& operator=(THashTable&& Other) noexcept
+	{
+		if( &Other == this ) return *this;
+
+		Reset();
+
+		Control = Other.Control;
+		Slots = Other.Slots;
+		Capacity = Other.Capacity;
+		Count = Other.Count;
+
+		Other.Control = nullptr;
+		Other.Slots = nullptr;
+		Other.Capacity = 0;
+		Other.Count = 0;
+
+		return *this;
+	}
+
+public:
+
+	FORCEINLINE THashTableIterator<ElementType> begin() noexcept { return THashTableIterator<ElementType>(Control, Slots, 0, Capacity); }
+	FORCEINLINE THashTableIterator<const ElementType> begin() const noexcept { return THashTableIterator<const ElementType>(Control, Slots, 0, Capacity); }
+	FORCEINLINE THashTableIterator<ElementType> end() noexcept { return THashTableIterator<ElementType>(Control, Slots, Capacity, Capacity); }
+	FORCEINLINE THashTableIterator<const ElementType> end() const noexcept { return THashTableIterator<const ElementType>(Control, Slots, Capacity, Capacity); }
+
+public:
+
+	FORCEINLINE bool IsEmpty() const noexcept { return Count == 0; }
+	FORCEINLINE uint32 Num() const noexcept { return Count; }
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Capacity; }
+
+public:
+
+	/**
+		@return element with Key or nullptr.
+	*/
+	FORCEINLINE ElementType* Find(const KeyType& Key) noexcept
+	{
+		const uint32 Index = FindIndex(Key);
+		return Index == static_cast<uint32>(INDEX_NONE) ? nullptr : Slots + Index;
+	}
+	FORCEINLINE const ElementType* Find(const KeyType& Key) const noexcept
+	{
+		const uint32 Index = FindIndex(Key);
+		return Index == static_cast<uint32>(INDEX_NONE) ? nullptr : Slots + Index;
+	}
+
+	/**
+		Find slot of Key or construct new element from Args in the free slot.
+
+		@param bAlreadyExists - set to true when Key was in table and nothing was constructed.
+		@return element with Key.
+	*/
+	template<typename... ArgsType>
+	ElementType* FindOrEmplace(const KeyType& Key, bool& bAlreadyExists, ArgsType&&... Args)
+	{
+		const uint64 Hash = GetTypeHash(Key);
+
+		if( Count != 0 )
+		{
+			const uint32 Index = FindIndexHash(Key, Hash);
+			if( Index != static_cast<uint32>(INDEX_NONE) )
+			{
+				bAlreadyExists = true;
+				return Slots + Index;
+			}
+		}
+		bAlreadyExists = false;
+
+		if( Count + 1 > GetMaxCount(Capacity) )
+		{
+			Rehash(Capacity == 0 ? HashTable_Private::MinCapacity : Capacity * 2);
+		}
+
+		const uint32 Index = FindFreeIndex(Hash);
+		SetControl(Index, HashTable_Private::GetH2(Hash));
+		new(Slots + Index) ElementType(Forward<ArgsType>(Args)...);
+		++Count;
+
+		return Slots + Index;
+	}
+
+	/**
+		Remove element with Key.
+
+		@return true if element was removed.
+	*/
+	bool Remove(const KeyType& Key)
+	{
+		const uint32 Index = FindIndex(Key);
+		if( Index == static_cast<uint32>(INDEX_NONE) ) return false;
+
+		DestructItem(Slots + Index);
+		--Count;
+
+		const uint32 Mask = Capacity - 1;
+		uint32 Hole = Index;
+		uint32 Next = (Hole + 1) & Mask;
+		while( Control[Next] != HashTable_Private::EmptyControl )
+		{
+			// Element can fill the hole only if the hole lies between its home slot and its current slot
+			const uint32 Home = HashTable_Private::GetH1(GetTypeHash(KeyFuncs::GetKey(Slots[Next]))) & Mask;
+			if( ((Next - Home) & Mask) >= ((Next - Hole) & Mask) )
+			{
+				RelocateConstructItems<ElementType>(Slots + Hole, Slots + Next, 1);
+				SetControl(Hole, Control[Next]);
+				Hole = Next;
+			}
+			Next = (Next + 1) & Mask;
+		}
+		SetControl(Hole, HashTable_Private::EmptyControl);
+
+		return true;
+	}
+
+	/**
+		Grow table to hold at least Number elements without rehashing.
+	*/
+	void Reserve(uint32 Number)
+	{
+		uint32 NewCapacity = FMath::RoundUpToPowerOfTwo(Number + Number / 7);
+		if( NewCapacity < HashTable_Private::MinCapacity )
+		{
+			NewCapacity = HashTable_Private::MinCapacity;
+		}
+		if( NewCapacity > Capacity )
+		{
+			Rehash(NewCapacity);
+		}
+	}
+
+	/**
+		Destroy all elements and keep memory.
+	*/
+	void Clear()
+	{
+		if( Count == 0 ) return;
+
+		DestroyElements();
+		FMemory::MemSet(Control, HashTable_Private::EmptyControl, Capacity + HashTable_Private::GroupWidth);
+		Count = 0;
+	}
+	/**
+		Destroy all elements and free memory.
+	*/
+	void Reset()
+	{
+		DestroyElements();
+		if( Control )
+		{
+			FMemory::Free(Control);
+		}
+
+		Control = nullptr;
+		Slots = nullptr;
+		Capacity = 0;
+		Count = 0;
+	}
+
+private:
+
+	/**
+		Keep at least 1/8 of slots empty so probing always ends.
+	*/
+	static FORCEINLINE uint32 GetMaxCount(uint32 InCapacity) noexcept { return InCapacity - InCapacity / 8; }
+
+	static FORCEINLINE SIZE_T GetSlotsOffset(uint32 InCapacity) noexcept
+	{
+		const SIZE_T ControlSize = InCapacity + HashTable_Private::GroupWidth;
+		return (ControlSize + alignof(ElementType) - 1) & ~(static_cast<SIZE_T>(alignof(ElementType)) - 1);
+	}
+
+	FORCEINLINE void SetControl(uint32 Index, uint8 Value) noexcept
+	{
+		Control[Index] = Value;
+		if( Index < HashTable_Private::GroupWidth )
+		{
+			Control[Capacity + Index] = Value;
+		}
+	}
+
+	FORCEINLINE uint32 FindIndex(const KeyType& Key) const noexcept
+	{
+		if( Count == 0 ) return static_cast<uint32>(INDEX_NONE);
+		return FindIndexHash(Key, GetTypeHash(Key));
+	}
+
+	uint32 FindIndexHash(const KeyType& Key, uint64 Hash) const noexcept
+	{
+		const uint32 Mask = Capacity - 1;
+		const uint8 H2 = HashTable_Private::GetH2(Hash);
+
+		uint32 Position = HashTable_Private::GetH1(Hash) & Mask;
+		while( true )
+		{
+			const HashTable_Private::FControlGroup Group(Control + Position);
+
+			uint32 MatchMask = Group.Match(H2);
+			while( MatchMask != 0 )
+			{
+				const uint32 Index = (Position + FMath::CountTrailingZeros(MatchMask)) & Mask;
+				if( LIKELY(KeyFuncs::GetKey(Slots[Index]) == Key) )
+				{
+					return Index;
+				}
+				MatchMask &= MatchMask - 1;
+			}
+
+			if( Group.MatchEmpty() != 0 )
+			{
+				return static_cast<uint32>(INDEX_NONE);
+			}
+			Position = (Position + HashTable_Private::GroupWidth) & Mask;
+		}
+	}
+
+	uint32 FindFreeIndex(uint64 Hash) const noexcept
+	{
+		const uint32 Mask = Capacity - 1;
+
+		uint32 Position = HashTable_Private::GetH1(Hash) & Mask;
+		while( true )
+		{
+			const uint32 EmptyMask = HashTable_Private::FControlGroup(Control + Position).MatchEmpty();
+			if( EmptyMask != 0 )
+			{
+				return (Position + FMath::CountTrailingZeros(EmptyMask)) & Mask;
+			}
+			Position = (Position + HashTable_Private::GroupWidth) & Mask;
+		}
+	}
+
+	void Allocate(uint32 NewCapacity)
+	{
+		check(FMath::IsPowerOfTwo(NewCapacity) && NewCapacity >= HashTable_Private::MinCapacity);
+
+		const SIZE_T SlotsOffset = GetSlotsOffset(NewCapacity);
+		uint8* Memory = static_cast<uint8*>(FMemory::Malloc(SlotsOffset + sizeof(ElementType) * NewCapacity));
+		FMemory::MemSet(Memory, HashTable_Private::EmptyControl, NewCapacity + HashTable_Private::GroupWidth);
+
+		Control = Memory;
+		Slots = reinterpret_cast<ElementType*>(Memory + SlotsOffset);
+		Capacity = NewCapacity;
+	}
+
+	void Rehash(uint32 NewCapacity)
+	{
+		uint8* OldControl = Control;
+		ElementType* OldSlots = Slots;
+		const uint32 OldCapacity = Capacity;
+
+		Allocate(NewCapacity);
+
+		for( uint32 i = 0; i < OldCapacity; ++i )
+		{
+			if( OldControl[i] == HashTable_Private::EmptyControl ) continue;
+
+			const uint64 Hash = GetTypeHash(KeyFuncs::GetKey(OldSlots[i]));
+			const uint32 Index = FindFreeIndex(Hash);
+			SetControl(Index, HashTable_Private::GetH2(Hash));
+			RelocateConstructItems<ElementType>(Slots + Index, OldSlots + i, 1);
+		}
+
+		if( OldControl )
+		{
+			FMemory::Free(OldControl);
+		}
+	}
+
+	void CopyFrom(const THashTable& Other)
+	{
+		if( Other.Count == 0 ) return;
+
+		Allocate(Other.Capacity);
+		FMemory::MemCpy(Control, Other.Control, Capacity + HashTable_Private::GroupWidth);
+		for( uint32 i = 0; i < Capacity; ++i )
+		{
+			if( Control[i] != HashTable_Private::EmptyControl )
+			{
+				ConstructItems<ElementType>(Slots + i, Other.Slots + i, 1);
+			}
+		}
+		Count = Other.Count;
+	}
+
+	void DestroyElements()
+	{
+		if( Count == 0 ) return;
+
+		for( uint32 i = 0; i < Capacity; ++i )
+		{
+			if( Control[i] != HashTable_Private::EmptyControl )
+			{
+				DestructItem(Slots + i);
+			}
+		}
+	}
+
+
+
+private:
+
+	/**
+		Control bytes, also start of the allocation.
+	*/
+	uint8* Control = nullptr;
+	/**
+		Element slots, points inside the allocation.
+	*/
+	ElementType* Slots = nullptr;
+	/**
+		Count of slots. Zero or power of two.
+	*/
+	uint32 Capacity = 0;
+	/**
+		Count of elements.
+	*/
+	uint32 Count = 0;
+};
+
+/**
+	Table owns only pointers into one heap block.
+*/
+template<typename ElementType, typename KeyFuncs>
+struct TIsTriviallyRelocatable<THashTable<ElementType, KeyFuncs>>
+{
+	enum
+	{
+		Value = true
+	};
+};
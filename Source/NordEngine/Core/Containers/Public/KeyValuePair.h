@@ -4,6 +4,9 @@
 #include "GenericPlatform.h"
 #include "MoveSemantic.h"
 
+#include "TypeTraits/AndOrNot.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+
 
 
 
@@ -17,9 +20,7 @@ public:
 
 	TKeyValuePair() = default;
 	FORCEINLINE TKeyValuePair(KeyType InKey, ValueType InValue) noexcept : Key(MoveTemp(InKey)), Value(MoveTemp(InValue)) { }
-	FORCEINLINE TKeyValuePair(KeyType&& InKey, ValueType&& InValue) noexcept : Key(MoveTemp(InKey)), Value(MoveTemp(InValue)) { }
-	FORCEINLINE TKeyValuePair(KeyType InKey) noexcept : Key(MoveTemp(InKey)) { }
-	FORCEINLINE TKeyValuePair(KeyType&& InKey) noexcept : Key(MoveTemp(InKey)) { }
+	FORCEINLINE TKeyValuePair(KeyType InKey) noexcept : Key(MoveTemp(InKey)), Value() { }
 	~TKeyValuePair() = default;
 
 
@@ -36,4 +37,13 @@ public:
 
 	KeyType Key;
 	ValueType Value;
-};
\ No newline at end of file
+};
+
+template<typename KeyType, typename ValueType>
+struct TIsTriviallyRelocatable<TKeyValuePair<KeyType, ValueType>>
+{
+	enum
+	{
+		Value = TAnd<TIsTriviallyRelocatable<KeyType>, TIsTriviallyRelocatable<ValueType>>::Value
+	};
+};
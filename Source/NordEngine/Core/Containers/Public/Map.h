@@ -2,344 +2,68 @@
 #pragma once
 
 #include "GenericPlatform.h"
-#include "EngineMemory.h"
-#include "MemoryOps.h"
 #include "AssertionMacros.h"
 #include "InitializerList.h"
 #include "MoveSemantic.h"
 #include "KeyValuePair.h"
 #include "TypeHash.h"
+#include "HashTable.h"
 
 
 
 
 template<typename K, typename V>
-struct TMapEntry
+struct TMapKeyFuncs
 {
-	TKeyValuePair<K, V> KeyValue;
-	uint64 Hash;
-};
-
-template<typename K, typename V>
-struct ENGINE_API TMapBucket
-{
-public:
-
-	TMapBucket() = default;
-	~TMapBucket() = default;
-
-
-public:
-
-	TMapEntry<K, V>* begin() noexcept { return Data; }
-	const TMapEntry<K, V>* begin() const noexcept { return Data; }
-	TMapEntry<K, V>* end() noexcept { return Data + Size; }
-	const TMapEntry<K, V>* end() const noexcept { return Data + Size; }
-
-public:
-
-	FORCEINLINE bool IsValid() const noexcept { return Data != nullptr; }
-	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
-	FORCEINLINE uint32 GetSize() const noexcept { return Size; }
-	FORCEINLINE const TMapEntry<K, V>* GetData() const noexcept { return Data; }
-	FORCEINLINE TMapEntry<K, V>* GetData() noexcept { return Data; }
-
-public:
-
-	FORCEINLINE bool Insert(K&& Key, V&& Value, uint64 Hash)
-	{
-		TMapEntry<K, V>* TergetEntry = begin();
-		TMapEntry<K, V>* EntryEnd = end();
-		while( TergetEntry != EntryEnd )
-		{
-			if( TergetEntry->Hash == Hash ) break;
-			++TergetEntry;
-		}
-
-		if( TergetEntry == EntryEnd )
-		{
-			++Size;
-			Reserve(Size);
-
-			TergetEntry = end() - 1;
-
-			TergetEntry->KeyValue.Key = MoveTemp(Key);
-			TergetEntry->KeyValue.Value = MoveTemp(Value);
-			TergetEntry->Hash = Hash;
-
-			return true;
-		}
-		else
-		{
-			TergetEntry->KeyValue.Key = MoveTemp(Key);
-			TergetEntry->KeyValue.Value = MoveTemp(Value);
-			TergetEntry->Hash = Hash;
-
-			return false;
-		}
-	}
-
-	FORCEINLINE TMapEntry<K, V>* Find(uint64 Hash) noexcept
-	{
-		const TMapEntry<K, V>* Entry = begin();
-		const TMapEntry<K, V>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) return Entry;
-			++Entry;
-		}
-
-		return nullptr;
-	}
-	FORCEINLINE const TMapEntry<K, V>* Find(uint64 Hash) const noexcept
-	{
-		TMapEntry<K, V>* Entry = begin();
-		TMapEntry<K, V>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) return Entry;
-			++Entry;
-		}
-
-		return nullptr;
-	}
-
-	FORCEINLINE bool Contains(uint64 Hash) const noexcept { return Find(Hash) != nullptr; }
-
-	FORCEINLINE void Remove(uint64 Hash)
-	{
-		TMapEntry<K, V>* Entry = begin();
-		TMapEntry<K, V>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) break;
-			++Entry;
-		}
-		if( Entry == EntryEnd ) return;
-
-		DestructItem(Entry->KeyValue);
-
-		--Size;
-		FMemory::MemCpy(Entry, Entry + 1, sizeof(TMapEntry<K, V>) * (end() - Entry));
-	}
-
-	FORCEINLINE void Clear()
-	{
-		Size = 0;
-		Capacity = 0;
-		if( Data )
-		{
-			FMemory::Free(Data);
-			Data = nullptr;
-		}
-	}
-
-	FORCEINLINE void ClearWithDestructors()
-	{
-		DestructItems(Data, Size);
-		Clear();
-	}
-
-	FORCEINLINE void Reserve(uint32 NewCapacity)
-	{
-		if( NewCapacity <= Capacity ) return;
+	using KeyType = K;
 
-		Capacity = NewCapacity * 2;
-		if( Data )
-		{
-			Data = static_cast<TMapEntry<K, V>*>(FMemory::Realloc(Data, sizeof(TMapEntry<K, V>) * Capacity));
-		}
-		else
-		{
-			Data = static_cast<TMapEntry<K, V>*>(FMemory::Malloc(sizeof(TMapEntry<K, V>) * Capacity));
-		}
-	}
-
-
-
-private:
-
-	uint32 Size = 0;
-	uint32 Capacity = 0;
-	TMapEntry<K, V>* Data = nullptr;
+	static FORCEINLINE const K& GetKey(const TKeyValuePair<K, V>& Pair) noexcept { return Pair.Key; }
 };
 
-
 /**
 	Map Key-Value iterator.
 */
 template<typename K, typename V>
-struct TMapIterator
-{
-public:
-
-	FORCEINLINE TMapIterator(TMapBucket<K, V>* InFirstBucket, TMapBucket<K, V>* InLastBucket, TMapBucket<K, V>* InBucket, TMapEntry<K, V>* InEntry) noexcept :
-		FirstBucket(InFirstBucket), LastBucket(InLastBucket), CurrentBucket(InBucket), CurrentEntry(InEntry)
-	{
-	}
-
-
-public:
-
-	FORCEINLINE TKeyValuePair<K, V>& operator*() noexcept { return CurrentEntry->KeyValue; }
-	FORCEINLINE const TKeyValuePair<K, V>& operator*() const noexcept { return CurrentEntry->KeyValue; }
-
-	FORCEINLINE TMapIterator& operator++() noexcept
-	{
-		if( CurrentBucket->IsEmpty() )
-		{
-			while( CurrentBucket->IsEmpty() && CurrentBucket < LastBucket )
-			{
-				++CurrentBucket;
-			}
-			CurrentEntry = CurrentBucket->begin();
-		}
-		else
-		{
-			++CurrentEntry;
-			if( CurrentEntry >= CurrentBucket->end() )
-			{
-				++CurrentBucket;
-				while( CurrentBucket->IsEmpty() && CurrentBucket < LastBucket )
-				{
-					++CurrentBucket;
-				}
-				CurrentEntry = CurrentBucket->begin();
-			}
-		}
-
-		return *this;
-	}
-	FORCEINLINE TMapIterator operator++(int) noexcept
-	{
-		TMapIterator Tmp = *this;
-		++(*this);
-		return Tmp;
-	}
-	FORCEINLINE TMapIterator& operator--() noexcept
-	{
-		if( CurrentBucket->IsEmpty() )
-		{
-			while( CurrentBucket->IsEmpty() && CurrentBucket > FirstBucket )
-			{
-				--CurrentBucket;
-			}
-			CurrentEntry = CurrentBucket->end() - 1;
-		}
-		else
-		{
-			--CurrentEntry;
-			if( CurrentEntry < CurrentBucket->begin() )
-			{
-				--CurrentBucket;
-				while( CurrentBucket->IsEmpty() && CurrentBucket > FirstBucket )
-				{
-					--CurrentBucket;
-				}
-				CurrentEntry = CurrentBucket->end() - 1;
-			}
-		}
-
-		return *this;
-	}
-	FORCEINLINE TMapIterator operator--(int) noexcept
-	{
-		TMapIterator Tmp = *this;
-		--(*this);
-		return Tmp;
-	}
-
-public:
-
-	FORCEINLINE friend bool operator==(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket && A.CurrentEntry == B.CurrentEntry; }
-	FORCEINLINE friend bool operator!=(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket != B.CurrentBucket || A.CurrentEntry != B.CurrentEntry; }
-
-	FORCEINLINE friend bool operator<(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry < B.CurrentEntry : A.CurrentBucket < B.CurrentBucket; }
-	FORCEINLINE friend bool operator<=(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry <= B.CurrentEntry : A.CurrentBucket <= B.CurrentBucket; }
-
-	FORCEINLINE friend bool operator>(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry > B.CurrentEntry : A.CurrentBucket > B.CurrentBucket; }
-	FORCEINLINE friend bool operator>=(const TMapIterator& A, const TMapIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry >= B.CurrentEntry : A.CurrentBucket >= B.CurrentBucket; }
-
-
-
-private:
-
-	TMapBucket<K, V>* FirstBucket = nullptr;
-	TMapBucket<K, V>* LastBucket = nullptr;
-	TMapBucket<K, V>* CurrentBucket = nullptr;
-	TMapEntry<K, V>* CurrentEntry = nullptr;
-};
+using TMapIterator = THashTableIterator<TKeyValuePair<K, V>>;
+template<typename K, typename V>
+using TMapConstIterator = THashTableIterator<const TKeyValuePair<K, V>>;
 
 /**
 	Engine version of std::unordered_map.
-	It can be faster because it does not use exceptions and can be optimized for specific operations.
+	It can be faster because it does not use exceptions and keeps all entries in one flat allocation probed with SIMD.
+	Keys are compared with operator==, so colliding hashes never alias different keys.
 
-	@see GetTypeHash.
+	@see GetTypeHash, THashTable.
+	@note Remove invalidates iterators and references to other entries.
 */
 template<typename K, typename V>
 struct ENGINE_API TMap
 {
-private:
-
-	static const uint64 InitialSize = 17;
-
 public:
 
 	TMap() = default;
-	FORCEINLINE TMap(const TMap& Other) : Size(Other.Size), FillCount(Other.FillCount)
-	{
-		Data = static_cast<TMapBucket<K, V>*>(FMemory::Malloc(sizeof(TMapBucket<K, V>) * Size));
-
-		TMapBucket<K, V>* MyData = Data;
-		TMapBucket<K, V>* MyDataEnd = Data + Size;
-		TMapBucket<K, V>* OtherData = Other.Data;
-		while( MyData != MyDataEnd )
-		{
-			MyData->Reserve(OtherData->GetSize());
-			FMemory::MemCpy(MyData->GetData(), OtherData->GetData(), sizeof(TMapEntry<K, V>) * OtherData->GetSize());
-			++MyData;
-			++OtherData;
-		}
-	}
-	FORCEINLINE TMap(TMap&& Other) noexcept : Data(Other.Data), Size(Other.Size), FillCount(Other.FillCount)
-	{
-		Other.Data = nullptr;
-		Other.Size = 0;
-		Other.FillCount = 0;
-	}
+	TMap(const TMap& Other) = default;
+	TMap(TMap&& Other) noexcept = default;
 	FORCEINLINE TMap(TInitializerList<TKeyValuePair<K, V>> InitList)
 	{
-		Resize(InitialSize * (InitList.Size() / InitialSize + 1));
+		Table.Reserve(static_cast<uint32>(InitList.Size()));
 		for( const TKeyValuePair<K, V>& Pair : InitList )
 		{
 			Insert(Pair);
 		}
 	}
-	~TMap() { Reset(); }
+	~TMap() = default;
 
 
 public:
 
-	FORCEINLINE TMap& operator=(const TMap& Other) = delete;
-	FORCEINLINE TMap& operator=(TMap&& Other) noexcept
-	{
-		Reset();
-
-		this->Data = Other.Data;
-		this->Size = Other.Size;
-		this->FillCount = Other.FillCount;
-
-		Other.Data = nullptr;
-		Other.Size = 0;
-		Other.FillCount = 0;
-
-		return *this;
-	}
+	TMap& operator=(const TMap& Other) = default;
+	TMap& operator=(TMap&& Other) noexcept = default;
 	FORCEINLINE TMap& operator=(TInitializerList<TKeyValuePair<K, V>> InitList)
 	{
 		Clear();
 
-		Resize(InitialSize * (InitList.Size() / InitialSize + 1));
+		Table.Reserve(static_cast<uint32>(InitList.Size()));
 		for( const TKeyValuePair<K, V>& Pair : InitList )
 		{
 			Insert(Pair);
@@ -350,112 +74,40 @@ public:
 
 public:
 
+	/**
+		@return reference to value under Key. Value initializes value in place if Key is not in map.
+	*/
 	FORCEINLINE V& operator[](const K& Key)
 	{
-		const uint64 Hash = GetTypeHash(Key);
-
-		if( IsEmpty() )
-		{
-			InsertHash(Hash, V());
-			return FindValueRefHash(Hash);
-		}
-		else
-		{
-			TMapEntry<K, V>* Entry = Data[GetBucketIndex(Hash)].Find(Hash);
-			if( Entry == nullptr )
-			{
-				InsertHash(Hash, V());
-				return FindValueRefHash(Hash);
-			}
-			else
-			{
-				return Entry->KeyValue.Value;
-			}
-		}
+		bool bAlreadyExists;
+		return Table.FindOrEmplace(Key, bAlreadyExists, Key)->Value;
 	}
 
 public:
 
-	TMapIterator<K, V> begin() noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TMapIterator<K, V> Iter(Data, LastBucket, Data, Data->begin());
-			if( Data->IsEmpty() )
-			{
-				++Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TMapIterator<K, V>(nullptr, nullptr);
-		}
-	}
-	const TMapIterator<K, V> begin() const noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TMapIterator<K, V> Iter(Data, LastBucket, Data, Data->begin());
-			if( Data->IsEmpty() )
-			{
-				++Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TMapIterator<K, V>(nullptr, nullptr);
-		}
-	}
-	TMapIterator<K, V> end() noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TMapIterator<K, V> Iter(Data, LastBucket, LastBucket, LastBucket->end() - 1);
-			if( LastBucket->IsEmpty() )
-			{
-				--Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TMapIterator<K, V>(nullptr, nullptr);
-		}
-	}
-	const TMapIterator<K, V> end() const noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TMapIterator<K, V> Iter(Data, LastBucket, LastBucket, LastBucket->end() - 1);
-			if( LastBucket->IsEmpty() )
-			{
-				--Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TMapIterator<K, V>(nullptr, nullptr);
-		}
-	}
+	FORCEINLINE TMapIterator<K, V> begin() noexcept { return Table.begin(); }
+	FORCEINLINE TMapConstIterator<K, V> begin() const noexcept { return Table.begin(); }
+	FORCEINLINE TMapIterator<K, V> end() noexcept { return Table.end(); }
+	FORCEINLINE TMapConstIterator<K, V> end() const noexcept { return Table.end(); }
 
 public:
 
 	/**
 		Check that map is empty.
 	*/
-	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
+	FORCEINLINE bool IsEmpty() const noexcept { return Table.IsEmpty(); }
+	/**
+		@return count of map elements.
+	*/
+	FORCEINLINE uint32 GetSize() const noexcept { return Table.Num(); }
 	/**
-		@return count of map buckets.
-		@note Size is not equal to real elements count in map.
+		@return count of map elements.
 	*/
-	FORCEINLINE uint32 GetSize() const noexcept { return Size; }
+	FORCEINLINE uint32 Num() const noexcept { return Table.Num(); }
+	/**
+		@return count of allocated slots.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Table.GetCapacity(); }
 
 public:
 
@@ -468,17 +120,12 @@ public:
 	*/
 	FORCEINLINE void Insert(K Key, V Value)
 	{
-		if( IsEmpty() )
-		{
-			Resize(InitialSize);
-		}
-		else if( FillCount * 2 > Size )
+		bool bAlreadyExists;
+		TKeyValuePair<K, V>* Pair = Table.FindOrEmplace(Key, bAlreadyExists, MoveTemp(Key), MoveTemp(Value));
+		if( bAlreadyExists )
 		{
-			Resize(Size * 2);
+			Pair->Value = MoveTemp(Value);
 		}
-
-		const uint64 Hash = GetTypeHash(Key);
-		return InsertHash(Hash, MoveTemp(Key), MoveTemp(Value));
 	}
 	/**
 		Insert Value under Key.
@@ -495,8 +142,9 @@ public:
 	*/
 	FORCEINLINE V Find(const K& Key) const noexcept
 	{
-		const uint64 Hash = GetTypeHash(Key);
-		return FindValueHash(Hash);
+		const TKeyValuePair<K, V>* Pair = Table.Find(Key);
+		check(Pair);
+		return Pair->Value;
 	}
 	/**
 		Try to find value by key.
@@ -507,53 +155,50 @@ public:
 	*/
 	FORCEINLINE V& FindRef(const K& Key) noexcept
 	{
-		const uint64 Hash = GetTypeHash(Key);
-		return FindValueRefHash(Hash);
+		TKeyValuePair<K, V>* Pair = Table.Find(Key);
+		check(Pair);
+		return Pair->Value;
 	}
-
 	/**
-		Check that Key is in map.
+		Try to find value by key.
+
+		@return pointer to value or nullptr if key not in map.
 	*/
-	FORCEINLINE bool Contains(const K& Key) const noexcept
+	FORCEINLINE V* FindPtr(const K& Key) noexcept
+	{
+		TKeyValuePair<K, V>* Pair = Table.Find(Key);
+		return Pair ? &Pair->Value : nullptr;
+	}
+	FORCEINLINE const V* FindPtr(const K& Key) const noexcept
 	{
-		if( IsEmpty() ) return false;
-		const uint64 Hash = GetTypeHash(Key);
-		return ContainsHash(Hash);
+		const TKeyValuePair<K, V>* Pair = Table.Find(Key);
+		return Pair ? &Pair->Value : nullptr;
 	}
 
+	/**
+		Check that Key is in map.
+	*/
+	FORCEINLINE bool Contains(const K& Key) const noexcept { return Table.Find(Key) != nullptr; }
+
 	/**
 		Try to remove Key from the map.
-		If Key not in map then will have no effect. 
+		If Key not in map then will have no effect.
 	*/
-	FORCEINLINE void Remove(const K& Key)
-	{
-		if( IsEmpty() ) return;
-		const uint64 Hash = GetTypeHash(Key);
-		RemoveHash(Hash);
-	}
+	FORCEINLINE void Remove(const K& Key) { Table.Remove(Key); }
+
+	/**
+		Preallocate memory for Number elements.
+	*/
+	FORCEINLINE void Reserve(uint32 Number) { Table.Reserve(Number); }
 
 	/**
 		Empty map without physical resizing to 0.
 	*/
-	FORCEINLINE void Clear()
-	{
-		for( uint32 i = 0; i < Size; ++i )
-		{
-			Data[i].ClearWithDestructors();
-		}
-	}
+	FORCEINLINE void Clear() { Table.Clear(); }
 	/**
 		Physically risize to 0 size.
 	*/
-	FORCEINLINE void Reset()
-	{
-		Clear();
-		if( Data )
-		{
-			FMemory::Free(Data);
-		}
-		Size = 0;
-	}
+	FORCEINLINE void Reset() { Table.Reset(); }
 
 public:
 
@@ -565,111 +210,24 @@ public:
 	template<typename LAMBDA>
 	void ForEach(LAMBDA Lambda)
 	{
-		for( uint32 i = 0; i < Size; ++i )
+		for( TKeyValuePair<K, V>& Pair : Table )
 		{
-			for( TMapEntry<K, V>& Entry : Data[i] )
-			{
-				Lambda(Entry.KeyValue);
-			}
+			Lambda(Pair);
 		}
 	}
 
-private:
-
-	FORCEINLINE void InsertHash(uint64 Hash, K&& Key, V&& Value)
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		FillCount += Data[BucketIndex].Insert(MoveTemp(Key), MoveTemp(Value), Hash);
-	}
-	FORCEINLINE TKeyValuePair<K, V> FindHash(uint64 Hash) const noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		TMapEntry<K, V>* Entry = Data[BucketIndex].Find(Hash);
-		check(Entry);
-		return Entry->KeyValue;
-	}
-	FORCEINLINE V FindValueHash(uint64 Hash) const noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		TMapEntry<K, V>* Entry = Data[BucketIndex].Find(Hash);
-		check(Entry);
-		return Entry->KeyValue.Value;
-	}
-	FORCEINLINE V& FindValueRefHash(uint64 Hash) noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		TMapEntry<K, V>* Entry = Data[BucketIndex].Find(Hash);
-		check(Entry);
-		return Entry->KeyValue.Value;
-	}
-	FORCEINLINE bool ContainsHash(uint64 Hash) const noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
 
-		return Data[BucketIndex].Contains(Hash);
-	}
-	FORCEINLINE void RemoveHash(uint64 Hash)
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
 
-		TMapBucket<K, V>& Bucket = Data[BucketIndex];
-		if( !Bucket.IsEmpty() )
-		{
-			Bucket.Remove(Hash);
-			FillCount -= Bucket.IsEmpty();
-		}
-	}
+private:
 
-	FORCEINLINE uint64 GetBucketIndex(uint64 Hash) const noexcept
-	{
-		check(Size != 0);
-		const uint64 BucketIndex = Hash % Size;
-	}
+	THashTable<TKeyValuePair<K, V>, TMapKeyFuncs<K, V>> Table;
+};
 
-	void Resize(uint32 NewSize)
+template<typename K, typename V>
+struct TIsTriviallyRelocatable<TMap<K, V>>
+{
+	enum
 	{
-		if( NewSize <= Size ) return;
-
-		TMapBucket<K, V>* NewData = static_cast<TMapBucket<K, V>*>(FMemory::Malloc(sizeof(TMapBucket<K, V>) * NewSize));
-		DefaultConstructItems(NewData, NewSize);
-
-		FillCount = 0;
-		if( Data )
-		{
-			for( uint32 i = 0; i < Size; ++i )
-			{
-				for( TMapEntry<K, V>& Entry : Data[i] )
-				{
-					const uint64 BucketIndex = GetBucketIndex(Entry.Hash);
-					FillCount += NewData[BucketIndex].Insert(MoveTemp(Entry.KeyValue.Key), MoveTemp(Entry.KeyValue.Value), Entry.Hash);
-				}
-
-				Data[i].Clear();
-			}
-			FMemory::Free(Data);
-		}
-		Size = NewSize;
-		Data = NewData;
-	}
-
-
-
-private:
-
-	/**
-		Map buckets.
-	*/
-	TMapBucket<K, V>* Data = nullptr;
-	/**
-		Count of buckets.
-	*/
-	uint32 Size = 0;
-	/**
-		Count of non-empty buckets.
-	*/
-	uint32 FillCount = 0;
-};
\ No newline at end of file
+		Value = true
+	};
+};
@@ -0,0 +1,102 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "StringView.h"
+#include "FString.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+
+
+
+
+/**
+	Interned string handle.
+	Each distinct string is stored once in global thread-safe name pool and FName keeps only 32-bit index of the pool entry,
+	so comparing, copying and hashing names are integer operations.
+	Lookup is case-insensitive and case-preserving: the first registered spelling is kept, FName("Actor") == FName("ACTOR").
+
+	@note Default constructed name and name of empty string is None.
+	@note Pool entries are never freed, so views returned by ToView stay valid until program exit.
+*/
+struct ENGINE_API FName
+{
+public:
+
+	FORCEINLINE constexpr FName() noexcept = default;
+	/**
+		Find or add name to the pool.
+	*/
+	FName(FStringView Name);
+	FORCEINLINE FName(const TCHAR* Name) : FName(FStringView(Name)) { }
+	FORCEINLINE FName(const FString& Name) : FName(FStringView(Name)) { }
+	FName(const ANSICHAR* Name);
+
+
+public:
+
+	FORCEINLINE bool operator==(FName Other) const noexcept { return Index == Other.Index; }
+	FORCEINLINE bool operator!=(FName Other) const noexcept { return Index != Other.Index; }
+
+public:
+
+	/**
+		Find name in the pool without adding it.
+
+		@return found name or None.
+	*/
+	static FName Find(FStringView Name);
+
+	/**
+		Check that name is None.
+	*/
+	FORCEINLINE bool IsNone() const noexcept { return Index == 0; }
+	/**
+		@return index of pool entry.
+	*/
+	FORCEINLINE uint32 GetIndex() const noexcept { return Index; }
+	/**
+		@return case-insensitive hash of name string computed once on registration.
+	*/
+	uint64 GetStringHash() const noexcept;
+	/**
+		@return view of stored string.
+	*/
+	FStringView ToView() const noexcept;
+	/**
+		@return copy of stored string.
+	*/
+	FORCEINLINE FString ToString() const { return FString(ToView()); }
+
+	/**
+		@return count of names in the pool, None included.
+	*/
+	static uint32 GetNumNames() noexcept;
+
+
+
+private:
+
+	/**
+		Index of entry in the name pool. 0 is None.
+	*/
+	uint32 Index = 0;
+};
+
+template<>
+struct TIsTriviallyRelocatable<FName>
+{
+	enum
+	{
+		Value = true
+	};
+};
+
+
+
+/**
+	Index is unique per name, so finalized index is enough.
+*/
+FORCEINLINE uint64 GetTypeHash(FName Name) noexcept
+{
+	return HashMix64(Name.GetIndex());
+}
@@ -0,0 +1,359 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "NumericLimits.h"
+#include "TypeTraits/IsSigned.h"
+#include "TypeTraits/AreTypesEqual.h"
+
+
+
+
+/**
+	Reason why number was not parsed.
+*/
+enum class ENumberParseError : uint8
+{
+	None,
+	/**
+		Text does not start with a number. Output value is not modified.
+	*/
+	Invalid,
+	/**
+		Number does not fit the output type. Output value is not modified.
+	*/
+	OutOfRange
+};
+
+/**
+	Result of parsing number in style of std::from_chars.
+*/
+template<typename CharType>
+struct TNumberParseResult
+{
+	/**
+		First char that is not part of the number. Points to the beginning of text when number is invalid.
+	*/
+	const CharType* End;
+	ENumberParseError Error;
+
+	FORCEINLINE bool IsOk() const noexcept { return Error == ENumberParseError::None; }
+};
+
+/**
+	Traits class which tests if a type can be parsed and formatted by FNumberConversion.
+*/
+template<typename T>
+struct TIsNumberConvertible
+{
+	enum
+	{
+		Value = false
+	};
+};
+
+// clang-format off
+template<> struct TIsNumberConvertible<float>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<double>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<uint8>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<uint16>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<uint32>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<uint64>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<int8>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<int16>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<int32>	{ enum { Value = true }; };
+template<> struct TIsNumberConvertible<int64>	{ enum { Value = true }; };
+// clang-format on
+
+
+
+
+
+/**
+	Locale independent conversion between numbers and text without allocations.
+
+	Integers are written two digits per division from a digit pair table.
+	Floats are written by Grisu2 as short digits that always parse back to the same value, e.g. 0.1f gives "0.1" rather than "0.100000001".
+	Parsing accepts optional sign, never skips whitespace and reports errors instead of returning zero.
+*/
+struct ENGINE_API FNumberConversion
+{
+public:
+
+	/**
+		Buffer size enough for any integer, sign included.
+	*/
+	static constexpr uint32 MaxIntChars = 20;
+	/**
+		Buffer size enough for any float or double, sign and exponent included.
+	*/
+	static constexpr uint32 MaxFloatChars = 32;
+	/**
+		Max count of fractional digits written by FormatFixed.
+	*/
+	static constexpr uint32 MaxFixedPrecision = 64;
+	/**
+		Buffer size enough for fixed notation of any double: sign, 309 integer digits, point and MaxFixedPrecision digits.
+	*/
+	static constexpr uint32 MaxFixedChars = 1 + 309 + 1 + MaxFixedPrecision;
+
+	/**
+		Write decimal digits of Value.
+		Buffer must have space for MaxIntChars chars, result is not null terminated.
+
+		@return count of written chars.
+	*/
+	template<typename CharType>
+	static FORCEINLINE uint32 FormatUInt(uint64 Value, CharType* Buffer) noexcept
+	{
+		const uint32 NumDigits = CountDigits(Value);
+		CharType* It = Buffer + NumDigits;
+
+		while( Value >= 100 )
+		{
+			const uint32 Pair = static_cast<uint32>(Value % 100) * 2;
+			Value /= 100;
+			*--It = static_cast<CharType>(DigitPairs[Pair + 1]);
+			*--It = static_cast<CharType>(DigitPairs[Pair]);
+		}
+
+		if( Value >= 10 )
+		{
+			const uint32 Pair = static_cast<uint32>(Value) * 2;
+			*--It = static_cast<CharType>(DigitPairs[Pair + 1]);
+			*--It = static_cast<CharType>(DigitPairs[Pair]);
+		}
+		else
+		{
+			*--It = static_cast<CharType>('0' + Value);
+		}
+
+		return NumDigits;
+	}
+	template<typename CharType>
+	static FORCEINLINE uint32 FormatInt(int64 Value, CharType* Buffer) noexcept
+	{
+		if( Value < 0 )
+		{
+			*Buffer = '-';
+			// Negate in unsigned domain, so minimal value does not overflow
+			return 1 + FormatUInt(uint64(0) - static_cast<uint64>(Value), Buffer + 1);
+		}
+		return FormatUInt(static_cast<uint64>(Value), Buffer);
+	}
+
+	/**
+		Write the shortest text that parses back to the same value. Rarely Grisu2 gives one digit more than necessary.
+		Fixed notation is used for magnitudes in [1e-4, 1e15), otherwise scientific: "0.001", "123.5", "1e+20", "1.5e-07".
+		Whole numbers keep one fractional zero: "2.0". Special values are "nan", "inf" and "-inf".
+		Buffer must have space for MaxFloatChars chars, result is not null terminated.
+
+		@return count of written chars.
+	*/
+	template<typename CharType>
+	static FORCEINLINE uint32 FormatFloat(float Value, CharType* Buffer) noexcept
+	{
+		return WidenFormatted(Buffer, [Value](ANSICHAR* AnsiBuffer) { return FormatShortest(Value, AnsiBuffer); });
+	}
+	template<typename CharType>
+	static FORCEINLINE uint32 FormatDouble(double Value, CharType* Buffer) noexcept
+	{
+		return WidenFormatted(Buffer, [Value](ANSICHAR* AnsiBuffer) { return FormatShortest(Value, AnsiBuffer); });
+	}
+
+	/**
+		Write Value in fixed notation with exactly Precision fractional digits, correctly rounded: "1.50", "-0.001", "3".
+		Special values are "nan", "inf" and "-inf".
+		Precision must be in [0, MaxFixedPrecision]. Buffer must have space for MaxFixedChars chars, result is not null terminated.
+
+		@return count of written chars.
+	*/
+	template<typename CharType>
+	static FORCEINLINE uint32 FormatFixed(double Value, int32 Precision, CharType* Buffer) noexcept
+	{
+		return WidenFormatted<MaxFixedChars>(Buffer, [Value, Precision](ANSICHAR* AnsiBuffer) { return FormatFixedAnsi(Value, Precision, AnsiBuffer); });
+	}
+
+	/**
+		Parse integer from [First, Last).
+		Accepts optional sign followed by digits of Base ('a'-'z' and 'A'-'Z' for bases over 10), no prefix is skipped.
+		Negative numbers are invalid for unsigned types.
+	*/
+	template<typename CharType, typename IntType>
+	static TNumberParseResult<CharType> ParseInt(const CharType* First, const CharType* Last, IntType& OutValue, uint32 Base = 10) noexcept
+	{
+		const CharType* It = First;
+
+		bool bNegative = false;
+		if( It != Last && (*It == '-' || *It == '+') )
+		{
+			bNegative = *It == '-';
+			++It;
+		}
+		if( bNegative && !TIsSigned<IntType>::Value ) return {First, ENumberParseError::Invalid};
+
+		const uint64 MaxValue = static_cast<uint64>(TNumericLimits<IntType>::Max());
+		const uint64 Limit = bNegative ? MaxValue + 1 : MaxValue;
+
+		const CharType* const DigitsBegin = It;
+		uint64 Value = 0;
+		bool bOverflow = false;
+		for( ; It != Last; ++It )
+		{
+			const uint32 Digit = DigitValue(*It);
+			if( Digit >= Base ) break;
+
+			// Value * Base + Digit <= Limit, checked without overflow of Value
+			if( Value > (Limit - Digit) / Base )
+			{
+				bOverflow = true;
+			}
+			else
+			{
+				Value = Value * Base + Digit;
+			}
+		}
+
+		if( It == DigitsBegin ) return {First, ENumberParseError::Invalid};
+		if( bOverflow ) return {It, ENumberParseError::OutOfRange};
+
+		OutValue = static_cast<IntType>(bNegative ? uint64(0) - Value : Value);
+		return {It, ENumberParseError::None};
+	}
+
+	/**
+		Parse floating point number from [First, Last).
+		Accepts optional sign, digits with optional fraction and exponent ("-1.5e3", ".5", "2."), "inf", "infinity" and "nan" ignoring case.
+		Result is correctly rounded. Values that overflow or underflow to zero are out of range.
+	*/
+	static TNumberParseResult<ANSICHAR> ParseFloat(const ANSICHAR* First, const ANSICHAR* Last, float& OutValue) noexcept;
+	static TNumberParseResult<ANSICHAR> ParseFloat(const ANSICHAR* First, const ANSICHAR* Last, double& OutValue) noexcept;
+	static TNumberParseResult<WIDECHAR> ParseFloat(const WIDECHAR* First, const WIDECHAR* Last, float& OutValue) noexcept;
+	static TNumberParseResult<WIDECHAR> ParseFloat(const WIDECHAR* First, const WIDECHAR* Last, double& OutValue) noexcept;
+
+	/**
+		Parse any type supported by TIsNumberConvertible.
+	*/
+	template<typename CharType, typename T>
+	static FORCEINLINE TNumberParseResult<CharType> Parse(const CharType* First, const CharType* Last, T& OutValue) noexcept
+	{
+		static_assert(TIsNumberConvertible<T>::Value, "Type is not supported by number conversion");
+
+		if constexpr( TAreTypesEqual<T, float>::Value || TAreTypesEqual<T, double>::Value )
+		{
+			return ParseFloat(First, Last, OutValue);
+		}
+		else
+		{
+			return ParseInt(First, Last, OutValue);
+		}
+	}
+	/**
+		Parse whole text as number.
+
+		@return true if all chars are part of the number and it fits the type.
+	*/
+	template<typename CharType, typename T>
+	static FORCEINLINE bool TryParse(const CharType* First, const CharType* Last, T& OutValue) noexcept
+	{
+		T Value;
+		const TNumberParseResult<CharType> Result = Parse(First, Last, Value);
+		if( !Result.IsOk() || Result.End != Last ) return false;
+
+		OutValue = Value;
+		return true;
+	}
+
+	/**
+		Write any type supported by TIsNumberConvertible.
+		Buffer must have space for MaxFloatChars chars.
+
+		@return count of written chars.
+	*/
+	template<typename CharType, typename T>
+	static FORCEINLINE uint32 Format(T Value, CharType* Buffer) noexcept
+	{
+		static_assert(TIsNumberConvertible<T>::Value, "Type is not supported by number conversion");
+
+		if constexpr( TAreTypesEqual<T, float>::Value )
+		{
+			return FormatFloat(Value, Buffer);
+		}
+		else if constexpr( TAreTypesEqual<T, double>::Value )
+		{
+			return FormatDouble(Value, Buffer);
+		}
+		else if constexpr( TIsSigned<T>::Value )
+		{
+			return FormatInt(static_cast<int64>(Value), Buffer);
+		}
+		else
+		{
+			return FormatUInt(static_cast<uint64>(Value), Buffer);
+		}
+	}
+
+
+
+private:
+
+	static uint32 FormatShortest(float Value, ANSICHAR* Buffer) noexcept;
+	static uint32 FormatShortest(double Value, ANSICHAR* Buffer) noexcept;
+	static uint32 FormatFixedAnsi(double Value, int32 Precision, ANSICHAR* Buffer) noexcept;
+
+	template<uint32 AnsiBufferSize = MaxFloatChars, typename CharType, typename FormatterType>
+	static FORCEINLINE uint32 WidenFormatted(CharType* Buffer, FormatterType Formatter) noexcept
+	{
+		if constexpr( sizeof(CharType) == sizeof(ANSICHAR) )
+		{
+			return Formatter(reinterpret_cast<ANSICHAR*>(Buffer));
+		}
+		else
+		{
+			ANSICHAR AnsiBuffer[AnsiBufferSize];
+			const uint32 NumChars = Formatter(AnsiBuffer);
+			for( uint32 i = 0; i < NumChars; ++i )
+			{
+				Buffer[i] = static_cast<CharType>(AnsiBuffer[i]);
+			}
+			return NumChars;
+		}
+	}
+
+	static FORCEINLINE uint32 CountDigits(uint64 Value) noexcept
+	{
+		uint32 Count = 1;
+		for( ;; )
+		{
+			if( Value < 10 ) return Count;
+			if( Value < 100 ) return Count + 1;
+			if( Value < 1000 ) return Count + 2;
+			if( Value < 10000 ) return Count + 3;
+			Value /= 10000;
+			Count += 4;
+		}
+	}
+
+	/**
+		@return value of digit or 36 if char is not a digit of any base.
+	*/
+	template<typename CharType>
+	static FORCEINLINE uint32 DigitValue(CharType C) noexcept
+	{
+		if( C >= '0' && C <= '9' ) return static_cast<uint32>(C - '0');
+		if( C >= 'a' && C <= 'z' ) return static_cast<uint32>(C - 'a') + 10;
+		if( C >= 'A' && C <= 'Z' ) return static_cast<uint32>(C - 'A') + 10;
+		return 36;
+	}
+
+	static constexpr ANSICHAR DigitPairs[201] = "00010203040506070809"
+												"10111213141516171819"
+												"20212223242526272829"
+												"30313233343536373839"
+												"40414243444546474849"
+												"50515253545556575859"
+												"60616263646566676869"
+												"70717273747576777879"
+												"80818283848586878889"
+												"90919293949596979899";
+};
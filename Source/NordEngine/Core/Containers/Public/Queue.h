@@ -0,0 +1,385 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "GenericPlatformAtomic.h"
+#include "EngineMemory.h"
+#include "EngineMath.h"
+#include "MemoryOps.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "SpecificationMacros.h"
+#include "MoveSemantic.h"
+#include "TypeCompatibleBytes.h"
+
+#include <new>
+
+
+
+
+namespace Queue_Private
+{
+/**
+	Bytes to put after Value so that next member starts on another cache line.
+*/
+template<typename T>
+struct TCacheLinePadded
+{
+	T Value;
+	uint8 Padding[PLATFORM_CACHE_LINE_SIZE > sizeof(T) ? PLATFORM_CACHE_LINE_SIZE - sizeof(T) : 1];
+};
+} // namespace Queue_Private
+
+
+
+/**
+	Bounded lock-free queue for one producer thread and one consumer thread.
+	Head and tail live on separate cache lines, each side keeps cached copy of the other side index
+	and touches shared line only when the cache says the queue is full or empty.
+
+	@note Capacity is rounded up to power of two.
+*/
+template<typename T>
+class TSpscQueue
+{
+	NONCOPYABLE(TSpscQueue)
+
+public:
+
+	FORCEINLINE explicit TSpscQueue(uint32 InCapacity) : Capacity(FMath::RoundUpToPowerOfTwo(InCapacity)), Mask(Capacity - 1)
+	{
+		Slots = static_cast<TTypeCompatibleBytes<T>*>(FMemory::Malloc(sizeof(TTypeCompatibleBytes<T>) * Capacity));
+	}
+	FORCEINLINE ~TSpscQueue()
+	{
+		const uint32 LTail = Tail.Value.load(std::memory_order_acquire);
+		for( uint32 i = Head.Value.load(std::memory_order_relaxed); i != LTail; ++i )
+		{
+			DestructItem(Slots[i & Mask].GetTypedPtr());
+		}
+		FMemory::Free(Slots);
+	}
+
+
+public:
+
+	/**
+		Construct element at the end of queue. Only producer thread can call it.
+
+		@return false if queue is full.
+	*/
+	template<typename... ArgsType>
+	bool Emplace(ArgsType&&... Args)
+	{
+		const uint32 LTail = Tail.Value.load(std::memory_order_relaxed);
+		if( LTail - CachedHead.Value == Capacity )
+		{
+			CachedHead.Value = Head.Value.load(std::memory_order_acquire);
+			if( LTail - CachedHead.Value == Capacity ) return false;
+		}
+
+		new(Slots[LTail & Mask].GetTypedPtr()) T(Forward<ArgsType>(Args)...);
+		Tail.Value.store(LTail + 1, std::memory_order_release);
+		return true;
+	}
+	FORCEINLINE bool Enqueue(const T& Elem) { return Emplace(Elem); }
+	FORCEINLINE bool Enqueue(T&& Elem) { return Emplace(MoveTemp(Elem)); }
+
+	/**
+		Move first element to OutElem. Only consumer thread can call it.
+
+		@return false if queue is empty.
+	*/
+	bool Dequeue(T& OutElem)
+	{
+		const uint32 LHead = Head.Value.load(std::memory_order_relaxed);
+		if( LHead == CachedTail.Value )
+		{
+			CachedTail.Value = Tail.Value.load(std::memory_order_acquire);
+			if( LHead == CachedTail.Value ) return false;
+		}
+
+		T* Elem = Slots[LHead & Mask].GetTypedPtr();
+		OutElem = MoveTemp(*Elem);
+		DestructItem(Elem);
+		Head.Value.store(LHead + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+		Approximate check, exact only on consumer thread.
+	*/
+	FORCEINLINE bool IsEmpty() const noexcept { return Head.Value.load(std::memory_order_acquire) == Tail.Value.load(std::memory_order_acquire); }
+	/**
+		@return max count of elements in queue.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Capacity; }
+
+
+
+private:
+
+	/**
+		Consumer side: index of next element to dequeue and cached producer index.
+	*/
+	Queue_Private::TCacheLinePadded<std::atomic<uint32>> Head = {{0}, {}};
+	Queue_Private::TCacheLinePadded<uint32> CachedTail = {0, {}};
+	/**
+		Producer side: index of next slot to fill and cached consumer index.
+	*/
+	Queue_Private::TCacheLinePadded<std::atomic<uint32>> Tail = {{0}, {}};
+	Queue_Private::TCacheLinePadded<uint32> CachedHead = {0, {}};
+
+	TTypeCompatibleBytes<T>* Slots = nullptr;
+	const uint32 Capacity;
+	const uint32 Mask;
+};
+
+
+
+/**
+	Bounded lock-free queue for any count of producer and consumer threads (Dmitry Vyukov's algorithm).
+	Each cell stores sequence number that tells producers and consumers whose turn it is,
+	so threads contend only on one CAS of enqueue or dequeue position.
+
+	@note Capacity is rounded up to power of two and must be at least 2.
+*/
+template<typename T>
+class TMpmcQueue
+{
+	NONCOPYABLE(TMpmcQueue)
+
+	struct FCell
+	{
+		std::atomic<SIZE_T> Sequence;
+		TTypeCompatibleBytes<T> Data;
+	};
+
+public:
+
+	FORCEINLINE explicit TMpmcQueue(uint32 InCapacity) : Capacity(FMath::RoundUpToPowerOfTwo(InCapacity < 2 ? 2 : InCapacity)), Mask(Capacity - 1)
+	{
+		Cells = static_cast<FCell*>(FMemory::Malloc(sizeof(FCell) * Capacity));
+		for( uint32 i = 0; i < Capacity; ++i )
+		{
+			new(&Cells[i].Sequence) std::atomic<SIZE_T>(i);
+		}
+	}
+	FORCEINLINE ~TMpmcQueue()
+	{
+		const SIZE_T LEnqueuePosition = EnqueuePosition.Value.load(std::memory_order_acquire);
+		for( SIZE_T i = DequeuePosition.Value.load(std::memory_order_relaxed); i != LEnqueuePosition; ++i )
+		{
+			DestructItem(Cells[i & Mask].Data.GetTypedPtr());
+		}
+		FMemory::Free(Cells);
+	}
+
+
+public:
+
+	/**
+		Construct element at the end of queue. Can be called from any thread.
+
+		@return false if queue is full.
+	*/
+	template<typename... ArgsType>
+	bool Emplace(ArgsType&&... Args)
+	{
+		FCell* Cell;
+		SIZE_T Position = EnqueuePosition.Value.load(std::memory_order_relaxed);
+		for( ;; )
+		{
+			Cell = &Cells[Position & Mask];
+			const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const SSIZE_T Difference = static_cast<SSIZE_T>(Sequence) - static_cast<SSIZE_T>(Position);
+			if( Difference == 0 )
+			{
+				if( EnqueuePosition.Value.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed) ) break;
+			}
+			else if( Difference < 0 )
+			{
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.Value.load(std::memory_order_relaxed);
+			}
+		}
+
+		new(Cell->Data.GetTypedPtr()) T(Forward<ArgsType>(Args)...);
+		Cell->Sequence.store(Position + 1, std::memory_order_release);
+		return true;
+	}
+	FORCEINLINE bool Enqueue(const T& Elem) { return Emplace(Elem); }
+	FORCEINLINE bool Enqueue(T&& Elem) { return Emplace(MoveTemp(Elem)); }
+
+	/**
+		Move first element to OutElem. Can be called from any thread.
+
+		@return false if queue is empty.
+	*/
+	bool Dequeue(T& OutElem)
+	{
+		FCell* Cell;
+		SIZE_T Position = DequeuePosition.Value.load(std::memory_order_relaxed);
+		for( ;; )
+		{
+			Cell = &Cells[Position & Mask];
+			const SIZE_T Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const SSIZE_T Difference = static_cast<SSIZE_T>(Sequence) - static_cast<SSIZE_T>(Position + 1);
+			if( Difference == 0 )
+			{
+				if( DequeuePosition.Value.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed) ) break;
+			}
+			else if( Difference < 0 )
+			{
+				return false;
+			}
+			else
+			{
+				Position = DequeuePosition.Value.load(std::memory_order_relaxed);
+			}
+		}
+
+		T* Elem = Cell->Data.GetTypedPtr();
+		OutElem = MoveTemp(*Elem);
+		DestructItem(Elem);
+		Cell->Sequence.store(Position + Mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+		@return max count of elements in queue.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Capacity; }
+
+
+
+private:
+
+	Queue_Private::TCacheLinePadded<std::atomic<SIZE_T>> EnqueuePosition = {{0}, {}};
+	Queue_Private::TCacheLinePadded<std::atomic<SIZE_T>> DequeuePosition = {{0}, {}};
+
+	FCell* Cells = nullptr;
+	const uint32 Capacity;
+	const SIZE_T Mask;
+};
+
+
+
+/**
+	Unbounded lock-free queue for one producer thread and one consumer thread.
+	Elements are stored in linked fixed size segments: producer appends new segment when the last one is full,
+	consumer frees segments it has drained. No allocation happens while segment has free slots.
+*/
+template<typename T, uint32 SegmentSize = 256>
+class TSegmentedQueue
+{
+	NONCOPYABLE(TSegmentedQueue)
+
+	struct FSegment
+	{
+		TTypeCompatibleBytes<T> Slots[SegmentSize];
+		std::atomic<FSegment*> Next {nullptr};
+		/**
+			Count of constructed slots, written by producer.
+		*/
+		std::atomic<uint32> NumWritten {0};
+	};
+
+public:
+
+	FORCEINLINE TSegmentedQueue() { HeadSegment = TailSegment = AllocateSegment(); }
+	FORCEINLINE ~TSegmentedQueue()
+	{
+		while( HeadSegment != nullptr )
+		{
+			const uint32 NumWritten = HeadSegment->NumWritten.load(std::memory_order_acquire);
+			for( uint32 i = HeadIndex; i < NumWritten; ++i )
+			{
+				DestructItem(HeadSegment->Slots[i].GetTypedPtr());
+			}
+
+			FSegment* Next = HeadSegment->Next.load(std::memory_order_acquire);
+			FreeSegment(HeadSegment);
+			HeadSegment = Next;
+			HeadIndex = 0;
+		}
+	}
+
+
+public:
+
+	/**
+		Construct element at the end of queue. Only producer thread can call it.
+	*/
+	template<typename... ArgsType>
+	void Emplace(ArgsType&&... Args)
+	{
+		FSegment* Segment = TailSegment;
+		uint32 Index = Segment->NumWritten.load(std::memory_order_relaxed);
+		if( Index == SegmentSize )
+		{
+			FSegment* NewSegment = AllocateSegment();
+			Segment->Next.store(NewSegment, std::memory_order_release);
+			TailSegment = Segment = NewSegment;
+			Index = 0;
+		}
+
+		new(Segment->Slots[Index].GetTypedPtr()) T(Forward<ArgsType>(Args)...);
+		Segment->NumWritten.store(Index + 1, std::memory_order_release);
+	}
+	FORCEINLINE void Enqueue(const T& Elem) { Emplace(Elem); }
+	FORCEINLINE void Enqueue(T&& Elem) { Emplace(MoveTemp(Elem)); }
+
+	/**
+		Move first element to OutElem. Only consumer thread can call it.
+
+		@return false if queue is empty.
+	*/
+	bool Dequeue(T& OutElem)
+	{
+		if( HeadIndex == SegmentSize )
+		{
+			FSegment* Next = HeadSegment->Next.load(std::memory_order_acquire);
+			if( Next == nullptr ) return false;
+
+			FreeSegment(HeadSegment);
+			HeadSegment = Next;
+			HeadIndex = 0;
+		}
+
+		if( HeadIndex == HeadSegment->NumWritten.load(std::memory_order_acquire) ) return false;
+
+		T* Elem = HeadSegment->Slots[HeadIndex].GetTypedPtr();
+		OutElem = MoveTemp(*Elem);
+		DestructItem(Elem);
+		++HeadIndex;
+		return true;
+	}
+
+
+
+private:
+
+	static FORCEINLINE FSegment* AllocateSegment() { return new(FMemory::MallocAligned(sizeof(FSegment), alignof(FSegment))) FSegment(); }
+	static FORCEINLINE void FreeSegment(FSegment* Segment)
+	{
+		Segment->~FSegment();
+		FMemory::FreeAligned(Segment);
+	}
+
+private:
+
+	/**
+		Consumer side.
+	*/
+	FSegment* HeadSegment = nullptr;
+	uint32 HeadIndex = 0;
+	uint8 Padding[PLATFORM_CACHE_LINE_SIZE];
+	/**
+		Producer side.
+	*/
+	FSegment* TailSegment = nullptr;
+};
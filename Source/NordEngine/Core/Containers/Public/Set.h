@@ -2,340 +2,67 @@
 #pragma once
 
 #include "GenericPlatform.h"
-#include "EngineMemory.h"
-#include "MemoryOps.h"
 #include "AssertionMacros.h"
 #include "InitializerList.h"
 #include "MoveSemantic.h"
 #include "TypeHash.h"
+#include "HashTable.h"
 
 
 
 
 template<typename K>
-struct TSetEntry
+struct TSetKeyFuncs
 {
-	K Key;
-	uint64 Hash;
-};
-
-template<typename K>
-struct ENGINE_API TSetBucket
-{
-public:
-
-	TSetBucket() = default;
-	~TSetBucket() = default;
-
-
-public:
-
-	TSetEntry<K>* begin() noexcept { return Data; }
-	const TSetEntry<K>* begin() const noexcept { return Data; }
-	TSetEntry<K>* end() noexcept { return Data + Size; }
-	const TSetEntry<K>* end() const noexcept { return Data + Size; }
-
-public:
-
-	FORCEINLINE bool IsValid() const noexcept { return Data != nullptr; }
-	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
-	FORCEINLINE uint32 GetSize() const noexcept { return Size; }
-	FORCEINLINE const TSetEntry<K>* GetData() const noexcept { return Data; }
-	FORCEINLINE TSetEntry<K>* GetData() noexcept { return Data; }
-
-public:
-
-	FORCEINLINE bool Insert(K&& Key, uint64 Hash)
-	{
-		TSetEntry<K>* TergetEntry = begin();
-		TSetEntry<K>* EntryEnd = end();
-		while( TergetEntry != EntryEnd )
-		{
-			if( TergetEntry->Hash == Hash ) break;
-			++TergetEntry;
-		}
-
-		if( TergetEntry == EntryEnd )
-		{
-			++Size;
-			Reserve(Size);
-
-			TergetEntry = end() - 1;
-
-			TergetEntry->Key = MoveTemp(Key);
-			TergetEntry->Hash = Hash;
-
-			return true;
-		}
-		else
-		{
-			TergetEntry->Key = MoveTemp(Key);
-			TergetEntry->Hash = Hash;
-
-			return false;
-		}
-	}
-
-	FORCEINLINE TSetEntry<K>* Find(uint64 Hash) noexcept
-	{
-		const TSetEntry<K>* Entry = begin();
-		const TSetEntry<K>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) return Entry;
-			++Entry;
-		}
-
-		return nullptr;
-	}
-	FORCEINLINE const TSetEntry<K>* Find(uint64 Hash) const noexcept
-	{
-		TSetEntry<K>* Entry = begin();
-		TSetEntry<K>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) return Entry;
-			++Entry;
-		}
-
-		return nullptr;
-	}
-
-	FORCEINLINE bool Contains(uint64 Hash) const noexcept { return Find(Hash) != nullptr; }
+	using KeyType = K;
 
-	FORCEINLINE void Remove(uint64 Hash)
-	{
-		TSetEntry<K>* Entry = begin();
-		TSetEntry<K>* EntryEnd = end();
-		while( Entry != EntryEnd )
-		{
-			if( Entry->Hash == Hash ) break;
-			++Entry;
-		}
-		if( Entry == EntryEnd ) return;
-
-		DestructItem(Entry->Key);
-
-		--Size;
-		FMemory::MemCpy(Entry, Entry + 1, sizeof(TSetEntry<K>) * (end() - Entry));
-	}
-
-	FORCEINLINE void Clear()
-	{
-		Size = 0;
-		Capacity = 0;
-		if( Data )
-		{
-			FMemory::Free(Data);
-			Data = nullptr;
-		}
-	}
-
-	FORCEINLINE void ClearWithDestructors()
-	{
-		DestructItems(Data, Size);
-		Clear();
-	}
-
-	FORCEINLINE void Reserve(uint32 NewCapacity)
-	{
-		if( NewCapacity <= Capacity ) return;
-
-		Capacity = NewCapacity * 2;
-		if( Data )
-		{
-			Data = static_cast<TSetEntry<K>*>(FMemory::Realloc(Data, sizeof(TSetEntry<K>) * Capacity));
-		}
-		else
-		{
-			Data = static_cast<TSetEntry<K>*>(FMemory::Malloc(sizeof(TSetEntry<K>) * Capacity));
-		}
-	}
-
-
-
-private:
-
-	uint32 Size = 0;
-	uint32 Capacity = 0;
-	TSetEntry<K>* Data = nullptr;
+	static FORCEINLINE const K& GetKey(const K& Key) noexcept { return Key; }
 };
 
 /**
 	Set iterator.
 */
 template<typename K>
-struct TSetIterator
-{
-public:
-
-	FORCEINLINE TSetIterator(TSetBucket<K>* InFirstBucket, TSetBucket<K>* InLastBucket, TSetBucket<K>* InBucket, TSetEntry<K>* InEntry) noexcept :
-		FirstBucket(InFirstBucket), LastBucket(InLastBucket), CurrentBucket(InBucket), CurrentEntry(InEntry)
-	{
-	}
-
-
-public:
-
-	FORCEINLINE K& operator*() noexcept { return CurrentEntry->Key; }
-	FORCEINLINE const K& operator*() const noexcept { return CurrentEntry->Key; }
-
-	FORCEINLINE TSetIterator& operator++() noexcept
-	{
-		if( CurrentBucket->IsEmpty() )
-		{
-			while( CurrentBucket->IsEmpty() && CurrentBucket < LastBucket )
-			{
-				++CurrentBucket;
-			}
-			CurrentEntry = CurrentBucket->begin();
-		}
-		else
-		{
-			++CurrentEntry;
-			if( CurrentEntry >= CurrentBucket->end() )
-			{
-				++CurrentBucket;
-				while( CurrentBucket->IsEmpty() && CurrentBucket < LastBucket )
-				{
-					++CurrentBucket;
-				}
-				CurrentEntry = CurrentBucket->begin();
-			}
-		}
-
-		return *this;
-	}
-	FORCEINLINE TSetIterator operator++(int) noexcept
-	{
-		TMapIterator Tmp = *this;
-		++(*this);
-		return Tmp;
-	}
-	FORCEINLINE TSetIterator& operator--() noexcept
-	{
-		if( CurrentBucket->IsEmpty() )
-		{
-			while( CurrentBucket->IsEmpty() && CurrentBucket > FirstBucket )
-			{
-				--CurrentBucket;
-			}
-			CurrentEntry = CurrentBucket->end() - 1;
-		}
-		else
-		{
-			--CurrentEntry;
-			if( CurrentEntry < CurrentBucket->begin() )
-			{
-				--CurrentBucket;
-				while( CurrentBucket->IsEmpty() && CurrentBucket > FirstBucket )
-				{
-					--CurrentBucket;
-				}
-				CurrentEntry = CurrentBucket->end() - 1;
-			}
-		}
-
-		return *this;
-	}
-	FORCEINLINE TSetIterator operator--(int) noexcept
-	{
-		TMapIterator Tmp = *this;
-		--(*this);
-		return Tmp;
-	}
-
-public:
-
-	FORCEINLINE friend bool operator==(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket && A.CurrentEntry == B.CurrentEntry; }
-	FORCEINLINE friend bool operator!=(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket != B.CurrentBucket || A.CurrentEntry != B.CurrentEntry; }
-
-	FORCEINLINE friend bool operator<(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry < B.CurrentEntry : A.CurrentBucket < B.CurrentBucket; }
-	FORCEINLINE friend bool operator<=(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry <= B.CurrentEntry : A.CurrentBucket <= B.CurrentBucket; }
-
-	FORCEINLINE friend bool operator>(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry > B.CurrentEntry : A.CurrentBucket > B.CurrentBucket; }
-	FORCEINLINE friend bool operator>=(const TSetIterator& A, const TSetIterator& B) noexcept { return A.CurrentBucket == B.CurrentBucket ? A.CurrentEntry >= B.CurrentEntry : A.CurrentBucket >= B.CurrentBucket; }
-
-
-
-private:
-
-	TSetBucket<K>* FirstBucket = nullptr;
-	TSetBucket<K>* LastBucket = nullptr;
-	TSetBucket<K>* CurrentBucket = nullptr;
-	TSetEntry<K>* CurrentEntry = nullptr;
-};
+using TSetIterator = THashTableIterator<K>;
+template<typename K>
+using TSetConstIterator = THashTableIterator<const K>;
 
 /**
 	Engine version of std::unordered_set.
-	It can be faster because it does not use exceptions and can be optimized for specific operations.
+	It can be faster because it does not use exceptions and keeps all keys in one flat allocation probed with SIMD.
+	Keys are compared with operator==, so colliding hashes never alias different keys.
 
-	@see GetTypeHash.
+	@see GetTypeHash, THashTable.
+	@note Remove invalidates iterators and references to other keys.
 */
 template<typename K>
 struct ENGINE_API TSet
 {
-private:
-
-	static const uint64 InitialSize = 17;
-
 public:
 
 	TSet() = default;
-	FORCEINLINE TSet(const TSet& Other) : Size(Other.Size), FillCount(Other.FillCount)
-	{
-		Data = static_cast<TSetBucket<K>*>(FMemory::Malloc(sizeof(TSetBucket<K>) * Size));
-
-		TSetBucket<K>* MyData = Data;
-		TSetBucket<K>* MyDataEnd = Data + Size;
-		TSetBucket<K>* OtherData = Other.Data;
-		while( MyData != MyDataEnd )
-		{
-			MyData->Reserve(OtherData->GetSize());
-			FMemory::MemCpy(MyData->GetData(), OtherData->GetData(), sizeof(TSetEntry<K>) * OtherData->GetSize());
-			++MyData;
-			++OtherData;
-		}
-	}
-	FORCEINLINE TSet(TSet&& Other) noexcept : Data(Other.Data), Size(Other.Size), FillCount(Other.FillCount)
-	{
-		Other.Data = nullptr;
-		Other.Size = 0;
-		Other.FillCount = 0;
-	}
+	TSet(const TSet& Other) = default;
+	TSet(TSet&& Other) noexcept = default;
 	FORCEINLINE TSet(TInitializerList<K> InitList)
 	{
-		Resize(InitialSize * (InitList.Size() / InitialSize + 1));
+		Table.Reserve(static_cast<uint32>(InitList.Size()));
 		for( const K& Key : InitList )
 		{
 			Insert(Key);
 		}
 	}
-	~TSet() { Reset(); }
+	~TSet() = default;
 
 
 public:
 
-	FORCEINLINE TSet& operator=(const TSet& Other) = delete;
-	FORCEINLINE TSet& operator=(TSet&& Other) noexcept
-	{
-		Reset();
-
-		this->Data = Other.Data;
-		this->Size = Other.Size;
-		this->FillCount = Other.FillCount;
-
-		Other.Data = nullptr;
-		Other.Size = 0;
-		Other.FillCount = 0;
-
-		return *this;
-	}
+	TSet& operator=(const TSet& Other) = default;
+	TSet& operator=(TSet&& Other) noexcept = default;
 	FORCEINLINE TSet& operator=(TInitializerList<K> InitList)
 	{
 		Clear();
 
-		Resize(InitialSize * (InitList.Size() / InitialSize + 1));
+		Table.Reserve(static_cast<uint32>(InitList.Size()));
 		for( const K& Key : InitList )
 		{
 			Insert(Key);
@@ -346,166 +73,82 @@ public:
 
 public:
 
-	TSetIterator<K> begin() noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TSetIterator<K> Iter(Data, LastBucket, Data, Data->begin());
-			if( Data->IsEmpty() )
-			{
-				++Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TSetIterator<K>(nullptr, nullptr);
-		}
-	}
-	const TSetIterator<K> begin() const noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TSetIterator<K> Iter(Data, LastBucket, Data, Data->begin());
-			if( Data->IsEmpty() )
-			{
-				++Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TSetIterator<K>(nullptr, nullptr);
-		}
-	}
-	TSetIterator<K> end() noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TSetIterator<K> Iter(Data, LastBucket, LastBucket, LastBucket->end() - 1);
-			if( LastBucket->IsEmpty() )
-			{
-				--Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TSetIterator<K>(nullptr, nullptr);
-		}
-	}
-	const TSetIterator<K> end() const noexcept
-	{
-		if( Data )
-		{
-			TMapBucket<K, V>* LastBucket = Data + Size - 1;
-			TSetIterator<K> Iter(Data, LastBucket, LastBucket, LastBucket->end() - 1);
-			if( LastBucket->IsEmpty() )
-			{
-				--Iter;
-			}
-			return Iter;
-		}
-		else
-		{
-			return TSetIterator<K>(nullptr, nullptr);
-		}
-	}
+	FORCEINLINE TSetIterator<K> begin() noexcept { return Table.begin(); }
+	FORCEINLINE TSetConstIterator<K> begin() const noexcept { return Table.begin(); }
+	FORCEINLINE TSetIterator<K> end() noexcept { return Table.end(); }
+	FORCEINLINE TSetConstIterator<K> end() const noexcept { return Table.end(); }
 
 public:
 
 	/**
 		Check that set is empty.
 	*/
-	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
+	FORCEINLINE bool IsEmpty() const noexcept { return Table.IsEmpty(); }
 	/**
-		@return count of set buckets.
-		@note Size is not equal to real elements count in set.
+		@return count of set elements.
 	*/
-	FORCEINLINE uint32 GetSize() const noexcept { return Size; }
+	FORCEINLINE uint32 GetSize() const noexcept { return Table.Num(); }
+	/**
+		@return count of set elements.
+	*/
+	FORCEINLINE uint32 Num() const noexcept { return Table.Num(); }
+	/**
+		@return count of allocated slots.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Table.GetCapacity(); }
 
 public:
 
 	/**
 		Insert Key.
-		If Key already in set then will override old data.
+		If Key already in set then will have no effect.
 
 		@param Key - The key to insert.
 	*/
 	FORCEINLINE void Insert(K Key)
 	{
-		if( IsEmpty() )
-		{
-			Resize(InitialSize);
-		}
-		else if( FillCount * 2 > Size )
-		{
-			Resize(Size * 2);
-		}
-
-		const uint64 Hash = GetTypeHash(Key);
-		return InsertHash(Hash, MoveTemp(Key));
+		bool bAlreadyExists;
+		Table.FindOrEmplace(Key, bAlreadyExists, MoveTemp(Key));
 	}
 
 	/**
 		Try to find key by key.
-		If key not in map will generate assert error.
+		If key not in set will generate assert error.
 		@see Contains.
 
 		@return reference to key.
 	*/
 	FORCEINLINE K& FindRef(const K& Key) noexcept
 	{
-		const uint64 Hash = GetTypeHash(Key);
-		return FindKeyRefHash(Hash);
+		K* Found = Table.Find(Key);
+		check(Found);
+		return *Found;
 	}
 
 	/**
-		Check that Key is in map.
+		Check that Key is in set.
 	*/
-	FORCEINLINE bool Contains(const K& Key) const noexcept
-	{
-		if( IsEmpty() ) return false;
-		const uint64 Hash = GetTypeHash(Key);
-		return ContainsHash(Hash);
-	}
+	FORCEINLINE bool Contains(const K& Key) const noexcept { return Table.Find(Key) != nullptr; }
 
 	/**
-		Try to remove Key from the map.
-		If Key not in map then will have no effect. 
+		Try to remove Key from the set.
+		If Key not in set then will have no effect.
 	*/
-	FORCEINLINE void Remove(const K& Key)
-	{
-		if( IsEmpty() ) return;
-		const uint64 Hash = GetTypeHash(Key);
-		RemoveHash(Hash);
-	}
+	FORCEINLINE void Remove(const K& Key) { Table.Remove(Key); }
 
 	/**
-		Empty map without physical resizing to 0.
+		Preallocate memory for Number elements.
 	*/
-	FORCEINLINE void Clear()
-	{
-		for( uint32 i = 0; i < Size; ++i )
-		{
-			Data[i].ClearWithDestructors();
-		}
-	}
+	FORCEINLINE void Reserve(uint32 Number) { Table.Reserve(Number); }
+
+	/**
+		Empty set without physical resizing to 0.
+	*/
+	FORCEINLINE void Clear() { Table.Clear(); }
 	/**
 		Physically risize to 0 size.
 	*/
-	FORCEINLINE void Reset()
-	{
-		Clear();
-		if( Data )
-		{
-			FMemory::Free(Data);
-		}
-		Size = 0;
-	}
+	FORCEINLINE void Reset() { Table.Reset(); }
 
 public:
 
@@ -517,95 +160,24 @@ public:
 	template<typename LAMBDA>
 	void ForEach(LAMBDA Lambda)
 	{
-		for( uint32 i = 0; i < Size; ++i )
+		for( K& Key : Table )
 		{
-			for( TSetEntry<K>& Entry : Data[i] )
-			{
-				Lambda(Entry.Key);
-			}
+			Lambda(Key);
 		}
 	}
 
-private:
 
-	FORCEINLINE void InsertHash(uint64 Hash, K&& Key)
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		FillCount += Data[BucketIndex].Insert(MoveTemp(Key), Hash);
-	}
-	FORCEINLINE K& FindKeyRefHash(uint64 Hash) noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		TSetEntry<K>* Entry = Data[BucketIndex].Find(Hash);
-		check(Entry);
-		return Entry->Key;
-	}
-	FORCEINLINE bool ContainsHash(uint64 Hash) const noexcept
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
-
-		return Data[BucketIndex].Contains(Hash);
-	}
-	FORCEINLINE void RemoveHash(uint64 Hash)
-	{
-		const uint64 BucketIndex = GetBucketIndex(Hash);
 
-		TSetBucket<K>& Bucket = Data[BucketIndex];
-		if( !Bucket.IsEmpty() )
-		{
-			Bucket.Remove(Hash);
-			FillCount -= Bucket.IsEmpty();
-		}
-	}
+private:
 
-	FORCEINLINE uint64 GetBucketIndex(uint64 Hash) const noexcept
-	{
-		check(Size != 0);
-		const uint64 BucketIndex = Hash % Size;
-	}
+	THashTable<K, TSetKeyFuncs<K>> Table;
+};
 
-	void Resize(uint32 NewSize)
+template<typename K>
+struct TIsTriviallyRelocatable<TSet<K>>
+{
+	enum
 	{
-		if( NewSize <= Size ) return;
-
-		TSetBucket<K>* NewData = static_cast<TSetBucket<K>*>(FMemory::Malloc(sizeof(TSetBucket<K>) * NewSize));
-		DefaultConstructItems(NewData, NewSize);
-
-		FillCount = 0;
-		if( Data )
-		{
-			for( uint32 i = 0; i < Size; ++i )
-			{
-				for( TSetEntry<K>& Entry : Data[i] )
-				{
-					const uint64 BucketIndex = GetBucketIndex(Entry.Hash);
-					FillCount += NewData[BucketIndex].Insert(MoveTemp(Entry.Key), Entry.Hash);
-				}
-
-				Data[i].Clear();
-			}
-			FMemory::Free(Data);
-		}
-		Size = NewSize;
-		Data = NewData;
-	}
-
-
-
-private:
-
-	/**
-		Set buckets.
-	*/
-	TSetBucket<K>* Data = nullptr;
-	/**
-		Count of buckets.
-	*/
-	uint32 Size = 0;
-	/**
-		Count of non-empty buckets.
-	*/
-	uint32 FillCount = 0;
-};
\ No newline at end of file
+		Value = true
+	};
+};
@@ -0,0 +1,416 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemory.h"
+#include "MemoryOps.h"
+#include "AssertionMacros.h"
+#include "MoveSemantic.h"
+
+#include <new>
+
+
+
+
+namespace SoAArray_Private
+{
+/**
+	Minimal alignment of each column, enough for aligned SSE and AVX loads.
+*/
+static constexpr SIZE_T MinColumnAlignment = 32;
+
+template<SIZE_T Alignment>
+FORCEINLINE SIZE_T AlignOffset(SIZE_T Offset) noexcept
+{
+	return (Offset + Alignment - 1) & ~(Alignment - 1);
+}
+
+/**
+	Type of field at Index in Fields pack.
+*/
+template<uint32 Index, typename... Fields>
+struct TNthType;
+template<typename First, typename... Rest>
+struct TNthType<0, First, Rest...>
+{
+	using Type = First;
+};
+template<uint32 Index, typename First, typename... Rest>
+struct TNthType<Index, First, Rest...>
+{
+	using Type = typename TNthType<Index - 1, Rest...>::Type;
+};
+
+/**
+	Operations applied to every column, first column is Columns[0].
+*/
+template<typename... Fields>
+struct TColumnOps
+{
+	static constexpr SIZE_T MaxAlignment = MinColumnAlignment;
+
+	static FORCEINLINE SIZE_T Layout(void** Columns, uint8* Base, uint32 Capacity, SIZE_T Offset) noexcept { return Offset; }
+	static FORCEINLINE void Destruct(void** Columns, uint32 Start, uint32 Count) noexcept { }
+	static FORCEINLINE void Relocate(void** Dest, void** Source, uint32 Count) noexcept { }
+	static FORCEINLINE void CopyConstruct(void** Dest, void* const* Source, uint32 Count) { }
+	static FORCEINLINE void DefaultConstruct(void** Columns, uint32 Index) { }
+	static FORCEINLINE void Construct(void** Columns, uint32 Index) { }
+	static FORCEINLINE void MoveOver(void** Columns, uint32 To, uint32 From) noexcept { }
+};
+
+template<typename First, typename... Rest>
+struct TColumnOps<First, Rest...>
+{
+	static constexpr SIZE_T ColumnAlignment = alignof(First) > MinColumnAlignment ? alignof(First) : MinColumnAlignment;
+	static constexpr SIZE_T MaxAlignment = ColumnAlignment > TColumnOps<Rest...>::MaxAlignment ? ColumnAlignment : TColumnOps<Rest...>::MaxAlignment;
+
+	/**
+		Place each column at aligned offset from Base.
+
+		@return size of all columns in bytes.
+	*/
+	static FORCEINLINE SIZE_T Layout(void** Columns, uint8* Base, uint32 Capacity, SIZE_T Offset) noexcept
+	{
+		Offset = AlignOffset<ColumnAlignment>(Offset);
+		Columns[0] = Base != nullptr ? Base + Offset : nullptr;
+		return TColumnOps<Rest...>::Layout(Columns + 1, Base, Capacity, Offset + sizeof(First) * Capacity);
+	}
+
+	static FORCEINLINE void Destruct(void** Columns, uint32 Start, uint32 Count) noexcept
+	{
+		DestructItems(static_cast<First*>(Columns[0]) + Start, Count);
+		TColumnOps<Rest...>::Destruct(Columns + 1, Start, Count);
+	}
+
+	static FORCEINLINE void Relocate(void** Dest, void** Source, uint32 Count) noexcept
+	{
+		RelocateConstructItems<First>(Dest[0], static_cast<First*>(Source[0]), Count);
+		TColumnOps<Rest...>::Relocate(Dest + 1, Source + 1, Count);
+	}
+
+	static FORCEINLINE void CopyConstruct(void** Dest, void* const* Source, uint32 Count)
+	{
+		ConstructItems<First>(Dest[0], static_cast<const First*>(Source[0]), Count);
+		TColumnOps<Rest...>::CopyConstruct(Dest + 1, Source + 1, Count);
+	}
+
+	static FORCEINLINE void DefaultConstruct(void** Columns, uint32 Index)
+	{
+		new(static_cast<First*>(Columns[0]) + Index) First();
+		TColumnOps<Rest...>::DefaultConstruct(Columns + 1, Index);
+	}
+
+	template<typename ArgFirst, typename... ArgRest>
+	static FORCEINLINE void Construct(void** Columns, uint32 Index, ArgFirst&& Value, ArgRest&&... Values)
+	{
+		new(static_cast<First*>(Columns[0]) + Index) First(Forward<ArgFirst>(Value));
+		TColumnOps<Rest...>::Construct(Columns + 1, Index, Forward<ArgRest>(Values)...);
+	}
+
+	/**
+		Destroy element at To and relocate element at From into its place.
+	*/
+	static FORCEINLINE void MoveOver(void** Columns, uint32 To, uint32 From) noexcept
+	{
+		First* Column = static_cast<First*>(Columns[0]);
+		DestructItem(Column + To);
+		if( To != From )
+		{
+			RelocateConstructItems<First>(Column + To, Column + From, 1);
+		}
+		TColumnOps<Rest...>::MoveOver(Columns + 1, To, From);
+	}
+};
+} // namespace SoAArray_Private
+
+
+
+/**
+	Array of structures stored as structure of arrays.
+	Each field lives in its own column aligned to at least 32 bytes, so loops over one field read only that field
+	and SIMD kernels can use aligned loads on column start.
+	All columns share one allocation and always have the same size.
+
+	e.g.
+	TSoAArray<FVector2D, FVector2D, float> Bodies; // location, velocity, mass
+	Bodies.Add(Location, Velocity, 1.0f);
+	FVector2D* Locations = Bodies.GetColumn<0>();
+*/
+template<typename... Fields>
+struct TSoAArray
+{
+	static_assert(sizeof...(Fields) > 0, "TSoAArray needs at least one field");
+
+	using ColumnOps = SoAArray_Private::TColumnOps<Fields...>;
+
+public:
+
+	static constexpr uint32 NumFields = sizeof...(Fields);
+
+	template<uint32 FieldIndex>
+	using TFieldType = typename SoAArray_Private::TNthType<FieldIndex, Fields...>::Type;
+
+	/**
+		Reference to one row of array. Fields are accessed by index, e.g Row.Get<1>().
+	*/
+	template<typename ArrayType>
+	struct TRowRef
+	{
+		ArrayType& Owner;
+		uint32 Index;
+
+		template<uint32 FieldIndex>
+		FORCEINLINE auto& Get() const
+		{
+			return Owner.template Get<FieldIndex>(Index);
+		}
+	};
+
+public:
+
+	TSoAArray() = default;
+	FORCEINLINE TSoAArray(const TSoAArray& Other)
+	{
+		Reserve(Other.Size);
+		ColumnOps::CopyConstruct(Columns, Other.Columns, Other.Size);
+		Size = Other.Size;
+	}
+	FORCEINLINE TSoAArray(TSoAArray&& Other) noexcept { MoveFrom(Other); }
+	FORCEINLINE ~TSoAArray() { Reset(); }
+
+
+public:
+
+	FORCEINLINE TSoAArray& operator=(const TSoAArray& Other)
+	{
+		if( &Other == this ) return *this;
+
+		Clear();
+		Reserve(Other.Size);
+		ColumnOps::CopyConstruct(Columns, Other.Columns, Other.Size);
+		Size = Other.Size;
+		return *this;
+	}
+	FORCEINLINE TSoAArray& operator=(TSoAArray&& Other) noexcept
+	{
+		if( &Other == this ) return *this;
+
+		Reset();
+		MoveFrom(Other);
+		return *this;
+	}
+
+	FORCEINLINE TRowRef<TSoAArray> operator[](uint32 Index)
+	{
+		check(Index < Size);
+		return TRowRef<TSoAArray> {*this, Index};
+	}
+	FORCEINLINE TRowRef<const TSoAArray> operator[](uint32 Index) const
+	{
+		check(Index < Size);
+		return TRowRef<const TSoAArray> {*this, Index};
+	}
+
+public:
+
+	/**
+		@return pointer to first element of field column, aligned to at least 32 bytes.
+	*/
+	template<uint32 FieldIndex>
+	FORCEINLINE TFieldType<FieldIndex>* GetColumn() noexcept
+	{
+		return static_cast<TFieldType<FieldIndex>*>(Columns[FieldIndex]);
+	}
+	template<uint32 FieldIndex>
+	FORCEINLINE const TFieldType<FieldIndex>* GetColumn() const noexcept
+	{
+		return static_cast<const TFieldType<FieldIndex>*>(Columns[FieldIndex]);
+	}
+
+	/**
+		Access field of element at Index.
+	*/
+	template<uint32 FieldIndex>
+	FORCEINLINE TFieldType<FieldIndex>& Get(uint32 Index)
+	{
+		check(Index < Size);
+		return GetColumn<FieldIndex>()[Index];
+	}
+	template<uint32 FieldIndex>
+	FORCEINLINE const TFieldType<FieldIndex>& Get(uint32 Index) const
+	{
+		check(Index < Size);
+		return GetColumn<FieldIndex>()[Index];
+	}
+
+	/**
+		@return Count of elements in the array.
+	*/
+	FORCEINLINE uint32 Num() const noexcept { return Size; }
+	/**
+		@return Count of elements in the array.
+	*/
+	FORCEINLINE uint32 GetSize() const noexcept { return Size; }
+	/**
+		@return Allocated memory for elements count.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Capacity; }
+	/**
+		Check that array is empty.
+	*/
+	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
+
+public:
+
+	/**
+		Add element constructed from one value per field.
+
+		@return index of the new element.
+	*/
+	template<typename... ArgsType>
+	FORCEINLINE uint32 Emplace(ArgsType&&... Args)
+	{
+		static_assert(sizeof...(ArgsType) == NumFields, "TSoAArray::Emplace needs one value per field");
+
+		Grow();
+		ColumnOps::Construct(Columns, Size, Forward<ArgsType>(Args)...);
+		return Size++;
+	}
+	/**
+		Add element from one value per field.
+
+		@return index of the new element.
+	*/
+	FORCEINLINE uint32 Add(const Fields&... Values) { return Emplace(Values...); }
+	/**
+		Add element with value initialized fields.
+
+		@return index of the new element.
+	*/
+	FORCEINLINE uint32 AddDefaulted()
+	{
+		Grow();
+		ColumnOps::DefaultConstruct(Columns, Size);
+		return Size++;
+	}
+
+	/**
+		Remove element at index and move last element in its place in all columns.
+	*/
+	FORCEINLINE void RemoveAtSwap(uint32 Index)
+	{
+		check(Index < Size);
+		--Size;
+		ColumnOps::MoveOver(Columns, Index, Size);
+	}
+	/**
+		Remove last element.
+	*/
+	FORCEINLINE void PopBack()
+	{
+		check(Size > 0);
+		--Size;
+		ColumnOps::Destruct(Columns, Size, 1);
+	}
+
+	/**
+		Allocate memory for Number elements in every column.
+	*/
+	void Reserve(uint32 Number)
+	{
+		if( Number <= Capacity ) return;
+
+		void* NewColumns[NumFields];
+		const SIZE_T Bytes = ColumnOps::Layout(NewColumns, nullptr, Number, 0);
+		uint8* NewAllocation = static_cast<uint8*>(FMemory::Malloc(Bytes + ColumnOps::MaxAlignment));
+		uint8* NewBase = reinterpret_cast<uint8*>(SoAArray_Private::AlignOffset<ColumnOps::MaxAlignment>(reinterpret_cast<SIZE_T>(NewAllocation)));
+		ColumnOps::Layout(NewColumns, NewBase, Number, 0);
+
+		if( Allocation != nullptr )
+		{
+			ColumnOps::Relocate(NewColumns, Columns, Size);
+			FMemory::Free(Allocation);
+		}
+
+		Allocation = NewAllocation;
+		for( uint32 i = 0; i < NumFields; ++i )
+		{
+			Columns[i] = NewColumns[i];
+		}
+		Capacity = Number;
+	}
+
+	/**
+		Empty array without physical resizing to 0.
+	*/
+	FORCEINLINE void Clear()
+	{
+		if( Size == 0 ) return;
+
+		ColumnOps::Destruct(Columns, 0, Size);
+		Size = 0;
+	}
+	/**
+		Physically risize to 0 size.
+	*/
+	FORCEINLINE void Reset()
+	{
+		Clear();
+		FMemory::Free(Allocation);
+		Allocation = nullptr;
+		for( uint32 i = 0; i < NumFields; ++i )
+		{
+			Columns[i] = nullptr;
+		}
+		Capacity = 0;
+	}
+
+
+
+private:
+
+	FORCEINLINE void Grow()
+	{
+		if( Size == Capacity )
+		{
+			Reserve(Capacity == 0 ? 16 : Capacity * 2);
+		}
+	}
+
+	FORCEINLINE void MoveFrom(TSoAArray& Other) noexcept
+	{
+		Allocation = Other.Allocation;
+		Size = Other.Size;
+		Capacity = Other.Capacity;
+		for( uint32 i = 0; i < NumFields; ++i )
+		{
+			Columns[i] = Other.Columns[i];
+			Other.Columns[i] = nullptr;
+		}
+
+		Other.Allocation = nullptr;
+		Other.Size = 0;
+		Other.Capacity = 0;
+	}
+
+
+
+private:
+
+	/**
+		Start of each column inside Allocation.
+	*/
+	void* Columns[NumFields] = {};
+	/**
+		Memory of all columns, not aligned.
+	*/
+	uint8* Allocation = nullptr;
+	/**
+		Count of elements in the array.
+	*/
+	uint32 Size = 0;
+	/**
+		Allocated memory for elements count.
+	*/
+	uint32 Capacity = 0;
+};
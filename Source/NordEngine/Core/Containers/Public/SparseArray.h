@@ -0,0 +1,422 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMath.h"
+#include "MemoryOps.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "MoveSemantic.h"
+#include "TypeCompatibleBytes.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
+#include "Array.h"
+
+#include <new>
+
+
+
+
+/**
+	Slot of sparse array. Holds element when allocated, otherwise link to the next free slot.
+*/
+template<typename T>
+union TSparseArrayElement
+{
+	TTypeCompatibleBytes<T> ElementData;
+	int32 NextFreeIndex;
+};
+
+/**
+	Sparse array iterator. Skips free slots by scanning allocation bits.
+*/
+template<typename ElementType, typename SlotType>
+struct TSparseArrayIterator
+{
+public:
+
+	FORCEINLINE TSparseArrayIterator(const uint32* InAllocationFlags, SlotType* InSlots, uint32 InIndex, uint32 InMaxIndex) noexcept :
+		AllocationFlags(InAllocationFlags), Slots(InSlots), Index(InIndex), MaxIndex(InMaxIndex)
+	{
+		Index = FindNextAllocated(Index);
+	}
+
+
+public:
+
+	FORCEINLINE ElementType& operator*() const noexcept { return *reinterpret_cast<ElementType*>(&Slots[Index]); }
+	FORCEINLINE ElementType* operator->() const noexcept { return reinterpret_cast<ElementType*>(&Slots[Index]); }
+
+	FORCEINLINE TSparseArrayIterator& operator++() noexcept
+	{
+		Index = FindNextAllocated(Index + 1);
+		return *this;
+	}
+	FORCEINLINE TSparseArrayIterator operator++(int) noexcept
+	{
+		TSparseArrayIterator Tmp = *this;
+		++(*this);
+		return Tmp;
+	}
+
+	/**
+		@return index of current element in sparse array.
+	*/
+	FORCEINLINE uint32 GetIndex() const noexcept { return Index; }
+
+public:
+
+	FORCEINLINE friend bool operator==(const TSparseArrayIterator& A, const TSparseArrayIterator& B) noexcept { return A.Index == B.Index && A.Slots == B.Slots; }
+	FORCEINLINE friend bool operator!=(const TSparseArrayIterator& A, const TSparseArrayIterator& B) noexcept { return A.Index != B.Index || A.Slots != B.Slots; }
+
+
+
+private:
+
+	/**
+		@return first allocated index starting from Start, or MaxIndex.
+	*/
+	FORCEINLINE uint32 FindNextAllocated(uint32 Start) const noexcept
+	{
+		while( Start < MaxIndex )
+		{
+			const uint32 Word = AllocationFlags[Start / 32] & (~0u << (Start % 32));
+			if( Word != 0 )
+			{
+				const uint32 Found = (Start & ~31u) + FMath::CountTrailingZeros(Word);
+				return Found < MaxIndex ? Found : MaxIndex;
+			}
+			Start = (Start & ~31u) + 32;
+		}
+		return MaxIndex;
+	}
+
+
+
+private:
+
+	const uint32* AllocationFlags = nullptr;
+	SlotType* Slots = nullptr;
+	uint32 Index = 0;
+	uint32 MaxIndex = 0;
+};
+
+
+
+/**
+	Array with stable indices.
+	Removed elements leave holes that are linked into free list and reused by next additions,
+	so add and remove are O(1) and never move other elements.
+	Allocated slots are tracked with bitmask, iteration skips holes by bit scan.
+
+	@note Growth relocates elements, so pointers to elements are invalidated while indices are not.
+*/
+template<typename T>
+struct TSparseArray
+{
+public:
+
+	using SlotType = TSparseArrayElement<T>;
+
+public:
+
+	TSparseArray() = default;
+	FORCEINLINE TSparseArray(const TSparseArray& Other) { CopyFrom(Other); }
+	FORCEINLINE TSparseArray(TSparseArray&& Other) noexcept :
+		Data(MoveTemp(Other.Data)), AllocationFlags(MoveTemp(Other.AllocationFlags)), FirstFreeIndex(Other.FirstFreeIndex), NumFreeIndices(Other.NumFreeIndices)
+	{
+		Other.FirstFreeIndex = INDEX_NONE;
+		Other.NumFreeIndices = 0;
+	}
+	FORCEINLINE ~TSparseArray() { Clear(); }
+
+
+public:
+
+	FORCEINLINE TSparseArray& operator=(const TSparseArray& Other)
+	{
+		if( &Other == this ) return *this;
+
+		Reset();
+		CopyFrom(Other);
+		return *this;
+	}
+	FORCEINLINE TSparseArray& operator=(TSparseArray&& Other) noexcept
+	{
+		if( &Other == this ) return *this;
+
+		Reset();
+		Data = MoveTemp(Other.Data);
+		AllocationFlags = MoveTemp(Other.AllocationFlags);
+		FirstFreeIndex = Other.FirstFreeIndex;
+		NumFreeIndices = Other.NumFreeIndices;
+
+		Other.FirstFreeIndex = INDEX_NONE;
+		Other.NumFreeIndices = 0;
+		return *this;
+	}
+
+public:
+
+	FORCEINLINE T& operator[](uint32 Index)
+	{
+		checkf(IsValidIndex(Index), TEXT("Sparse array index is not allocated"));
+		return *Data[Index].ElementData.GetTypedPtr();
+	}
+	FORCEINLINE const T& operator[](uint32 Index) const
+	{
+		checkf(IsValidIndex(Index), TEXT("Sparse array index is not allocated"));
+		return *Data[Index].ElementData.GetTypedPtr();
+	}
+
+public:
+
+	FORCEINLINE TSparseArrayIterator<T, SlotType> begin() noexcept { return TSparseArrayIterator<T, SlotType>(AllocationFlags.GetData(), Data.GetData(), 0, Data.Num()); }
+	FORCEINLINE TSparseArrayIterator<const T, const SlotType> begin() const noexcept
+	{
+		return TSparseArrayIterator<const T, const SlotType>(AllocationFlags.GetData(), Data.GetData(), 0, Data.Num());
+	}
+	FORCEINLINE TSparseArrayIterator<T, SlotType> end() noexcept { return TSparseArrayIterator<T, SlotType>(AllocationFlags.GetData(), Data.GetData(), Data.Num(), Data.Num()); }
+	FORCEINLINE TSparseArrayIterator<const T, const SlotType> end() const noexcept
+	{
+		return TSparseArrayIterator<const T, const SlotType>(AllocationFlags.GetData(), Data.GetData(), Data.Num(), Data.Num());
+	}
+
+public:
+
+	/**
+		@return count of allocated elements.
+	*/
+	FORCEINLINE uint32 Num() const noexcept { return Data.Num() - NumFreeIndices; }
+	/**
+		@return count of allocated elements.
+	*/
+	FORCEINLINE uint32 GetSize() const noexcept { return Num(); }
+	/**
+		@return upper bound of allocated indices.
+	*/
+	FORCEINLINE uint32 GetMaxIndex() const noexcept { return Data.Num(); }
+	/**
+		@return count of slots that can be used without reallocation.
+	*/
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Data.GetCapacity(); }
+	/**
+		Check that array has no allocated elements.
+	*/
+	FORCEINLINE bool IsEmpty() const noexcept { return Num() == 0; }
+	/**
+		Check that element at Index is allocated.
+	*/
+	FORCEINLINE bool IsValidIndex(uint32 Index) const noexcept { return Index < Data.Num() && IsAllocated(Index); }
+
+public:
+
+	/**
+		Construct new element in-place in free slot.
+
+		@return stable index of the new element.
+	*/
+	template<typename... ArgsType>
+	FORCEINLINE uint32 Emplace(ArgsType&&... Args)
+	{
+		const uint32 Index = AddUninitialized();
+		new(Data[Index].ElementData.GetTypedPtr()) T(Forward<ArgsType>(Args)...);
+		return Index;
+	}
+	/**
+		Add Elem to free slot.
+
+		@return stable index of the new element.
+	*/
+	FORCEINLINE uint32 Add(const T& Elem) { return Emplace(Elem); }
+	FORCEINLINE uint32 Add(T&& Elem) { return Emplace(MoveTemp(Elem)); }
+
+	/**
+		Allocate slot without construction. Caller must construct element before use.
+
+		@return stable index of the slot.
+	*/
+	uint32 AddUninitialized()
+	{
+		uint32 Index;
+		if( NumFreeIndices > 0 )
+		{
+			Index = static_cast<uint32>(FirstFreeIndex);
+			FirstFreeIndex = Data[Index].NextFreeIndex;
+			--NumFreeIndices;
+		}
+		else
+		{
+			Index = Data.Num();
+			if( Index == Data.GetCapacity() )
+			{
+				// Non relocatable elements rebuild storage on growth, so grow geometrically to keep add amortized O(1)
+				ReserveSlots(FMath::Max(MinSlots, Index * 2));
+			}
+			Data.AddUninitialized();
+			if( Index % 32 == 0 )
+			{
+				AllocationFlags.Add(0);
+			}
+		}
+
+		AllocationFlags[Index / 32] |= 1u << (Index % 32);
+		return Index;
+	}
+
+	/**
+		Destroy element at Index and put its slot into free list.
+	*/
+	void RemoveAt(uint32 Index)
+	{
+		checkf(IsValidIndex(Index), TEXT("Sparse array index is not allocated"));
+
+		DestructItem(Data[Index].ElementData.GetTypedPtr());
+		AllocationFlags[Index / 32] &= ~(1u << (Index % 32));
+
+		Data[Index].NextFreeIndex = FirstFreeIndex;
+		FirstFreeIndex = static_cast<int32>(Index);
+		++NumFreeIndices;
+	}
+
+	/**
+		Preallocate memory for Number slots.
+	*/
+	FORCEINLINE void Reserve(uint32 Number) { ReserveSlots(Number); }
+
+	/**
+		Destroy all elements without physical resizing to 0.
+		Indices of removed elements can be reused.
+	*/
+	void Clear()
+	{
+		for( T& Elem : *this )
+		{
+			DestructItem(&Elem);
+		}
+		Data.Clear();
+		AllocationFlags.Clear();
+		FirstFreeIndex = INDEX_NONE;
+		NumFreeIndices = 0;
+	}
+	/**
+		Physically risize to 0 size.
+	*/
+	FORCEINLINE void Reset()
+	{
+		Clear();
+		Data.Reset();
+		AllocationFlags.Reset();
+	}
+
+public:
+
+	/**
+		Fast iterate over each element.
+
+		@param Lambda - lambda , e.g [](uint32 Index, T& Elem) {}
+	*/
+	template<typename LAMBDA>
+	void ForEach(LAMBDA Lambda)
+	{
+		for( TSparseArrayIterator<T, SlotType> It = begin(); It != end(); ++It )
+		{
+			Lambda(It.GetIndex(), *It);
+		}
+	}
+
+
+
+private:
+
+	/**
+		Smallest count of slots allocated by add.
+	*/
+	static constexpr uint32 MinSlots = 16;
+
+private:
+
+	FORCEINLINE bool IsAllocated(uint32 Index) const noexcept { return (AllocationFlags[Index / 32] & (1u << (Index % 32))) != 0; }
+
+	/**
+		Grow storage to hold Number slots, allocation flags are reserved for the same count.
+		Slots are plain bytes for TArray, so elements that can not be moved by memcpy are relocated here one by one.
+	*/
+	void ReserveSlots(uint32 Number)
+	{
+		if( Number <= Data.GetCapacity() ) return;
+
+		AllocationFlags.Reserve((Number + 31) / 32);
+		if( TIsTriviallyRelocatable<T>::Value )
+		{
+			Data.Reserve(Number);
+			return;
+		}
+
+		TArray<SlotType> NewData;
+		NewData.Reserve(Number);
+		NewData.AddUninitialized(Data.Num());
+		for( uint32 i = 0; i < Data.Num(); ++i )
+		{
+			if( IsAllocated(i) )
+			{
+				RelocateConstructItems<T>(NewData[i].ElementData.GetTypedPtr(), Data[i].ElementData.GetTypedPtr(), 1);
+			}
+			else
+			{
+				NewData[i].NextFreeIndex = Data[i].NextFreeIndex;
+			}
+		}
+		Data = MoveTemp(NewData);
+	}
+
+	void CopyFrom(const TSparseArray& Other)
+	{
+		Data.Reserve(Other.Data.Num());
+		Data.AddUninitialized(Other.Data.Num());
+		AllocationFlags = Other.AllocationFlags;
+		FirstFreeIndex = Other.FirstFreeIndex;
+		NumFreeIndices = Other.NumFreeIndices;
+
+		for( uint32 i = 0; i < Data.Num(); ++i )
+		{
+			if( IsAllocated(i) )
+			{
+				new(Data[i].ElementData.GetTypedPtr()) T(*Other.Data[i].ElementData.GetTypedPtr());
+			}
+			else
+			{
+				Data[i].NextFreeIndex = Other.Data[i].NextFreeIndex;
+			}
+		}
+	}
+
+
+
+private:
+
+	/**
+		Slots storage, both allocated and free.
+	*/
+	TArray<SlotType> Data;
+	/**
+		One bit per slot, set for allocated slots.
+	*/
+	TArray<uint32> AllocationFlags;
+	/**
+		Head of free slots list.
+	*/
+	int32 FirstFreeIndex = INDEX_NONE;
+	/**
+		Count of free slots.
+	*/
+	uint32 NumFreeIndices = 0;
+};
+
+template<typename T>
+struct TIsTriviallyRelocatable<TSparseArray<T>>
+{
+	enum
+	{
+		Value = true
+	};
+};
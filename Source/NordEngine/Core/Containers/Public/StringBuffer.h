@@ -4,18 +4,38 @@
 #include "GenericPlatform.h"
 #include "GenericPlatformString.h"
 #include "EngineMemory.h"
+#include "MemoryTracker.h"
+#include "EngineMath.h"
 
 
 
 
+/**
+	String storage with small string optimization.
+	Short strings live in inline buffer that shares memory with heap pointer, longer strings spill to heap.
+	Buffer is on heap only when BufferSize > InlineCapacity, so no extra flag is stored.
+
+	@note Inline buffer is addressed by offset, never by stored pointer, so buffer can be relocated with memcpy.
+*/
 struct ENGINE_API FStringBuffer
 {
 public:
 
-	FStringBuffer() = default;
+	/**
+		Total size of buffer object in bytes.
+	*/
+	static constexpr uint32 FootprintSize = 32;
+	/**
+		Max count of chars that can be stored without heap allocation.
+	*/
+	static constexpr uint32 InlineCapacity = (FootprintSize - 2 * sizeof(uint32)) / sizeof(TCHAR) - 1;
+
+public:
+
+	FORCEINLINE FStringBuffer() noexcept { InlineBuffer[0] = '\0'; }
 	FStringBuffer(const FStringBuffer& Other) = delete;
-	FORCEINLINE FStringBuffer(FStringBuffer&& Other) noexcept : str(Other.str), StringLength(Other.StringLength), BufferSize(Other.BufferSize) { Other.Clear(); }
-	FORCEINLINE explicit FStringBuffer(uint32 Size) noexcept { Resize(Size); }
+	FORCEINLINE FStringBuffer(FStringBuffer&& Other) noexcept { MoveFrom(Other); }
+	FORCEINLINE explicit FStringBuffer(uint32 Size) noexcept : FStringBuffer() { Resize(Size); }
 	FORCEINLINE ~FStringBuffer() noexcept { Reset(); }
 
 
@@ -24,50 +44,48 @@ public:
 	FStringBuffer& operator=(const FStringBuffer& Other) = delete;
 	FORCEINLINE FStringBuffer& operator=(FStringBuffer&& Other) noexcept
 	{
-		if( str != nullptr )
-		{
-			FMemory::Free(str);
-		}
+		if( this == &Other ) return *this;
 
-		str = Other.str;
-		StringLength = Other.StringLength;
-		BufferSize = Other.BufferSize;
-
-		Other.Clear();
+		Reset();
+		MoveFrom(Other);
 
 		return *this;
 	}
 
 public:
 
-	FORCEINLINE TCHAR& operator[](uint32 Index) { return str[Index]; }
-	FORCEINLINE TCHAR operator[](uint32 Index) const { return str[Index]; }
+	FORCEINLINE TCHAR& operator[](uint32 Index) { return GetBuffer()[Index]; }
+	FORCEINLINE TCHAR operator[](uint32 Index) const { return GetBuffer()[Index]; }
 
 public:
 
-	FORCEINLINE const TCHAR* begin() const noexcept { return str; }
-	FORCEINLINE TCHAR* begin() noexcept { return str; }
-	FORCEINLINE const TCHAR* end() const noexcept { return str + StringLength; }
-	FORCEINLINE TCHAR* end() noexcept { return str + StringLength; }
+	FORCEINLINE const TCHAR* begin() const noexcept { return GetBuffer(); }
+	FORCEINLINE TCHAR* begin() noexcept { return GetBuffer(); }
+	FORCEINLINE const TCHAR* end() const noexcept { return GetBuffer() + StringLength; }
+	FORCEINLINE TCHAR* end() noexcept { return GetBuffer() + StringLength; }
 
 public:
 
 	/**
 		@return char at given position in the buffer by pointer.
 	*/
-	FORCEINLINE TCHAR* GetAtByPointer(uint32 Index) const { return &str[Index]; }
+	FORCEINLINE TCHAR* GetAtByPointer(uint32 Index) const { return GetBuffer() + Index; }
 
 	/**
 		Resize string by new length and null terminate it.
+		Growth is geometric, so appending char by char is amortized O(1).
 	*/
 	FORCEINLINE void Resize(uint32 NewStringLength) noexcept
 	{
 		if( StringLength == NewStringLength ) return;
 
+		if( NewStringLength > BufferSize )
+		{
+			Reserve(FMath::Max(NewStringLength, BufferSize * 2));
+		}
 		StringLength = NewStringLength;
-		Reserve(StringLength * 2);
 
-		str[StringLength] = '\0';
+		GetBuffer()[StringLength] = '\0';
 	}
 	/**
 		Allocate memory for buffer.
@@ -75,51 +93,51 @@ public:
 	FORCEINLINE void Reserve(uint32 NewBufferSize) noexcept
 	{
 		if( NewBufferSize <= BufferSize ) return;
-		
-		BufferSize = NewBufferSize;
 
-		if( str != nullptr )
+		MEMORY_TAG_SCOPE(Strings);
+		if( IsInline() )
 		{
-			str = static_cast<TCHAR*>(FMemory::Realloc(str, BufferSize + 1));
+			TCHAR* NewBuffer = static_cast<TCHAR*>(FMemory::Malloc(sizeof(TCHAR) * (NewBufferSize + 1)));
+			FMemory::MemCpy(NewBuffer, InlineBuffer, sizeof(TCHAR) * (StringLength + 1));
+			HeapBuffer = NewBuffer;
 		}
 		else
 		{
-			str = static_cast<TCHAR*>(FMemory::Malloc(BufferSize + 1));
+			HeapBuffer = static_cast<TCHAR*>(FMemory::Realloc(HeapBuffer, sizeof(TCHAR) * (NewBufferSize + 1)));
 		}
+
+		BufferSize = NewBufferSize;
 	}
 	/**
-		Manual set by buffer.
+		Manual set by buffer. Takes ownership of heap allocated NewBuffer.
 	*/
-	FORCEINLINE void SetBuffer(TCHAR* NewBuffer) noexcept
+	FORCEINLINE void SetBuffer(TCHAR* NewBuffer) noexcept { SetBuffer(NewBuffer, FPlatformString::Strlen(NewBuffer)); }
+	FORCEINLINE void SetBuffer(TCHAR* NewBuffer, uint32 Size) noexcept
 	{
-		StringLength = BufferSize = FPlatformString::Strlen(NewBuffer);
+		Reset();
 
-		if( str != nullptr )
+		if( Size <= InlineCapacity )
 		{
-			FMemory::Free(str);
+			FMemory::MemCpy(InlineBuffer, NewBuffer, sizeof(TCHAR) * Size);
+			InlineBuffer[Size] = '\0';
+			FMemory::Free(NewBuffer);
 		}
-
-		str = NewBuffer;
-	}
-	FORCEINLINE void SetBuffer(TCHAR* NewBuffer, uint32 Size) noexcept
-	{
-		StringLength = BufferSize = Size;
-
-		if( str != nullptr )
+		else
 		{
-			FMemory::Free(str);
+			HeapBuffer = NewBuffer;
+			BufferSize = Size;
 		}
 
-		str = NewBuffer;
+		StringLength = Size;
 	}
 	/**
 		It will delete stored string.
 	*/
 	FORCEINLINE void Reset() noexcept
 	{
-		if( str != nullptr )
+		if( !IsInline() )
 		{
-			FMemory::Free(str);
+			FMemory::Free(HeapBuffer);
 		}
 
 		Clear();
@@ -129,25 +147,53 @@ public:
 	*/
 	FORCEINLINE void Clear() noexcept
 	{
-		str = nullptr;
+		InlineBuffer[0] = '\0';
 		StringLength = 0;
-		BufferSize = 0;
+		BufferSize = InlineCapacity;
 	}
 
 public:
 
-	FORCEINLINE TCHAR* const GetBuffer() const noexcept { return str; }
+	FORCEINLINE TCHAR* const GetBuffer() const noexcept { return IsInline() ? const_cast<TCHAR*>(InlineBuffer) : HeapBuffer; }
 	FORCEINLINE uint32 GetLength() const noexcept { return StringLength; }
 	FORCEINLINE uint32 GetBufferSize() const noexcept { return BufferSize; }
+	/**
+		Check that string is stored in inline buffer.
+	*/
+	FORCEINLINE bool IsInline() const noexcept { return BufferSize <= InlineCapacity; }
 
 
 
 private:
 
 	/**
-		String buffer.
+		Take Other content as is: inline chars or heap pointer. Other becomes empty.
 	*/
-	TCHAR* str = nullptr;
+	FORCEINLINE void MoveFrom(FStringBuffer& Other) noexcept
+	{
+		// Inline buffer covers heap pointer too
+		FMemory::MemCpy(InlineBuffer, Other.InlineBuffer, sizeof(InlineBuffer));
+		StringLength = Other.StringLength;
+		BufferSize = Other.BufferSize;
+
+		Other.Clear();
+	}
+
+
+
+private:
+
+	union
+	{
+		/**
+			String buffer on heap.
+		*/
+		TCHAR* HeapBuffer;
+		/**
+			String buffer for short strings.
+		*/
+		TCHAR InlineBuffer[InlineCapacity + 1];
+	};
 	/**
 		Current string length.
 	*/
@@ -155,5 +201,7 @@ private:
 	/**
 		String buffer capacity.
 	*/
-	uint32 BufferSize = 0;
-};
\ No newline at end of file
+	uint32 BufferSize = InlineCapacity;
+};
+
+static_assert(sizeof(FStringBuffer) == FStringBuffer::FootprintSize, "FStringBuffer size must be equal to FootprintSize.");
@@ -0,0 +1,442 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "GenericPlatformString.h"
+#include "StringView.h"
+#include "NumberConversion.h"
+#include "EngineMemory.h"
+#include "EngineMath.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+
+
+
+
+namespace StringFormat_Private
+{
+FORCEINLINE constexpr bool IsDigit(TCHAR C) noexcept
+{
+	return C >= '0' && C <= '9';
+}
+
+/**
+	Validate format string.
+
+	@return count of placeholders or INDEX_NONE if format string is malformed.
+*/
+constexpr int32 CountPlaceholders(const TCHAR* Format) noexcept
+{
+	int32 Count = 0;
+	while( *Format != '\0' )
+	{
+		if( *Format == '{' )
+		{
+			++Format;
+			if( *Format == '{' )
+			{
+				++Format;
+				continue;
+			}
+
+			if( *Format == ':' )
+			{
+				++Format;
+				if( *Format != '.' || !IsDigit(Format[1]) ) return INDEX_NONE;
+
+				++Format;
+				while( IsDigit(*Format) )
+				{
+					++Format;
+				}
+			}
+
+			if( *Format != '}' ) return INDEX_NONE;
+			++Format;
+			++Count;
+		}
+		else if( *Format == '}' )
+		{
+			++Format;
+			if( *Format != '}' ) return INDEX_NONE;
+			++Format;
+		}
+		else
+		{
+			++Format;
+		}
+	}
+
+	return Count;
+}
+} // namespace StringFormat_Private
+
+
+
+/**
+	Format string literal validated at compile time. Made by FORMAT_TEXT macro.
+	Supported syntax: {} for next argument, {:.N} for next floating point argument with N fractional digits, {{ and }} for braces.
+
+	@see FORMAT_TEXT, TStringBuilder::AppendFormat, FString::Format.
+*/
+template<typename ProviderType>
+struct TFormatString
+{
+public:
+
+	static constexpr int32 NumPlaceholders = StringFormat_Private::CountPlaceholders(ProviderType::Get());
+	static_assert(NumPlaceholders != INDEX_NONE, "Malformed format string. Use {} or {:.N} for arguments, {{ and }} for braces.");
+
+public:
+
+	static FORCEINLINE constexpr const TCHAR* Get() noexcept { return ProviderType::Get(); }
+};
+
+/**
+	Make compile time checked format string from literal.
+	FString::Format(FORMAT_TEXT("{} of {}"), Index, Count);
+*/
+#define FORMAT_TEXT(Str)                                                       \
+	[]                                                                         \
+	{                                                                          \
+		struct FFormatProvider                                                 \
+		{                                                                      \
+			static constexpr const TCHAR* Get() noexcept { return TEXT(Str); } \
+		};                                                                     \
+		return TFormatString<FFormatProvider>();                               \
+	}()
+
+
+
+/**
+	String builder with inline buffer.
+	Chars are written in place, so formatting numbers and concatenation make no temporary strings.
+	Buffer grows geometrically and stays on stack while content fits in InlineCapacity chars.
+
+	@note Content is always null terminated.
+	@see FStringBuilder.
+*/
+template<uint32 InlineCapacity>
+class TStringBuilder
+{
+public:
+
+	FORCEINLINE TStringBuilder() noexcept { InlineBuffer[0] = '\0'; }
+	TStringBuilder(const TStringBuilder& Other) = delete;
+	FORCEINLINE ~TStringBuilder() noexcept
+	{
+		if( !IsInline() )
+		{
+			FMemory::Free(Data);
+		}
+	}
+
+
+public:
+
+	TStringBuilder& operator=(const TStringBuilder& Other) = delete;
+
+public:
+
+	FORCEINLINE TCHAR operator[](uint32 Index) const noexcept
+	{
+		check(Index < Length);
+		return Data[Index];
+	}
+
+	FORCEINLINE operator FStringView() const noexcept { return ToView(); }
+
+public:
+
+	FORCEINLINE uint32 Len() const noexcept { return Length; }
+	FORCEINLINE bool IsEmpty() const noexcept { return Length == 0; }
+	FORCEINLINE uint32 GetCapacity() const noexcept { return Capacity; }
+	/**
+		@return null terminated content.
+	*/
+	FORCEINLINE const TCHAR* GetData() const noexcept { return Data; }
+	FORCEINLINE FStringView ToView() const noexcept { return FStringView(Data, Length); }
+	/**
+		Check that content is stored in inline buffer.
+	*/
+	FORCEINLINE bool IsInline() const noexcept { return Data == InlineBuffer; }
+
+	/**
+		Empty the builder keeping allocated buffer.
+	*/
+	FORCEINLINE void Reset() noexcept
+	{
+		Length = 0;
+		Data[0] = '\0';
+	}
+	/**
+		Remove Count chars from the end.
+	*/
+	FORCEINLINE void RemoveSuffix(uint32 Count) noexcept
+	{
+		check(Count <= Length);
+		Length -= Count;
+		Data[Length] = '\0';
+	}
+	/**
+		Make sure that NewCapacity chars fit without reallocation.
+	*/
+	FORCEINLINE void Reserve(uint32 NewCapacity) noexcept
+	{
+		if( NewCapacity > Capacity )
+		{
+			Grow(NewCapacity);
+		}
+	}
+
+	/**
+		Append Count uninitialized chars.
+
+		@return pointer to the first appended char.
+	*/
+	FORCEINLINE TCHAR* AddUninitialized(uint32 Count) noexcept
+	{
+		Reserve(Length + Count);
+
+		TCHAR* Result = Data + Length;
+		Length += Count;
+		Data[Length] = '\0';
+		return Result;
+	}
+
+public:
+
+	FORCEINLINE TStringBuilder& Append(FStringView View) noexcept
+	{
+		if( !View.IsEmpty() )
+		{
+			FMemory::MemCpy(AddUninitialized(View.Len()), View.GetData(), sizeof(TCHAR) * View.Len());
+		}
+		return *this;
+	}
+	FORCEINLINE TStringBuilder& Append(const TCHAR* Str) noexcept { return Append(FStringView(Str)); }
+	FORCEINLINE TStringBuilder& Append(const ANSICHAR* Str) noexcept
+	{
+		const uint32 StrLength = FPlatformString::Strlen(Str);
+		TCHAR* Dest = AddUninitialized(StrLength);
+		for( uint32 i = 0; i < StrLength; ++i )
+		{
+			Dest[i] = static_cast<TCHAR>(Str[i]);
+		}
+		return *this;
+	}
+	FORCEINLINE TStringBuilder& Append(TCHAR C) noexcept
+	{
+		*AddUninitialized(1) = C;
+		return *this;
+	}
+	FORCEINLINE TStringBuilder& Append(ANSICHAR C) noexcept { return Append(static_cast<TCHAR>(C)); }
+	/**
+		Append char Count times.
+	*/
+	FORCEINLINE TStringBuilder& AppendChars(TCHAR C, uint32 Count) noexcept
+	{
+		TCHAR* Dest = AddUninitialized(Count);
+		for( uint32 i = 0; i < Count; ++i )
+		{
+			Dest[i] = C;
+		}
+		return *this;
+	}
+	FORCEINLINE TStringBuilder& Append(bool Value) noexcept { return Append(Value ? TEXT("true") : TEXT("false")); }
+
+	FORCEINLINE TStringBuilder& Append(int32 Value) noexcept { return Append(static_cast<int64>(Value)); }
+	FORCEINLINE TStringBuilder& Append(uint32 Value) noexcept { return Append(static_cast<uint64>(Value)); }
+	FORCEINLINE TStringBuilder& Append(int64 Value) noexcept
+	{
+		TCHAR Digits[FNumberConversion::MaxIntChars];
+		return Append(FStringView(Digits, FNumberConversion::FormatInt(Value, Digits)));
+	}
+	FORCEINLINE TStringBuilder& Append(uint64 Value) noexcept
+	{
+		TCHAR Digits[FNumberConversion::MaxIntChars];
+		return Append(FStringView(Digits, FNumberConversion::FormatUInt(Value, Digits)));
+	}
+	/**
+		Append unsigned value in upper case hexadecimal without prefix.
+	*/
+	FORCEINLINE TStringBuilder& AppendHex(uint64 Value) noexcept
+	{
+		constexpr uint32 MaxDigits = 16;
+		TCHAR Digits[MaxDigits];
+		uint32 At = MaxDigits;
+		do
+		{
+			const uint32 Digit = static_cast<uint32>(Value & 0xF);
+			Digits[--At] = static_cast<TCHAR>(Digit < 10 ? '0' + Digit : 'A' + Digit - 10);
+			Value >>= 4;
+		} while( Value != 0 );
+
+		return Append(FStringView(Digits + At, MaxDigits - At));
+	}
+
+	/**
+		Append the shortest text that parses back to the same value, e.g. "0.1", "2.0" or "1e+20".
+
+		@see FNumberConversion::FormatFloat.
+	*/
+	FORCEINLINE TStringBuilder& Append(float Value) noexcept
+	{
+		TCHAR Chars[FNumberConversion::MaxFloatChars];
+		// Avoids negative zero
+		return Append(FStringView(Chars, FNumberConversion::FormatFloat(Value == 0 ? 0.0f : Value, Chars)));
+	}
+	FORCEINLINE TStringBuilder& Append(double Value) noexcept
+	{
+		TCHAR Chars[FNumberConversion::MaxFloatChars];
+		return Append(FStringView(Chars, FNumberConversion::FormatDouble(Value == 0 ? 0.0 : Value, Chars)));
+	}
+	/**
+		Append floating point value in fixed notation.
+
+		@param Precision - count of fractional digits, at most FNumberConversion::MaxFixedPrecision.
+						   If negative then the shortest round trip text is appended as by Append(double).
+		@see FNumberConversion::FormatFixed.
+	*/
+	TStringBuilder& AppendFloat(double Value, int32 Precision = -1) noexcept
+	{
+		if( Precision < 0 ) return Append(Value);
+
+		TCHAR Chars[FNumberConversion::MaxFixedChars];
+		// Avoids negative zero
+		return Append(FStringView(Chars, FNumberConversion::FormatFixed(Value == 0 ? 0.0 : Value, Precision, Chars)));
+	}
+
+	/**
+		Append formatted arguments.
+		Format string is checked at compile time, count of arguments must match count of placeholders.
+		Arguments are written with Append overloads.
+
+		@see FORMAT_TEXT.
+	*/
+	template<typename ProviderType, typename... ArgTypes>
+	TStringBuilder& AppendFormat(TFormatString<ProviderType> Format, const ArgTypes&... Args) noexcept
+	{
+		static_assert(TFormatString<ProviderType>::NumPlaceholders == sizeof...(ArgTypes), "Count of format arguments does not match count of placeholders.");
+
+		const TCHAR* Cursor = Format.Get();
+		(AppendFormatArg(Cursor, Args), ...);
+		AppendFormatLiteral(Cursor);
+
+		return *this;
+	}
+
+
+
+private:
+
+	/**
+		Append literal part of format string until next placeholder or end.
+		Cursor is moved after placeholder.
+
+		@return precision of placeholder or -1 if not set.
+	*/
+	int32 AppendFormatLiteral(const TCHAR*& Cursor) noexcept
+	{
+		const TCHAR* Start = Cursor;
+		while( *Cursor != '\0' )
+		{
+			if( *Cursor == '}' )
+			{
+				// "}}"
+				Append(FStringView(Start, static_cast<uint32>(Cursor - Start) + 1));
+				Cursor += 2;
+				Start = Cursor;
+				continue;
+			}
+			if( *Cursor != '{' )
+			{
+				++Cursor;
+				continue;
+			}
+
+			if( Cursor[1] == '{' )
+			{
+				Append(FStringView(Start, static_cast<uint32>(Cursor - Start) + 1));
+				Cursor += 2;
+				Start = Cursor;
+				continue;
+			}
+
+			Append(FStringView(Start, static_cast<uint32>(Cursor - Start)));
+			++Cursor;
+
+			int32 Precision = -1;
+			if( *Cursor == ':' )
+			{
+				Cursor += 2;
+				Precision = 0;
+				while( StringFormat_Private::IsDigit(*Cursor) )
+				{
+					Precision = Precision * 10 + (*Cursor - '0');
+					++Cursor;
+				}
+			}
+
+			// Skip '}'
+			++Cursor;
+			return Precision;
+		}
+
+		Append(FStringView(Start, static_cast<uint32>(Cursor - Start)));
+		return -1;
+	}
+
+	template<typename ArgType>
+	FORCEINLINE void AppendFormatArg(const TCHAR*& Cursor, const ArgType& Arg) noexcept
+	{
+		const int32 Precision = AppendFormatLiteral(Cursor);
+		AppendFormatValue(Arg, Precision);
+	}
+
+	template<typename ArgType>
+	FORCEINLINE void AppendFormatValue(const ArgType& Arg, int32 Precision) noexcept { Append(Arg); }
+	FORCEINLINE void AppendFormatValue(float Arg, int32 Precision) noexcept
+	{
+		// Shortest text of float itself, not of its double conversion
+		if( Precision < 0 )
+		{
+			Append(Arg);
+		}
+		else
+		{
+			AppendFloat(Arg, Precision);
+		}
+	}
+	FORCEINLINE void AppendFormatValue(double Arg, int32 Precision) noexcept { AppendFloat(Arg, Precision); }
+
+	void Grow(uint32 MinCapacity) noexcept
+	{
+		const uint32 NewCapacity = FMath::Max(MinCapacity, Capacity * 2);
+		if( IsInline() )
+		{
+			TCHAR* NewData = static_cast<TCHAR*>(FMemory::Malloc(sizeof(TCHAR) * (NewCapacity + 1)));
+			FMemory::MemCpy(NewData, InlineBuffer, sizeof(TCHAR) * (Length + 1));
+			Data = NewData;
+		}
+		else
+		{
+			Data = static_cast<TCHAR*>(FMemory::Realloc(Data, sizeof(TCHAR) * (NewCapacity + 1)));
+		}
+		Capacity = NewCapacity;
+	}
+
+
+
+private:
+
+	TCHAR* Data = InlineBuffer;
+	uint32 Length = 0;
+	uint32 Capacity = InlineCapacity;
+	TCHAR InlineBuffer[InlineCapacity + 1];
+};
+
+/**
+	String builder with inline buffer of 128 chars.
+*/
+using FStringBuilder = TStringBuilder<128>;
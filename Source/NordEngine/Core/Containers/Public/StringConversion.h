@@ -0,0 +1,67 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+
+
+
+
+/**
+	Transcoding between byte strings and wide strings.
+	Byte strings are ANSICHAR arrays holding either Latin-1 (every byte is a code point) or UTF-8.
+	Wide strings are UTF-16 when WIDECHAR is 2 bytes and UTF-32 when it is 4 bytes.
+
+	Runs of ASCII chars are converted 16 bytes at a time with SSE2, other chars one code point at a time.
+	Invalid input never fails conversion: every malformed sequence becomes one ReplacementChar ('?' for Latin-1),
+	so Get...Length functions return exactly the count of units written by the matching conversion.
+	Output is never null terminated and sizes are in code units.
+*/
+struct ENGINE_API FStringConversion
+{
+public:
+
+	/**
+		Substitute for malformed UTF-8 sequences and unpaired surrogates.
+	*/
+	static constexpr uint32 ReplacementChar = 0xFFFD;
+
+	/**
+		Check that all chars are 7-bit.
+	*/
+	static bool IsAscii(const ANSICHAR* Src, uint32 SrcLen) noexcept;
+	/**
+		Check that text is well-formed UTF-8: no overlong forms, surrogates or code points above U+10FFFF.
+	*/
+	static bool IsValidUtf8(const ANSICHAR* Src, uint32 SrcLen) noexcept;
+
+	/**
+		Widen Latin-1 string. Dest must have space for SrcLen chars.
+	*/
+	static void Latin1ToWide(const ANSICHAR* Src, uint32 SrcLen, WIDECHAR* Dest) noexcept;
+	/**
+		Narrow wide string to Latin-1, chars above U+00FF become '?'. Dest must have space for SrcLen chars.
+	*/
+	static void WideToLatin1(const WIDECHAR* Src, uint32 SrcLen, ANSICHAR* Dest) noexcept;
+
+	/**
+		@return count of wide chars Utf8ToWide writes for Src.
+	*/
+	static uint32 GetUtf8ToWideLength(const ANSICHAR* Src, uint32 SrcLen) noexcept;
+	/**
+		Decode UTF-8. Dest must have space for GetUtf8ToWideLength chars, SrcLen is always enough.
+
+		@return count of written chars.
+	*/
+	static uint32 Utf8ToWide(const ANSICHAR* Src, uint32 SrcLen, WIDECHAR* Dest) noexcept;
+
+	/**
+		@return count of bytes WideToUtf8 writes for Src.
+	*/
+	static uint32 GetWideToUtf8Length(const WIDECHAR* Src, uint32 SrcLen) noexcept;
+	/**
+		Encode UTF-8. Dest must have space for GetWideToUtf8Length bytes, SrcLen * 4 is always enough.
+
+		@return count of written bytes.
+	*/
+	static uint32 WideToUtf8(const WIDECHAR* Src, uint32 SrcLen, ANSICHAR* Dest) noexcept;
+};
@@ -0,0 +1,322 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "Char.h"
+
+#include "EngineMath.h"
+#include "CommonMacros.h"
+
+// We require SSE2
+#include <emmintrin.h>
+#if PLATFORM_ALWAYS_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+
+
+
+/**
+	Determines case sensitivity options for string comparisons.
+*/
+enum class ESearchCase : uint8
+{
+	// Case sensitive. Upper/lower casing must match for strings to be considered equal.
+	CaseSensitive,
+
+	// Ignore case. Upper/lower casing does not matter when making a comparison.
+	IgnoreCase
+};
+
+/**
+	Determines search direction for string operations.
+*/
+enum class ESearchDir : uint8
+{
+	// Search from the start, moving forward through the string.
+	FromStart,
+
+	// Search from the end, moving backward through the string.
+	FromEnd
+};
+
+
+
+namespace StringSearch_Private
+{
+/**
+	TCHAR lanes of SIMD register.
+	Case folding is ASCII only, same as FChar, so non-ASCII chars are compared as is.
+*/
+struct FCharLanes
+{
+#if PLATFORM_ALWAYS_HAS_AVX2
+	using VectorType = __m256i;
+	static constexpr uint32 Bytes = 32;
+#else
+	using VectorType = __m128i;
+	static constexpr uint32 Bytes = 16;
+#endif
+	static constexpr uint32 Width = Bytes / sizeof(TCHAR);
+	/**
+		Count of MoveMask bits set by one char.
+	*/
+	static constexpr uint32 BitsPerChar = sizeof(TCHAR);
+	static constexpr uint32 CharMask = (1u << BitsPerChar) - 1;
+	static constexpr uint32 FullMask = Bytes == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+
+	static_assert(sizeof(TCHAR) == 2 || sizeof(TCHAR) == 4, "Unsupported TCHAR size.");
+
+#if PLATFORM_ALWAYS_HAS_AVX2
+	static FORCEINLINE VectorType Load(const TCHAR* P) noexcept { return _mm256_loadu_si256(reinterpret_cast<const VectorType*>(P)); }
+	static FORCEINLINE void Store(TCHAR* P, VectorType V) noexcept { _mm256_storeu_si256(reinterpret_cast<VectorType*>(P), V); }
+	static FORCEINLINE VectorType Splat(TCHAR C) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm256_set1_epi16(static_cast<int16>(C));
+		else return _mm256_set1_epi32(static_cast<int32>(C));
+	}
+	static FORCEINLINE VectorType Equal(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm256_cmpeq_epi16(A, B);
+		else return _mm256_cmpeq_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Greater(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm256_cmpgt_epi16(A, B);
+		else return _mm256_cmpgt_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Add(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm256_add_epi16(A, B);
+		else return _mm256_add_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Sub(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm256_sub_epi16(A, B);
+		else return _mm256_sub_epi32(A, B);
+	}
+	static FORCEINLINE VectorType And(VectorType A, VectorType B) noexcept { return _mm256_and_si256(A, B); }
+	static FORCEINLINE uint32 MoveMask(VectorType V) noexcept { return static_cast<uint32>(_mm256_movemask_epi8(V)); }
+#else
+	static FORCEINLINE VectorType Load(const TCHAR* P) noexcept { return _mm_loadu_si128(reinterpret_cast<const VectorType*>(P)); }
+	static FORCEINLINE void Store(TCHAR* P, VectorType V) noexcept { _mm_storeu_si128(reinterpret_cast<VectorType*>(P), V); }
+	static FORCEINLINE VectorType Splat(TCHAR C) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm_set1_epi16(static_cast<int16>(C));
+		else return _mm_set1_epi32(static_cast<int32>(C));
+	}
+	static FORCEINLINE VectorType Equal(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm_cmpeq_epi16(A, B);
+		else return _mm_cmpeq_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Greater(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm_cmpgt_epi16(A, B);
+		else return _mm_cmpgt_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Add(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm_add_epi16(A, B);
+		else return _mm_add_epi32(A, B);
+	}
+	static FORCEINLINE VectorType Sub(VectorType A, VectorType B) noexcept
+	{
+		if constexpr( sizeof(TCHAR) == 2 ) return _mm_sub_epi16(A, B);
+		else return _mm_sub_epi32(A, B);
+	}
+	static FORCEINLINE VectorType And(VectorType A, VectorType B) noexcept { return _mm_and_si128(A, B); }
+	static FORCEINLINE uint32 MoveMask(VectorType V) noexcept { return static_cast<uint32>(_mm_movemask_epi8(V)); }
+#endif // PLATFORM_ALWAYS_HAS_AVX2
+
+	/**
+		@return lanes equal to 0x20 where char is in [First, Last], zero otherwise.
+		Chars are compared as signed, chars above signed max are never in ASCII range anyway.
+	*/
+	static FORCEINLINE VectorType CaseBitInRange(VectorType V, TCHAR First, TCHAR Last) noexcept
+	{
+		const VectorType InRange = And(Greater(V, Splat(static_cast<TCHAR>(First - 1))), Greater(Splat(static_cast<TCHAR>(Last + 1)), V));
+		return And(InRange, Splat(0x20));
+	}
+	static FORCEINLINE VectorType ToLower(VectorType V) noexcept { return Add(V, CaseBitInRange(V, 'A', 'Z')); }
+	static FORCEINLINE VectorType ToUpper(VectorType V) noexcept { return Sub(V, CaseBitInRange(V, 'a', 'z')); }
+};
+
+template<bool bIgnoreCase>
+FORCEINLINE TCHAR FoldChar(TCHAR C) noexcept
+{
+	if constexpr( bIgnoreCase ) return FChar::ToLower(C);
+	else return C;
+}
+
+template<bool bIgnoreCase>
+FORCEINLINE FCharLanes::VectorType FoldLanes(FCharLanes::VectorType V) noexcept
+{
+	if constexpr( bIgnoreCase ) return FCharLanes::ToLower(V);
+	else return V;
+}
+
+template<bool bIgnoreCase>
+FORCEINLINE bool EqualsImpl(const TCHAR* A, const TCHAR* B, uint32 Len) noexcept
+{
+	using FLanes = FCharLanes;
+
+	uint32 i = 0;
+	for( ; i + FLanes::Width <= Len; i += FLanes::Width )
+	{
+		const FLanes::VectorType VA = FoldLanes<bIgnoreCase>(FLanes::Load(A + i));
+		const FLanes::VectorType VB = FoldLanes<bIgnoreCase>(FLanes::Load(B + i));
+		if( FLanes::MoveMask(FLanes::Equal(VA, VB)) != FLanes::FullMask ) return false;
+	}
+	for( ; i < Len; ++i )
+	{
+		if( FoldChar<bIgnoreCase>(A[i]) != FoldChar<bIgnoreCase>(B[i]) ) return false;
+	}
+	return true;
+}
+
+/**
+	Substring search with two char filter.
+	Each step compares block of possible starts by the first and the last char of Sub at once,
+	only starts that pass both are verified completely.
+*/
+template<bool bIgnoreCase>
+int32 FindImpl(const TCHAR* Str, uint32 StrLen, const TCHAR* Sub, uint32 SubLen) noexcept
+{
+	using FLanes = FCharLanes;
+
+	if( SubLen == 0 ) return 0;
+	if( SubLen > StrLen ) return INDEX_NONE;
+
+	const TCHAR First = FoldChar<bIgnoreCase>(Sub[0]);
+	const TCHAR Last = FoldChar<bIgnoreCase>(Sub[SubLen - 1]);
+	const uint32 MiddleLen = SubLen > 2 ? SubLen - 2 : 0;
+	const uint32 NumStarts = StrLen - SubLen + 1;
+
+	uint32 i = 0;
+	if( NumStarts >= FLanes::Width )
+	{
+		const FLanes::VectorType FirstLanes = FLanes::Splat(First);
+		const FLanes::VectorType LastLanes = FLanes::Splat(Last);
+		for( ; i + FLanes::Width <= NumStarts; i += FLanes::Width )
+		{
+			const FLanes::VectorType BlockFirst = FoldLanes<bIgnoreCase>(FLanes::Load(Str + i));
+			const FLanes::VectorType BlockLast = FoldLanes<bIgnoreCase>(FLanes::Load(Str + i + SubLen - 1));
+			uint32 Mask = FLanes::MoveMask(FLanes::And(FLanes::Equal(BlockFirst, FirstLanes), FLanes::Equal(BlockLast, LastLanes)));
+			while( Mask != 0 )
+			{
+				const uint32 Offset = FMath::CountTrailingZeros(Mask) / FLanes::BitsPerChar;
+				if( EqualsImpl<bIgnoreCase>(Str + i + Offset + 1, Sub + 1, MiddleLen) ) return static_cast<int32>(i + Offset);
+
+				Mask &= ~(FLanes::CharMask << (Offset * FLanes::BitsPerChar));
+			}
+		}
+	}
+
+	for( ; i < NumStarts; ++i )
+	{
+		if( FoldChar<bIgnoreCase>(Str[i]) == First && FoldChar<bIgnoreCase>(Str[i + SubLen - 1]) == Last && EqualsImpl<bIgnoreCase>(Str + i + 1, Sub + 1, MiddleLen) )
+		{
+			return static_cast<int32>(i);
+		}
+	}
+	return INDEX_NONE;
+}
+
+template<bool bIgnoreCase>
+int32 FindLastImpl(const TCHAR* Str, uint32 StrLen, const TCHAR* Sub, uint32 SubLen) noexcept
+{
+	if( SubLen == 0 ) return static_cast<int32>(StrLen);
+	if( SubLen > StrLen ) return INDEX_NONE;
+
+	const TCHAR First = FoldChar<bIgnoreCase>(Sub[0]);
+	for( uint32 i = StrLen - SubLen + 1; i > 0; --i )
+	{
+		if( FoldChar<bIgnoreCase>(Str[i - 1]) == First && EqualsImpl<bIgnoreCase>(Str + i, Sub + 1, SubLen - 1) )
+		{
+			return static_cast<int32>(i - 1);
+		}
+	}
+	return INDEX_NONE;
+}
+
+
+
+/**
+	Compare Len chars of A and B.
+*/
+FORCEINLINE bool Equals(const TCHAR* A, const TCHAR* B, uint32 Len, ESearchCase SearchCase) noexcept
+{
+	return SearchCase == ESearchCase::IgnoreCase ? EqualsImpl<true>(A, B, Len) : EqualsImpl<false>(A, B, Len);
+}
+
+/**
+	@return index of first C in Str or INDEX_NONE.
+*/
+FORCEINLINE int32 FindChar(const TCHAR* Str, uint32 Len, TCHAR C) noexcept
+{
+	uint32 i = 0;
+	if( Len >= FCharLanes::Width )
+	{
+		const FCharLanes::VectorType Lanes = FCharLanes::Splat(C);
+		for( ; i + FCharLanes::Width <= Len; i += FCharLanes::Width )
+		{
+			const uint32 Mask = FCharLanes::MoveMask(FCharLanes::Equal(FCharLanes::Load(Str + i), Lanes));
+			if( Mask != 0 ) return static_cast<int32>(i + FMath::CountTrailingZeros(Mask) / FCharLanes::BitsPerChar);
+		}
+	}
+	for( ; i < Len; ++i )
+	{
+		if( Str[i] == C ) return static_cast<int32>(i);
+	}
+	return INDEX_NONE;
+}
+
+/**
+	@return index of first occurrence of Sub in Str or INDEX_NONE.
+*/
+FORCEINLINE int32 Find(const TCHAR* Str, uint32 StrLen, const TCHAR* Sub, uint32 SubLen, ESearchCase SearchCase) noexcept
+{
+	return SearchCase == ESearchCase::IgnoreCase ? FindImpl<true>(Str, StrLen, Sub, SubLen) : FindImpl<false>(Str, StrLen, Sub, SubLen);
+}
+
+/**
+	@return index of last occurrence of Sub in Str or INDEX_NONE.
+*/
+FORCEINLINE int32 FindLast(const TCHAR* Str, uint32 StrLen, const TCHAR* Sub, uint32 SubLen, ESearchCase SearchCase) noexcept
+{
+	return SearchCase == ESearchCase::IgnoreCase ? FindLastImpl<true>(Str, StrLen, Sub, SubLen) : FindLastImpl<false>(Str, StrLen, Sub, SubLen);
+}
+
+/**
+	Convert ASCII letters of Str to lower case in place.
+*/
+FORCEINLINE void ToLowerInline(TCHAR* Str, uint32 Len) noexcept
+{
+	uint32 i = 0;
+	for( ; i + FCharLanes::Width <= Len; i += FCharLanes::Width )
+	{
+		FCharLanes::Store(Str + i, FCharLanes::ToLower(FCharLanes::Load(Str + i)));
+	}
+	for( ; i < Len; ++i )
+	{
+		Str[i] = FChar::ToLower(Str[i]);
+	}
+}
+
+/**
+	Convert ASCII letters of Str to upper case in place.
+*/
+FORCEINLINE void ToUpperInline(TCHAR* Str, uint32 Len) noexcept
+{
+	uint32 i = 0;
+	for( ; i + FCharLanes::Width <= Len; i += FCharLanes::Width )
+	{
+		FCharLanes::Store(Str + i, FCharLanes::ToUpper(FCharLanes::Load(Str + i)));
+	}
+	for( ; i < Len; ++i )
+	{
+		Str[i] = FChar::ToUpper(Str[i]);
+	}
+}
+} // namespace StringSearch_Private
@@ -0,0 +1,152 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "StringView.h"
+#include "StringSearch.h"
+
+#include "CommonMacros.h"
+
+
+
+
+/**
+	Lazy splitter of text by delimiter that yields views into the original buffer, so no memory is allocated.
+	Text must outlive the tokenizer and every yielded token.
+
+	Delimiter is matched case sensitive and can have any length. One char delimiter is scanned with SIMD compare,
+	longer delimiters use the SIMD substring search.
+	Empty text yields no tokens, empty delimiter yields whole text as one token.
+
+	@code
+		for( FStringView Token : FStringTokenizer(TEXT("a, b,, c"), TEXT(",")) )
+		{
+			Use(Token.Trim());
+		}
+	@endcode
+*/
+class FStringTokenizer
+{
+public:
+
+	FORCEINLINE FStringTokenizer(FStringView InText, FStringView InDelimiter, bool InCullEmpty = true) noexcept :
+		Text(InText), Delimiter(InDelimiter), Position(0), bCullEmpty(InCullEmpty), bFinished(InText.IsEmpty())
+	{
+	}
+
+public:
+
+	/**
+		Find next token.
+
+		@return false when all tokens are consumed, OutToken is not modified then.
+	*/
+	FORCEINLINE bool Next(FStringView& OutToken) noexcept
+	{
+		while( !bFinished )
+		{
+			const FStringView Rest = Text.RightChop(Position);
+			const int32 Index = FindDelimiter(Rest);
+
+			FStringView Token;
+			if( Index == INDEX_NONE )
+			{
+				Token = Rest;
+				bFinished = true;
+			}
+			else
+			{
+				Token = Rest.Left(static_cast<uint32>(Index));
+				Position += static_cast<uint32>(Index) + Delimiter.Len();
+			}
+
+			if( !bCullEmpty || !Token.IsEmpty() )
+			{
+				OutToken = Token;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+		Start tokenization from the beginning of text.
+	*/
+	FORCEINLINE void Reset() noexcept
+	{
+		Position = 0;
+		bFinished = Text.IsEmpty();
+	}
+
+public:
+
+	/**
+		Forward iterator for range-based for loop. Advancing any copy advances the tokenizer.
+	*/
+	class FIterator
+	{
+	public:
+
+		FORCEINLINE explicit FIterator(FStringTokenizer* InOwner) noexcept : Owner(InOwner)
+		{
+			Advance();
+		}
+
+	public:
+
+		FORCEINLINE FStringView operator*() const noexcept { return Current; }
+		FORCEINLINE const FStringView* operator->() const noexcept { return &Current; }
+
+		FORCEINLINE FIterator& operator++() noexcept
+		{
+			Advance();
+			return *this;
+		}
+
+		FORCEINLINE bool operator==(const FIterator& Other) const noexcept { return Owner == Other.Owner; }
+		FORCEINLINE bool operator!=(const FIterator& Other) const noexcept { return Owner != Other.Owner; }
+
+	private:
+
+		FORCEINLINE void Advance() noexcept
+		{
+			if( Owner != nullptr && !Owner->Next(Current) )
+			{
+				Owner = nullptr;
+			}
+		}
+
+	private:
+
+		/**
+			Null for end iterator.
+		*/
+		FStringTokenizer* Owner;
+		FStringView Current;
+	};
+
+	FORCEINLINE FIterator begin() noexcept { return FIterator(this); }
+	FORCEINLINE FIterator end() noexcept { return FIterator(nullptr); }
+
+
+
+private:
+
+	FORCEINLINE int32 FindDelimiter(FStringView Rest) const noexcept
+	{
+		if( Delimiter.IsEmpty() ) return INDEX_NONE;
+		if( Delimiter.Len() == 1 ) return StringSearch_Private::FindChar(Rest.GetData(), Rest.Len(), Delimiter[0]);
+		return StringSearch_Private::Find(Rest.GetData(), Rest.Len(), Delimiter.GetData(), Delimiter.Len(), ESearchCase::CaseSensitive);
+	}
+
+private:
+
+	FStringView Text;
+	FStringView Delimiter;
+	/**
+		Offset of the next token in Text.
+	*/
+	uint32 Position;
+	bool bCullEmpty;
+	bool bFinished;
+};
@@ -0,0 +1,231 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "GenericPlatformString.h"
+#include "Char.h"
+#include "StringSearch.h"
+
+#include "EngineMath.h"
+#include "NumericLimits.h"
+#include "AssertionMacros.h"
+#include "CommonMacros.h"
+#include "TypeHash.h"
+
+#include "TypeTraits/IsTriviallyRelocatable.h"
+
+
+
+
+/**
+	Non-owning view of characters: pointer and length.
+	Substring and trim operations return views of the same memory, so looking at part of string costs no allocation.
+	FString converts to FStringView implicitly.
+
+	@note View is not null terminated, use Len() instead of searching for '\0'.
+	@note View does not extend lifetime of viewed string, and any FString modification invalidates it.
+*/
+struct FStringView
+{
+public:
+
+	constexpr FStringView() noexcept = default;
+	FORCEINLINE FStringView(const TCHAR* InData) noexcept : Data(InData), Size(InData != nullptr ? FPlatformString::Strlen(InData) : 0) { }
+	FORCEINLINE constexpr FStringView(const TCHAR* InData, uint32 InLength) noexcept : Data(InData), Size(InLength) { }
+
+
+public:
+
+	FORCEINLINE TCHAR operator[](uint32 Index) const noexcept
+	{
+		check(Index < Size);
+		return Data[Index];
+	}
+
+	/**
+		Case sensitive comparison.
+	*/
+	FORCEINLINE bool operator==(FStringView Other) const noexcept { return Equals(Other, ESearchCase::CaseSensitive); }
+	FORCEINLINE bool operator!=(FStringView Other) const noexcept { return !(*this == Other); }
+
+	FORCEINLINE const TCHAR* begin() const noexcept { return Data; }
+	FORCEINLINE const TCHAR* end() const noexcept { return Data + Size; }
+
+public:
+
+	FORCEINLINE bool IsEmpty() const noexcept { return Size == 0; }
+	FORCEINLINE uint32 Len() const noexcept { return Size; }
+	/**
+		@return pointer to first char, not null terminated.
+	*/
+	FORCEINLINE const TCHAR* GetData() const noexcept { return Data; }
+
+public:
+
+	/**
+		@return view of the left most given number of characters.
+	*/
+	FORCEINLINE FStringView Left(uint32 Count) const noexcept { return FStringView(Data, FMath::Min(Count, Size)); }
+	/**
+		@return view of the left most characters chopping the given number of characters from the end.
+	*/
+	FORCEINLINE FStringView LeftChop(uint32 Count) const noexcept { return FStringView(Data, Size - FMath::Min(Count, Size)); }
+	/**
+		@return view of the right most given number of characters.
+	*/
+	FORCEINLINE FStringView Right(uint32 Count) const noexcept
+	{
+		Count = FMath::Min(Count, Size);
+		return FStringView(Data + Size - Count, Count);
+	}
+	/**
+		@return view of the right most characters chopping the given number of characters from the start.
+	*/
+	FORCEINLINE FStringView RightChop(uint32 Count) const noexcept
+	{
+		Count = FMath::Min(Count, Size);
+		return FStringView(Data + Count, Size - Count);
+	}
+	/**
+		@return view of the substring from Start position for Count characters, clamped to this view.
+	*/
+	FORCEINLINE FStringView Mid(uint32 Start, uint32 Count = MAX_uint32) const noexcept
+	{
+		Start = FMath::Min(Start, Size);
+		return FStringView(Data + Start, FMath::Min(Count, Size - Start));
+	}
+
+	/**
+		@return view without leading whitespaces.
+	*/
+	FORCEINLINE FStringView TrimLeft() const noexcept
+	{
+		uint32 Start = 0;
+		while( Start < Size && FChar::IsWhitespace(Data[Start]) )
+		{
+			++Start;
+		}
+		return FStringView(Data + Start, Size - Start);
+	}
+	/**
+		@return view without trailing whitespaces.
+	*/
+	FORCEINLINE FStringView TrimRight() const noexcept
+	{
+		uint32 NewSize = Size;
+		while( NewSize > 0 && FChar::IsWhitespace(Data[NewSize - 1]) )
+		{
+			--NewSize;
+		}
+		return FStringView(Data, NewSize);
+	}
+	/**
+		@return view without leading and trailing whitespaces.
+	*/
+	FORCEINLINE FStringView Trim() const noexcept { return TrimRight().TrimLeft(); }
+
+	/**
+		@return index of first found C or INDEX_NONE.
+	*/
+	FORCEINLINE int32 FindChar(TCHAR C) const noexcept { return StringSearch_Private::FindChar(Data, Size, C); }
+	/**
+		@return index of last found C or INDEX_NONE.
+	*/
+	FORCEINLINE int32 FindLastChar(TCHAR C) const noexcept
+	{
+		for( uint32 i = Size; i > 0; --i )
+		{
+			if( Data[i - 1] == C ) return static_cast<int32>(i - 1);
+		}
+		return INDEX_NONE;
+	}
+
+	/**
+		Search for substring.
+
+		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
+		@param SearchDir - Indicates whether the search starts at the beginning or at the end ( defaults to ESearchDir::FromStart ).
+		@return index of found substring or INDEX_NONE.
+	*/
+	FORCEINLINE int32 Find(FStringView SubStr, ESearchCase SearchCase = ESearchCase::IgnoreCase, ESearchDir SearchDir = ESearchDir::FromStart) const noexcept
+	{
+		if( SearchDir == ESearchDir::FromStart )
+		{
+			return StringSearch_Private::Find(Data, Size, SubStr.Data, SubStr.Size, SearchCase);
+		}
+		return StringSearch_Private::FindLast(Data, Size, SubStr.Data, SubStr.Size, SearchCase);
+	}
+	/**
+		Split view into parts before and after found delimiter. Views point into this view.
+
+		@param OutLeft - Part before delimiter, can be null.
+		@param OutRight - Part after delimiter, can be null.
+		@return false and keeps outputs if delimiter is not found.
+	*/
+	FORCEINLINE bool Split(FStringView Delimiter, FStringView* OutLeft, FStringView* OutRight, ESearchCase SearchCase = ESearchCase::IgnoreCase, ESearchDir SearchDir = ESearchDir::FromStart) const noexcept
+	{
+		if( Delimiter.IsEmpty() ) return false;
+
+		const int32 Index = Find(Delimiter, SearchCase, SearchDir);
+		if( Index == INDEX_NONE ) return false;
+
+		if( OutLeft != nullptr ) *OutLeft = Left(static_cast<uint32>(Index));
+		if( OutRight != nullptr ) *OutRight = RightChop(static_cast<uint32>(Index) + Delimiter.Size);
+		return true;
+	}
+	/**
+		@return true if this view contains given substring.
+	*/
+	FORCEINLINE bool Contains(FStringView SubStr, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return Find(SubStr, SearchCase) != INDEX_NONE; }
+
+	/**
+		Compare with other view.
+
+		@param SearchCase - Indicates whether the comparison is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
+	*/
+	FORCEINLINE bool Equals(FStringView Other, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept
+	{
+		if( Size != Other.Size ) return false;
+		if( Size == 0 || Data == Other.Data ) return true;
+
+		return StringSearch_Private::Equals(Data, Other.Data, Size, SearchCase);
+	}
+	/**
+		Test whether this view starts with given text.
+
+		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
+	*/
+	FORCEINLINE bool StartsWith(FStringView Prefix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return !Prefix.IsEmpty() && Prefix.Size <= Size && Left(Prefix.Size).Equals(Prefix, SearchCase); }
+	/**
+		Test whether this view ends with given text.
+
+		@param SearchCase - Indicates whether the search is case sensitive or not ( defaults to ESearchCase::IgnoreCase ).
+	*/
+	FORCEINLINE bool EndsWith(FStringView Suffix, ESearchCase SearchCase = ESearchCase::IgnoreCase) const noexcept { return !Suffix.IsEmpty() && Suffix.Size <= Size && Right(Suffix.Size).Equals(Suffix, SearchCase); }
+
+
+
+private:
+
+	const TCHAR* Data = nullptr;
+	uint32 Size = 0;
+};
+
+template<>
+struct TIsTriviallyRelocatable<FStringView>
+{
+	enum
+	{
+		Value = true
+	};
+};
+
+
+
+/**
+	Hash of view chars. Equal to hash of FString with the same content.
+*/
+FORCEINLINE uint64 GetTypeHash(FStringView View) noexcept
+{
+	return HashBytes(View.GetData(), sizeof(TCHAR) * View.Len());
+}
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "GenericPlatform.h"
+#include "NumberConversion.h"
 
 #include <vector>
 #include <map>
@@ -9,6 +10,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cctype>
 
 
 
@@ -70,15 +72,29 @@ public:
 	template<typename T>
 	FORCEINLINE T Get(const std::string& Section, const std::string& Name, const T& DefaultValue = T()) const
 	{
-		const auto LSection = GetSection(Section);
-		const auto LValue = LSection.find(Name);
+		const auto LSection = Values.find(Section);
+		if( LSection == Values.end() )
+		{
+			return DefaultValue;
+		}
 
-		if( LValue == LSection.end() )
+		const auto LValue = LSection->second.find(Name);
+		if( LValue == LSection->second.end() )
 		{
 			return DefaultValue;
 		}
 
-		return Value2T<T>(LValue->second);
+		if constexpr( TIsNumberConvertible<T>::Value )
+		{
+			// Malformed or out of range number falls back to default
+			T LResult = DefaultValue;
+			String2Number(LValue->second, LResult);
+			return LResult;
+		}
+		else
+		{
+			return Value2T<T>(LValue->second);
+		}
 	}
 	template<typename T>
 	FORCEINLINE std::vector<T> GetVector(const std::string& Section, const std::string& Name) const
@@ -87,13 +103,34 @@ public:
 		if( LValue.empty() ) return std::vector<T>();
 
 
-		std::istringstream out(LValue);
-		const std::vector<std::string> strs {std::istream_iterator<std::string>(out)};
-
+		// Scan whitespace separated tokens in place, numbers are parsed straight from the value without temporary strings
 		std::vector<T> LResult;
-		for( const std::string& s : strs )
+		const char* LIt = LValue.data();
+		const char* const LEnd = LIt + LValue.size();
+		for( ;; )
 		{
-			LResult.emplace_back(Value2T<T>(s));
+			while( LIt != LEnd && std::isspace(static_cast<unsigned char>(*LIt)) )
+			{
+				++LIt;
+			}
+			if( LIt == LEnd ) break;
+
+			const char* const LTokenBegin = LIt;
+			while( LIt != LEnd && !std::isspace(static_cast<unsigned char>(*LIt)) )
+			{
+				++LIt;
+			}
+
+			if constexpr( TIsNumberConvertible<T>::Value )
+			{
+				T LElement = T();
+				FNumberConversion::TryParse(LTokenBegin, LIt, LElement);
+				LResult.push_back(LElement);
+			}
+			else
+			{
+				LResult.emplace_back(Value2T<T>(std::string(LTokenBegin, LIt)));
+			}
 		}
 
 		return LResult;
@@ -116,33 +153,64 @@ protected:
 	int ParseIniFile(FILE* File);
 
 
+	/**
+		Parse whole string as number without locale and stream overhead.
+
+		@return false and keeps OutValue if string is not a number of type T.
+	*/
+	template<typename T>
+	FORCEINLINE bool String2Number(const std::string& S, T& OutValue) const
+	{
+		return FNumberConversion::TryParse(S.data(), S.data() + S.size(), OutValue);
+	}
+
 	template<typename T>
 	FORCEINLINE std::string Value2String(const T& V) const
 	{
-		std::stringstream SS;
-		SS << V;
-		return SS.str();
+		if constexpr( TIsNumberConvertible<T>::Value )
+		{
+			// Floats are written as shortest text that is read back to the same value
+			ANSICHAR LBuffer[FNumberConversion::MaxFloatChars];
+			return std::string(LBuffer, FNumberConversion::Format(V, LBuffer));
+		}
+		else
+		{
+			std::stringstream SS;
+			SS << V;
+			return SS.str();
+		}
 	}
 	template<typename T>
 	FORCEINLINE std::string Vector2String(const std::vector<T>& V) const
 	{
-		if( V.empty() ) return "";
-
-		std::ostringstream oss;
-		std::copy(V.begin(), V.end() - 1, std::ostream_iterator<T>(oss, " "));
-		oss << V.back();
+		std::string LResult;
+		for( size_t i = 0; i < V.size(); ++i )
+		{
+			if( i > 0 )
+			{
+				LResult += ' ';
+			}
+			LResult += Value2String(V[i]);
+		}
 
-		return oss.str();
+		return LResult;
 	}
 
 	template<typename T>
 	FORCEINLINE T Value2T(std::string S) const
 	{
-		T LResult;
+		T LResult = T();
 
-		std::istringstream _ {S};
-		_.exceptions(std::ios::failbit);
-		_ >> LResult;
+		if constexpr( TIsNumberConvertible<T>::Value )
+		{
+			String2Number(S, LResult);
+		}
+		else
+		{
+			std::istringstream _ {S};
+			_.exceptions(std::ios::failbit);
+			_ >> LResult;
+		}
 
 		return LResult;
 	}
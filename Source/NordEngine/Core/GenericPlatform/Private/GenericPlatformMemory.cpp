@@ -0,0 +1,26 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "GenericPlatformMemory.h"
+
+#include <cstdlib>
+
+
+
+
+
+void* FGenericPlatformMemory::AllocateVirtual(SIZE_T Size, SIZE_T Alignment)
+{
+	// Original pointer is stored right before the aligned region
+	void* const Original = calloc(1, Size + Alignment + sizeof(void*));
+	if( Original == nullptr ) return nullptr;
+
+	const UPTRINT Aligned = (reinterpret_cast<UPTRINT>(Original) + sizeof(void*) + Alignment - 1) & ~(static_cast<UPTRINT>(Alignment) - 1);
+	reinterpret_cast<void**>(Aligned)[-1] = Original;
+
+	return reinterpret_cast<void*>(Aligned);
+}
+
+void FGenericPlatformMemory::FreeVirtual(void* Ptr, SIZE_T Size)
+{
+	if( Ptr == nullptr ) return;
+	free(static_cast<void**>(Ptr)[-1]);
+}
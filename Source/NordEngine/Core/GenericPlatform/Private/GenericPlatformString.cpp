@@ -1,7 +1,34 @@
 // Copyright Nord Engine. All Rights Reserved.
 #include "GenericPlatformString.h"
+#include "GenericPlatformMisc.h"
 #include "Char.h"
 
+#include "EngineMath.h"
+#include "EngineMemory.h"
+#include "AssertionMacros.h"
+
+// We require SSE2
+#include <emmintrin.h>
+
+// MSVC compiles AVX2 intrinsics without arch flags, other compilers only when the whole unit targets AVX2
+#if defined(_MSC_VER) || defined(__AVX2__)
+	#define STRING_COMPILE_AVX2 1
+	#include <immintrin.h>
+#else
+	#define STRING_COMPILE_AVX2 0
+#endif
+
+// Vectorized scanning over-reads the string inside a memory page, which is valid but visible to ASan
+#if USING_ADDRESS_SANITISER
+	#if defined(_MSC_VER)
+		#define STRING_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+	#else
+		#define STRING_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+	#endif
+#else
+	#define STRING_NO_SANITIZE_ADDRESS
+#endif
+
 
 
 
@@ -95,13 +122,286 @@ int32 StrnicmpImpl(const CharType1* String1, const CharType2* String2, SIZE_T Co
 	return 0;
 }
 
+template<typename CharType1, typename CharType2>
+int32 StrncmpImpl(const CharType1* String1, const CharType2* String2, SIZE_T Count)
+{
+	for( ; Count > 0; --Count )
+	{
+		CharType1 C1 = *String1++;
+		CharType2 C2 = *String2++;
+
+		if( C1 != C2 )
+		{
+			return TChar<CharType1>::ToUnsigned(C1) - TChar<CharType2>::ToUnsigned(C2);
+		}
+		if( C1 == 0 )
+		{
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+
+
+
+namespace GenericPlatformString_Private
+{
+/**
+	Vector loads of this size never cross a page when they start at aligned address.
+*/
+constexpr UPTRINT PageSize = 4096;
+
+/**
+	SSE2 operations on chars of given width.
+*/
+template<typename CharType>
+struct TSse2Lanes
+{
+	using VectorType = __m128i;
+
+	static constexpr uint32 Bytes = 16;
+	static constexpr uint32 Width = Bytes / sizeof(CharType);
+	static constexpr uint32 FullMask = 0xFFFF;
+
+	STRING_NO_SANITIZE_ADDRESS static FORCEINLINE VectorType Load(const void* Ptr) { return _mm_loadu_si128(static_cast<const __m128i*>(Ptr)); }
+	STRING_NO_SANITIZE_ADDRESS static FORCEINLINE VectorType LoadAligned(const void* Ptr) { return _mm_load_si128(static_cast<const __m128i*>(Ptr)); }
+	static FORCEINLINE uint32 MoveMask(VectorType V) { return static_cast<uint32>(_mm_movemask_epi8(V)); }
+
+	static FORCEINLINE VectorType Splat(int32 C)
+	{
+		if constexpr( sizeof(CharType) == 1 ) return _mm_set1_epi8(static_cast<char>(C));
+		else if constexpr( sizeof(CharType) == 2 ) return _mm_set1_epi16(static_cast<short>(C));
+		else return _mm_set1_epi32(C);
+	}
+	static FORCEINLINE VectorType Equal(VectorType A, VectorType B)
+	{
+		if constexpr( sizeof(CharType) == 1 ) return _mm_cmpeq_epi8(A, B);
+		else if constexpr( sizeof(CharType) == 2 ) return _mm_cmpeq_epi16(A, B);
+		else return _mm_cmpeq_epi32(A, B);
+	}
+	/**
+		Lower 'A'-'Z' only. Signed compare leaves chars above 7 bits untouched.
+	*/
+	static FORCEINLINE VectorType FoldCase(VectorType V)
+	{
+		VectorType IsUpper;
+		if constexpr( sizeof(CharType) == 1 ) IsUpper = _mm_and_si128(_mm_cmpgt_epi8(V, Splat('A' - 1)), _mm_cmplt_epi8(V, Splat('Z' + 1)));
+		else if constexpr( sizeof(CharType) == 2 ) IsUpper = _mm_and_si128(_mm_cmpgt_epi16(V, Splat('A' - 1)), _mm_cmplt_epi16(V, Splat('Z' + 1)));
+		else IsUpper = _mm_and_si128(_mm_cmpgt_epi32(V, Splat('A' - 1)), _mm_cmplt_epi32(V, Splat('Z' + 1)));
+		return _mm_or_si128(V, _mm_and_si128(IsUpper, Splat(0x20)));
+	}
+};
+
+#if STRING_COMPILE_AVX2
+/**
+	AVX2 operations on chars of given width.
+*/
+template<typename CharType>
+struct TAvx2Lanes
+{
+	using VectorType = __m256i;
+
+	static constexpr uint32 Bytes = 32;
+	static constexpr uint32 Width = Bytes / sizeof(CharType);
+	static constexpr uint32 FullMask = 0xFFFFFFFF;
+
+	STRING_NO_SANITIZE_ADDRESS static FORCEINLINE VectorType Load(const void* Ptr) { return _mm256_loadu_si256(static_cast<const __m256i*>(Ptr)); }
+	STRING_NO_SANITIZE_ADDRESS static FORCEINLINE VectorType LoadAligned(const void* Ptr) { return _mm256_load_si256(static_cast<const __m256i*>(Ptr)); }
+	static FORCEINLINE uint32 MoveMask(VectorType V) { return static_cast<uint32>(_mm256_movemask_epi8(V)); }
+
+	static FORCEINLINE VectorType Splat(int32 C)
+	{
+		if constexpr( sizeof(CharType) == 1 ) return _mm256_set1_epi8(static_cast<char>(C));
+		else if constexpr( sizeof(CharType) == 2 ) return _mm256_set1_epi16(static_cast<short>(C));
+		else return _mm256_set1_epi32(C);
+	}
+	static FORCEINLINE VectorType Equal(VectorType A, VectorType B)
+	{
+		if constexpr( sizeof(CharType) == 1 ) return _mm256_cmpeq_epi8(A, B);
+		else if constexpr( sizeof(CharType) == 2 ) return _mm256_cmpeq_epi16(A, B);
+		else return _mm256_cmpeq_epi32(A, B);
+	}
+	/**
+		Lower 'A'-'Z' only. Signed compare leaves chars above 7 bits untouched.
+	*/
+	static FORCEINLINE VectorType FoldCase(VectorType V)
+	{
+		VectorType IsUpper;
+		if constexpr( sizeof(CharType) == 1 ) IsUpper = _mm256_and_si256(_mm256_cmpgt_epi8(V, Splat('A' - 1)), _mm256_cmpgt_epi8(Splat('Z' + 1), V));
+		else if constexpr( sizeof(CharType) == 2 ) IsUpper = _mm256_and_si256(_mm256_cmpgt_epi16(V, Splat('A' - 1)), _mm256_cmpgt_epi16(Splat('Z' + 1), V));
+		else IsUpper = _mm256_and_si256(_mm256_cmpgt_epi32(V, Splat('A' - 1)), _mm256_cmpgt_epi32(Splat('Z' + 1), V));
+		return _mm256_or_si256(V, _mm256_and_si256(IsUpper, Splat(0x20)));
+	}
+};
+#endif // STRING_COMPILE_AVX2
+
+/**
+	@return true if vector load at Ptr stays inside its memory page.
+*/
+template<typename LanesType>
+FORCEINLINE bool IsLoadInPage(const void* Ptr)
+{
+	return (reinterpret_cast<UPTRINT>(Ptr) & (PageSize - 1)) <= PageSize - LanesType::Bytes;
+}
+
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS FORCEINLINE int32 StrlenImpl(const CharType* String)
+{
+	// Aligned blocks never cross a page. First block can start before the string, its leading chars are shifted out of the mask
+	const UPTRINT Misalignment = reinterpret_cast<UPTRINT>(String) & (LanesType::Bytes - 1);
+	const uint8* Block = reinterpret_cast<const uint8*>(String) - Misalignment;
+	const typename LanesType::VectorType Zero = LanesType::Splat(0);
+
+	uint32 Mask = LanesType::MoveMask(LanesType::Equal(LanesType::LoadAligned(Block), Zero)) >> Misalignment;
+	if( Mask != 0 ) return static_cast<int32>(FMath::CountTrailingZeros(Mask) / sizeof(CharType));
+
+	for( ;; )
+	{
+		Block += LanesType::Bytes;
+		Mask = LanesType::MoveMask(LanesType::Equal(LanesType::LoadAligned(Block), Zero));
+		if( Mask != 0 )
+		{
+			const SIZE_T NumBytes = static_cast<SIZE_T>(Block - reinterpret_cast<const uint8*>(String)) + FMath::CountTrailingZeros(Mask);
+			return static_cast<int32>(NumBytes / sizeof(CharType));
+		}
+	}
+}
+
+/**
+	Skip common prefix of two strings by blocks.
+
+	@return index of the first char that differs or is terminator, or index from which less than a block of Count is left.
+*/
+template<typename LanesType, bool bIgnoreCase, typename CharType>
+STRING_NO_SANITIZE_ADDRESS FORCEINLINE SIZE_T SkipEqualPrefix(const CharType* String1, const CharType* String2, SIZE_T Count)
+{
+	const typename LanesType::VectorType Zero = LanesType::Splat(0);
+
+	SIZE_T Index = 0;
+	while( Count - Index >= LanesType::Width )
+	{
+		const CharType* const Chars1 = String1 + Index;
+		const CharType* const Chars2 = String2 + Index;
+
+		// Strings are not aligned to each other, so unaligned loads are used while both stay inside their pages
+		if( IsLoadInPage<LanesType>(Chars1) && IsLoadInPage<LanesType>(Chars2) )
+		{
+			typename LanesType::VectorType Block1 = LanesType::Load(Chars1);
+			typename LanesType::VectorType Block2 = LanesType::Load(Chars2);
+			const uint32 TerminatorMask = LanesType::MoveMask(LanesType::Equal(Block1, Zero));
+			if constexpr( bIgnoreCase )
+			{
+				Block1 = LanesType::FoldCase(Block1);
+				Block2 = LanesType::FoldCase(Block2);
+			}
+			const uint32 StopMask = (~LanesType::MoveMask(LanesType::Equal(Block1, Block2)) & LanesType::FullMask) | TerminatorMask;
+
+			if( StopMask != 0 ) return Index + FMath::CountTrailingZeros(StopMask) / sizeof(CharType);
+			Index += LanesType::Width;
+		}
+		else
+		{
+			// Step over page boundary one char at a time
+			const CharType C1 = *Chars1;
+			const CharType C2 = *Chars2;
+			if( C1 == 0 ) return Index;
+			if( C1 != C2 && (!bIgnoreCase || !BothAscii(C1, C2) || LowerAscii[TChar<CharType>::ToUnsigned(C1)] != LowerAscii[TChar<CharType>::ToUnsigned(C2)]) ) return Index;
+			++Index;
+		}
+	}
+	return Index;
+}
+
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS int32 StrlenVectorized(const CharType* String)
+{
+	return StrlenImpl<LanesType>(String);
+}
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS int32 StrcmpVectorized(const CharType* String1, const CharType* String2)
+{
+	const SIZE_T Skip = SkipEqualPrefix<LanesType, false>(String1, String2, static_cast<SIZE_T>(-1));
+	return StrncmpImpl(String1 + Skip, String2 + Skip, static_cast<SIZE_T>(-1));
+}
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS int32 StrncmpVectorized(const CharType* String1, const CharType* String2, SIZE_T Count)
+{
+	const SIZE_T Skip = SkipEqualPrefix<LanesType, false>(String1, String2, Count);
+	return StrncmpImpl(String1 + Skip, String2 + Skip, Count - Skip);
+}
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS int32 StricmpVectorized(const CharType* String1, const CharType* String2)
+{
+	const SIZE_T Skip = SkipEqualPrefix<LanesType, true>(String1, String2, static_cast<SIZE_T>(-1));
+	return StricmpImpl(String1 + Skip, String2 + Skip);
+}
+template<typename LanesType, typename CharType>
+STRING_NO_SANITIZE_ADDRESS int32 StrnicmpVectorized(const CharType* String1, const CharType* String2, SIZE_T Count)
+{
+	const SIZE_T Skip = SkipEqualPrefix<LanesType, true>(String1, String2, Count);
+	return StrnicmpImpl(String1 + Skip, String2 + Skip, Count - Skip);
+}
+
+/**
+	Table of implementations selected for current CPU.
+*/
+template<typename CharType>
+struct TStringFunctions
+{
+	int32 (*Strlen)(const CharType*);
+	int32 (*Strcmp)(const CharType*, const CharType*);
+	int32 (*Strncmp)(const CharType*, const CharType*, SIZE_T);
+	int32 (*Stricmp)(const CharType*, const CharType*);
+	int32 (*Strnicmp)(const CharType*, const CharType*, SIZE_T);
+};
+
+template<typename LanesType, typename CharType>
+FORCEINLINE TStringFunctions<CharType> MakeStringFunctions()
+{
+	TStringFunctions<CharType> Functions;
+	Functions.Strlen = &StrlenVectorized<LanesType, CharType>;
+	Functions.Strcmp = &StrcmpVectorized<LanesType, CharType>;
+	Functions.Strncmp = &StrncmpVectorized<LanesType, CharType>;
+	Functions.Stricmp = &StricmpVectorized<LanesType, CharType>;
+	Functions.Strnicmp = &StrnicmpVectorized<LanesType, CharType>;
+	return Functions;
+}
+
+/**
+	Selected on first call, so strings can be used during static initialization.
+*/
+template<typename CharType>
+const TStringFunctions<CharType>& GetStringFunctions()
+{
+	static const TStringFunctions<CharType> Functions = []()
+	{
+#if STRING_COMPILE_AVX2
+		if( FPlatformMisc::HasAVX2InstructionSupport() )
+		{
+			return MakeStringFunctions<TAvx2Lanes<CharType>, CharType>();
+		}
+#endif
+		return MakeStringFunctions<TSse2Lanes<CharType>, CharType>();
+	}();
+	return Functions;
+}
+} // namespace GenericPlatformString_Private
+
+using namespace GenericPlatformString_Private;
+
+
+
+
+
 int32 FGenericPlatformString::Stricmp(const ANSICHAR* Str1, const ANSICHAR* Str2)
 {
-	return StricmpImpl(Str1, Str2);
+	return GetStringFunctions<ANSICHAR>().Stricmp(Str1, Str2);
 }
 int32 FGenericPlatformString::Stricmp(const WIDECHAR* Str1, const WIDECHAR* Str2)
 {
-	return StricmpImpl(Str1, Str2);
+	return GetStringFunctions<WIDECHAR>().Stricmp(Str1, Str2);
 }
 int32 FGenericPlatformString::Stricmp(const ANSICHAR* Str1, const WIDECHAR* Str2)
 {
@@ -113,11 +413,11 @@ int32 FGenericPlatformString::Stricmp(const WIDECHAR* Str1, const ANSICHAR* Str2
 }
 int32 FGenericPlatformString::Strnicmp(const ANSICHAR* Str1, const ANSICHAR* Str2, SIZE_T Count)
 {
-	return StrnicmpImpl(Str1, Str2, Count);
+	return GetStringFunctions<ANSICHAR>().Strnicmp(Str1, Str2, Count);
 }
 int32 FGenericPlatformString::Strnicmp(const WIDECHAR* Str1, const WIDECHAR* Str2, SIZE_T Count)
 {
-	return StrnicmpImpl(Str1, Str2, Count);
+	return GetStringFunctions<WIDECHAR>().Strnicmp(Str1, Str2, Count);
 }
 int32 FGenericPlatformString::Strnicmp(const ANSICHAR* Str1, const WIDECHAR* Str2, SIZE_T Count)
 {
@@ -131,34 +431,13 @@ int32 FGenericPlatformString::Strnicmp(const WIDECHAR* Str1, const ANSICHAR* Str
 
 
 
-template<typename CharType1, typename CharType2>
-int32 StrncmpImpl(const CharType1* String1, const CharType2* String2, SIZE_T Count)
-{
-	for( ; Count > 0; --Count )
-	{
-		CharType1 C1 = *String1++;
-		CharType2 C2 = *String2++;
-
-		if( C1 != C2 )
-		{
-			return TChar<CharType1>::ToUnsigned(C1) - TChar<CharType2>::ToUnsigned(C2);
-		}
-		if( C1 == 0 )
-		{
-			return 0;
-		}
-	}
-
-	return 0;
-}
-
 int32 FGenericPlatformString::Strncmp(const ANSICHAR* Str1, const ANSICHAR* Str2, SIZE_T Count)
 {
-	return StrncmpImpl(Str1, Str2, Count);
+	return GetStringFunctions<ANSICHAR>().Strncmp(Str1, Str2, Count);
 }
 int32 FGenericPlatformString::Strncmp(const WIDECHAR* Str1, const WIDECHAR* Str2, SIZE_T Count)
 {
-	return StrncmpImpl(Str1, Str2, Count);
+	return GetStringFunctions<WIDECHAR>().Strncmp(Str1, Str2, Count);
 }
 int32 FGenericPlatformString::Strncmp(const ANSICHAR* Str1, const WIDECHAR* Str2, SIZE_T Count)
 {
@@ -167,4 +446,44 @@ int32 FGenericPlatformString::Strncmp(const ANSICHAR* Str1, const WIDECHAR* Str2
 int32 FGenericPlatformString::Strncmp(const WIDECHAR* Str1, const ANSICHAR* Str2, SIZE_T Count)
 {
 	return StrncmpImpl(Str1, Str2, Count);
-}
\ No newline at end of file
+}
+
+int32 FGenericPlatformString::Strlen(const ANSICHAR* String)
+{
+	return GetStringFunctions<ANSICHAR>().Strlen(String);
+}
+int32 FGenericPlatformString::Strlen(const WIDECHAR* String)
+{
+	return GetStringFunctions<WIDECHAR>().Strlen(String);
+}
+
+template<typename CharType>
+FORCEINLINE void StrcpyImpl(CharType* Dest, SIZE_T DestCount, const CharType* Src)
+{
+	check(Dest != nullptr && DestCount > 0);
+
+	SIZE_T Length = static_cast<SIZE_T>(FGenericPlatformString::Strlen(Src));
+	checkf(Length < DestCount, TEXT("String does not fit destination buffer"));
+	// Keep Dest bounded when checks are compiled out
+	Length = FMath::Min(Length, DestCount - 1);
+
+	FMemory::MemCpy(Dest, Src, Length * sizeof(CharType));
+	Dest[Length] = 0;
+}
+
+void FGenericPlatformString::Strcpy(ANSICHAR* Dest, SIZE_T DestCount, const ANSICHAR* Src)
+{
+	StrcpyImpl(Dest, DestCount, Src);
+}
+void FGenericPlatformString::Strcpy(WIDECHAR* Dest, SIZE_T DestCount, const WIDECHAR* Src)
+{
+	StrcpyImpl(Dest, DestCount, Src);
+}
+int32 FGenericPlatformString::Strcmp(const ANSICHAR* Str1, const ANSICHAR* Str2)
+{
+	return GetStringFunctions<ANSICHAR>().Strcmp(Str1, Str2);
+}
+int32 FGenericPlatformString::Strcmp(const WIDECHAR* Str1, const WIDECHAR* Str2)
+{
+	return GetStringFunctions<WIDECHAR>().Strcmp(Str1, Str2);
+}
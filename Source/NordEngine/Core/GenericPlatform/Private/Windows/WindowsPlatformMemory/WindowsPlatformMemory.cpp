@@ -0,0 +1,57 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "GenericPlatform.h"
+#if PLATFORM_WINDOWS
+
+#include "Windows/WindowsPlatformMemory/WindowsPlatformMemory.h"
+#include "Windows/WindowsHWrapper.h"
+
+
+
+
+
+SIZE_T FWindowsPlatformMemory::GetAllocationGranularity() noexcept
+{
+	static const SIZE_T Granularity = []()
+	{
+		SYSTEM_INFO SystemInfo;
+		GetSystemInfo(&SystemInfo);
+		return static_cast<SIZE_T>(SystemInfo.dwAllocationGranularity);
+	}();
+	return Granularity;
+}
+
+void* FWindowsPlatformMemory::AllocateVirtual(SIZE_T Size, SIZE_T Alignment)
+{
+	const SIZE_T Granularity = GetAllocationGranularity();
+	Size = (Size + Granularity - 1) & ~(Granularity - 1);
+
+	if( Alignment <= Granularity )
+	{
+		return VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	}
+
+	// Reserve enough to find aligned address, release and map exactly there.
+	// Other thread can take the range in between, so it is retried.
+	for( int32 Attempt = 0; Attempt < 16; ++Attempt )
+	{
+		void* const Reserved = VirtualAlloc(nullptr, Size + Alignment, MEM_RESERVE, PAGE_NOACCESS);
+		if( Reserved == nullptr ) return nullptr;
+
+		void* const Aligned = reinterpret_cast<void*>((reinterpret_cast<UPTRINT>(Reserved) + Alignment - 1) & ~(static_cast<UPTRINT>(Alignment) - 1));
+		VirtualFree(Reserved, 0, MEM_RELEASE);
+
+		if( void* const Result = VirtualAlloc(Aligned, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE) )
+		{
+			return Result;
+		}
+	}
+	return nullptr;
+}
+
+void FWindowsPlatformMemory::FreeVirtual(void* Ptr, SIZE_T Size)
+{
+	if( Ptr == nullptr ) return;
+	VirtualFree(Ptr, 0, MEM_RELEASE);
+}
+
+#endif // PLATFORM_WINDOWS
@@ -96,4 +96,22 @@ int32 FCPUIDQueriedData::QueryCacheLineSize()
 	return Result;
 }
 
+bool FCPUIDQueriedData::QueryHasAVX2()
+{
+	if( !CheckForCPUIDInstruction() ) return false;
+
+	int Args[4];
+	__cpuid(Args, 0);
+	if( Args[0] < 7 ) return false;
+
+	// AVX is usable only when OS enabled XSAVE and saves XMM and YMM state
+	__cpuid(Args, 1);
+	const bool bHasOSXSave = (Args[2] & (1 << 27)) != 0;
+	const bool bHasAVX = (Args[2] & (1 << 28)) != 0;
+	if( !bHasOSXSave || !bHasAVX || (_xgetbv(0) & 0x6) != 0x6 ) return false;
+
+	__cpuidex(Args, 7, 0);
+	return (Args[1] & (1 << 5)) != 0;
+}
+
 #endif // PLATFORM_WINDOWS
\ No newline at end of file
@@ -785,6 +785,12 @@ int32 FWindowsPlatformMisc::GetCacheLineSize()
 	return FCPUIDQueriedData::GetCacheLineSize();
 }
 
+bool FWindowsPlatformMisc::HasAVX2InstructionSupport()
+{
+	static const bool bHasAVX2 = FCPUIDQueriedData::QueryHasAVX2();
+	return bHasAVX2;
+}
+
 FString FWindowsPlatformMisc::GetPrimaryGPUBrand()
 {
 	static FString PrimaryGPUBrand;
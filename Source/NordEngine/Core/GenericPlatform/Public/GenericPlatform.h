@@ -233,6 +233,9 @@ struct FGenericPlatformTypes
 #ifndef PLATFORM_ALWAYS_HAS_AVX
 	#define PLATFORM_ALWAYS_HAS_AVX 0
 #endif
+#ifndef PLATFORM_ALWAYS_HAS_AVX2
+	#define PLATFORM_ALWAYS_HAS_AVX2 0
+#endif
 #ifndef PLATFORM_ALWAYS_HAS_FMA3
 	#define PLATFORM_ALWAYS_HAS_FMA3 0
 #endif
@@ -242,6 +245,9 @@ struct FGenericPlatformTypes
 #ifndef PLATFORM_HAS_128BIT_ATOMICS
 	#define PLATFORM_HAS_128BIT_ATOMICS 0
 #endif
+#ifndef PLATFORM_CACHE_LINE_SIZE
+	#define PLATFORM_CACHE_LINE_SIZE 64
+#endif
 #ifndef PLATFORM_SUPPORTS_COLORIZED_OUTPUT_DEVICE
 	#define PLATFORM_SUPPORTS_COLORIZED_OUTPUT_DEVICE PLATFORM_DESKTOP
 #endif
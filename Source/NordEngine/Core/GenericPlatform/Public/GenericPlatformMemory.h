@@ -0,0 +1,43 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+
+
+
+
+/**
+	Generic access to memory pages for platforms without virtual memory API.
+	Pages are taken from the C heap, so alignment is paid with over-allocation.
+*/
+struct ENGINE_API FGenericPlatformMemory
+{
+	/**
+		@return size and alignment of the smallest region OS can map.
+	*/
+	static FORCEINLINE SIZE_T GetAllocationGranularity() noexcept { return 64 * 1024; }
+
+	/**
+		Allocate committed zero filled region of Size bytes aligned to Alignment.
+		Size is rounded up to allocation granularity, Alignment must be power of two.
+
+		@return null if out of memory.
+	*/
+	static void* AllocateVirtual(SIZE_T Size, SIZE_T Alignment);
+	/**
+		Return region from AllocateVirtual to the OS. Size must be the same as on allocation.
+	*/
+	static void FreeVirtual(void* Ptr, SIZE_T Size);
+};
+
+
+
+
+// clang-format off
+// FPlatformMemory will be defined.
+#if WIN32 || WIN64
+	#include "Windows/WindowsPlatformMemory/WindowsPlatformMemory.h"
+#else
+	#error "Undefined platform!"
+#endif
+// clang-format on
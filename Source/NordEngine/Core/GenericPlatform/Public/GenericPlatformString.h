@@ -8,9 +8,26 @@
 
 /**
 	Generic string implementation for most platforms.
+
+	Strlen, Strcpy and comparisons of strings with the same char type are vectorized for both char widths.
+	AVX2 or SSE2 version is selected on first call from CPUID.
+	Scanning may read past the terminator, but never across a memory page boundary, so it can't fault.
 */
 struct ENGINE_API FGenericPlatformString
 {
+	static int32 Strlen(const ANSICHAR* String);
+	static int32 Strlen(const WIDECHAR* String);
+
+	/**
+		Copy null terminated Src. Src with its terminator must fit DestCount chars, this is checked when DO_CHECK is on.
+		Without checks a longer Src is truncated to DestCount - 1 chars, Dest is always null terminated.
+	*/
+	static void Strcpy(ANSICHAR* Dest, SIZE_T DestCount, const ANSICHAR* Src);
+	static void Strcpy(WIDECHAR* Dest, SIZE_T DestCount, const WIDECHAR* Src);
+
+	static int32 Strcmp(const ANSICHAR* String1, const ANSICHAR* String2);
+	static int32 Strcmp(const WIDECHAR* String1, const WIDECHAR* String2);
+
 	static int32 Stricmp(const ANSICHAR* String1, const ANSICHAR* String2);
 	static int32 Stricmp(const WIDECHAR* String1, const WIDECHAR* String2);
 
@@ -19,6 +19,9 @@
 */
 struct ENGINE_API FStandardPlatformString : public FGenericPlatformString
 {
+	using FGenericPlatformString::Strlen;
+	using FGenericPlatformString::Strcpy;
+	using FGenericPlatformString::Strcmp;
 	using FGenericPlatformString::Stricmp;
 	using FGenericPlatformString::Strncmp;
 	using FGenericPlatformString::Strnicmp;
@@ -45,16 +48,12 @@ struct ENGINE_API FStandardPlatformString : public FGenericPlatformString
 
 	//........................... Wide character implementation..............................//
 
-	static FORCEINLINE void Strcpy(WIDECHAR* Dest, SIZE_T DestCount, const WIDECHAR* Src) { wcscpy_s(Dest, DestCount, Src); }
 	static FORCEINLINE void Strncpy(WIDECHAR* Dest, const WIDECHAR* Src, SIZE_T MaxLen)
 	{
 		wcsncpy(Dest, Src, MaxLen - 1);
 		Dest[MaxLen - 1] = 0;
 	}
 	static FORCEINLINE void Strcat(WIDECHAR* Dest, SIZE_T DestCount, const WIDECHAR* Src) { wcscat_s(Dest, DestCount, Src); }
-	static FORCEINLINE int32 Strcmp(const WIDECHAR* String1, const WIDECHAR* String2) { return wcscmp(String1, String2); }
-	static FORCEINLINE int32 Strncmp(const WIDECHAR* String1, const WIDECHAR* String2, SIZE_T Count) { return wcsncmp(String1, String2, Count); }
-	static FORCEINLINE int32 Strlen(const WIDECHAR* String) { return (int32)wcslen(String); }
 	static FORCEINLINE int32 Strnlen(const WIDECHAR* String, SIZE_T StringSize) { return (int32)wcsnlen_s(String, StringSize); }
 	static FORCEINLINE const WIDECHAR* Strstr(const WIDECHAR* String, const WIDECHAR* Find) { return wcsstr(String, Find); }
 	static FORCEINLINE const WIDECHAR* Strchr(const WIDECHAR* String, WIDECHAR C) { return wcschr(String, C); }
@@ -88,16 +87,12 @@ struct ENGINE_API FStandardPlatformString : public FGenericPlatformString
 
 	//..................................Ansi implementation..................................//
 
-	static FORCEINLINE void Strcpy(ANSICHAR* Dest, SIZE_T DestCount, const ANSICHAR* Src) { strcpy_s(Dest, DestCount, Src); }
 	static FORCEINLINE void Strncpy(ANSICHAR* Dest, const ANSICHAR* Src, int32 MaxLen)
 	{
 		strncpy(Dest, Src, MaxLen);
 		Dest[MaxLen - 1] = 0;
 	}
 	static FORCEINLINE void Strcat(ANSICHAR* Dest, SIZE_T DestCount, const ANSICHAR* Src) { strcat_s(Dest, DestCount, Src); }
-	static FORCEINLINE int32 Strcmp(const ANSICHAR* String1, const ANSICHAR* String2) { return strcmp(String1, String2); }
-	static FORCEINLINE int32 Strncmp(const ANSICHAR* String1, const ANSICHAR* String2, SIZE_T Count) { return strncmp(String1, String2, Count); }
-	static FORCEINLINE int32 Strlen(const ANSICHAR* String) { return (int32)strlen(String); }
 	static FORCEINLINE int32 Strnlen(const ANSICHAR* String, SIZE_T StringSize) { return (int32)strnlen_s(String, StringSize); }
 	static FORCEINLINE const ANSICHAR* Strstr(const ANSICHAR* String, const ANSICHAR* Find) { return strstr(String, Find); }
 	static FORCEINLINE const ANSICHAR* Strchr(const ANSICHAR* String, ANSICHAR C) { return strchr(String, C); }
@@ -55,6 +55,7 @@ using FPlatformTypes = FWindowsPlatformTypes;
 #define PLATFORM_ALWAYS_HAS_SSE4_1 0
 #define PLATFORM_MAYBE_HAS_AVX 0
 #define PLATFORM_ALWAYS_HAS_AVX 0
+#define PLATFORM_ALWAYS_HAS_AVX2 0
 #define PLATFORM_ALWAYS_HAS_FMA3 0
 #define PLATFORM_WEAKLY_CONSISTENT_MEMORY 0
 #define PLATFORM_HAS_128BIT_ATOMICS 1
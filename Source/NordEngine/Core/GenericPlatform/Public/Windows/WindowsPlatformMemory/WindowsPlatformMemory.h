@@ -0,0 +1,26 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+
+#if !PLATFORM_WINDOWS
+#error PLATFORM_WINDOWS not defined!
+#endif
+
+#include "GenericPlatformMemory.h"
+
+
+
+
+/**
+	Windows memory pages implementation over VirtualAlloc.
+*/
+struct ENGINE_API FWindowsPlatformMemory : public FGenericPlatformMemory
+{
+	static SIZE_T GetAllocationGranularity() noexcept;
+
+	static void* AllocateVirtual(SIZE_T Size, SIZE_T Alignment);
+	static void FreeVirtual(void* Ptr, SIZE_T Size);
+};
+
+using FPlatformMemory = FWindowsPlatformMemory;
@@ -71,6 +71,14 @@ public:
 	*/
 	static FORCEINLINE int32 GetCacheLineSize() noexcept { return CPUIDStaticCache.CacheLineSize; }
 
+	/**
+		Checks if CPU supports AVX2 and OS saves YMM registers.
+		Queries __cpuid directly instead of static cache, so it is safe to call during static initialization.
+
+		@return True if AVX2 instructions can be used.
+	*/
+	static bool QueryHasAVX2();
+
 private:
 
 	/**
@@ -100,6 +100,10 @@ struct ENGINE_API FWindowsPlatformMisc
 	*/
 	static uint32 GetCPUInfo();
 	static int32 GetCacheLineSize();
+	/**
+		@return true if CPU and OS support AVX2, safe to call during static initialization.
+	*/
+	static bool HasAVX2InstructionSupport();
 
 	static FString GetPrimaryGPUBrand();
 
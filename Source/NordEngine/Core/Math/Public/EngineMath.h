@@ -865,7 +865,10 @@ struct ENGINE_API FMath
 */
 #if defined(_MSC_VER)
 #pragma intrinsic(_BitScanForward)
-	FORCEINLINE uint32 CountTrailingZeros(uint32 Value)
+#pragma intrinsic(_BitScanReverse)
+#pragma intrinsic(_BitScanForward64)
+#pragma intrinsic(_BitScanReverse64)
+	static FORCEINLINE uint32 CountTrailingZeros(uint32 Value)
 	{
 		if( Value == 0 )
 		{
@@ -875,8 +878,53 @@ struct ENGINE_API FMath
 		_BitScanForward(&BitIndex, Value); // Scans from LSB to MSB
 		return BitIndex;
 	}
+	/**
+		Counts the number of leading zeros in the bit representation of the value, counting from most-significant bit to least.
+
+		@return the number of zeros before the first "on" bit, 32 for zero.
+	*/
+	static FORCEINLINE uint32 CountLeadingZeros(uint32 Value)
+	{
+		if( Value == 0 )
+		{
+			return 32;
+		}
+		unsigned long BitIndex;			   // 0-based, where the LSB is 0 and MSB is 31
+		_BitScanReverse(&BitIndex, Value); // Scans from MSB to LSB
+		return 31 - BitIndex;
+	}
+	/**
+		Counts the number of trailing zeros in the bit representation of 64-bit value.
+
+		@return the number of zeros before the first "on" bit, 64 for zero.
+	*/
+	static FORCEINLINE uint32 CountTrailingZeros64(uint64 Value)
+	{
+		if( Value == 0 )
+		{
+			return 64;
+		}
+		unsigned long BitIndex;
+		_BitScanForward64(&BitIndex, Value);
+		return BitIndex;
+	}
+	/**
+		Counts the number of leading zeros in the bit representation of 64-bit value.
+
+		@return the number of zeros before the first "on" bit, 64 for zero.
+	*/
+	static FORCEINLINE uint32 CountLeadingZeros64(uint64 Value)
+	{
+		if( Value == 0 )
+		{
+			return 64;
+		}
+		unsigned long BitIndex;
+		_BitScanReverse64(&BitIndex, Value);
+		return 63 - BitIndex;
+	}
 #else  // !defined(_MSC_VER)
-	FORCEINLINE uint32 CountTrailingZeros(uint32 Value)
+	static FORCEINLINE uint32 CountTrailingZeros(uint32 Value)
 	{
 		if( Value == 0 )
 		{
@@ -884,5 +932,70 @@ struct ENGINE_API FMath
 		}
 		return __builtin_ffs(Value) - 1;
 	}
+	/**
+		Counts the number of leading zeros in the bit representation of the value, counting from most-significant bit to least.
+
+		@return the number of zeros before the first "on" bit, 32 for zero.
+	*/
+	static FORCEINLINE uint32 CountLeadingZeros(uint32 Value)
+	{
+		if( Value == 0 )
+		{
+			return 32;
+		}
+		return __builtin_clz(Value);
+	}
+	/**
+		Counts the number of trailing zeros in the bit representation of 64-bit value.
+
+		@return the number of zeros before the first "on" bit, 64 for zero.
+	*/
+	static FORCEINLINE uint32 CountTrailingZeros64(uint64 Value)
+	{
+		if( Value == 0 )
+		{
+			return 64;
+		}
+		return __builtin_ctzll(Value);
+	}
+	/**
+		Counts the number of leading zeros in the bit representation of 64-bit value.
+
+		@return the number of zeros before the first "on" bit, 64 for zero.
+	*/
+	static FORCEINLINE uint32 CountLeadingZeros64(uint64 Value)
+	{
+		if( Value == 0 )
+		{
+			return 64;
+		}
+		return __builtin_clzll(Value);
+	}
 #endif // _MSC_VER
+
+	/**
+		@return the smallest power of two that is greater than or equal to Value, 1 for zero.
+	*/
+	static FORCEINLINE uint32 RoundUpToPowerOfTwo(uint32 Value)
+	{
+		return Value <= 1 ? 1 : 1u << (32 - CountLeadingZeros(Value - 1));
+	}
+	/**
+		@return count of "on" bits in Value.
+	*/
+	static FORCEINLINE uint32 CountBits(uint32 Value)
+	{
+		Value = Value - ((Value >> 1) & 0x55555555u);
+		Value = (Value & 0x33333333u) + ((Value >> 2) & 0x33333333u);
+		return (((Value + (Value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+	}
+	/**
+		@return count of "on" bits in 64-bit Value.
+	*/
+	static FORCEINLINE uint32 CountBits64(uint64 Value)
+	{
+		Value = Value - ((Value >> 1) & 0x5555555555555555ull);
+		Value = (Value & 0x3333333333333333ull) + ((Value >> 2) & 0x3333333333333333ull);
+		return static_cast<uint32>((((Value + (Value >> 4)) & 0x0F0F0F0F0F0F0F0Full) * 0x0101010101010101ull) >> 56);
+	}
 };
@@ -0,0 +1,71 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "EngineMemory.h"
+#include "MallocAnsi.h"
+#include "MallocBinned.h"
+#include "MallocTracked.h"
+
+#include "INI.h"
+#include "Path.h"
+
+
+
+
+FMalloc* GMalloc = nullptr;
+
+/**
+	Allocator requested by FMemory::SetupAllocator.
+*/
+static EMallocType GRequestedMallocType = EMallocType::Default;
+static bool GRequestedMemoryTracking = false;
+
+
+
+static FMalloc* CreateAllocator()
+{
+	EMallocType Type = GRequestedMallocType;
+	bool bTrackMemory = GRequestedMemoryTracking;
+	if( Type == EMallocType::Default )
+	{
+		const FINIFile IniFile(FPath::GetEngineConfigPath());
+
+		Type = IniFile.Get<std::string>("Memory", "Allocator", "") == "Ansi" ? EMallocType::Ansi : EMallocType::Binned;
+		bTrackMemory = bTrackMemory || IniFile.Get<bool>("Memory", "Tracking", false);
+	}
+
+	// Allocators are never destroyed, memory may be freed by static destructors
+	FMalloc* Allocator = nullptr;
+	if( Type == EMallocType::Binned && FMallocBinned::IsAvailable() )
+	{
+		Allocator = new FMallocBinned();
+	}
+	else
+	{
+		Allocator = new FMallocAnsi();
+	}
+
+	if( bTrackMemory )
+	{
+		Allocator = new FMallocTracked(Allocator);
+	}
+	return Allocator;
+}
+
+
+
+
+
+bool FMemory::SetupAllocator(EMallocType Type, bool bTrackMemory)
+{
+	if( GMalloc != nullptr ) return false;
+
+	GRequestedMallocType = Type;
+	GRequestedMemoryTracking = bTrackMemory;
+	CreateGMalloc();
+	return true;
+}
+
+void FMemory::CreateGMalloc()
+{
+	static FMalloc* const Allocator = CreateAllocator();
+	GMalloc = Allocator;
+}
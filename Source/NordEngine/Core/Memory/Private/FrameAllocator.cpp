@@ -0,0 +1,72 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "FrameAllocator.h"
+#include "MemoryArena.h"
+
+#include "GenericPlatformAtomic.h"
+
+
+
+
+
+namespace FrameAllocator_Private
+{
+/**
+	Arena is reset when it is reused in a newer frame.
+*/
+struct FFrameArena
+{
+	FMemoryArena Arena {FFrameAllocator::BlockSize};
+	uint64 Frame = 0;
+};
+
+/**
+	Arenas of one thread. OneFrame memory uses Arenas[0], TwoFrames memory alternates Arenas[1] and Arenas[2] by frame parity.
+*/
+struct FThreadArenas
+{
+	FFrameArena Arenas[3];
+};
+
+static std::atomic<uint64> GFrameNumber {0};
+static thread_local FThreadArenas GThreadArenas;
+} // namespace FrameAllocator_Private
+
+using namespace FrameAllocator_Private;
+
+
+
+
+
+void* FFrameAllocator::Allocate(SIZE_T Size, SIZE_T Alignment, EFrameMemoryLifetime Lifetime)
+{
+	const uint64 Frame = GFrameNumber.load(std::memory_order_relaxed);
+	const uint32 Index = Lifetime == EFrameMemoryLifetime::OneFrame ? 0 : 1 + static_cast<uint32>(Frame & 1);
+
+	FFrameArena& FrameArena = GThreadArenas.Arenas[Index];
+	if( UNLIKELY(FrameArena.Frame != Frame) )
+	{
+		FrameArena.Arena.Reset();
+		FrameArena.Frame = Frame;
+	}
+	return FrameArena.Arena.Allocate(Size, Alignment);
+}
+
+void FFrameAllocator::BeginFrame()
+{
+	GFrameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 FFrameAllocator::GetFrameNumber()
+{
+	return GFrameNumber.load(std::memory_order_relaxed);
+}
+
+SIZE_T FFrameAllocator::GetThreadReservedBytes()
+{
+	SIZE_T Result = 0;
+	for( const FFrameArena& FrameArena : GThreadArenas.Arenas )
+	{
+		Result += FrameArena.Arena.GetReservedBytes();
+	}
+	return Result;
+}
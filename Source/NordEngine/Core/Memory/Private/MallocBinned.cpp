@@ -0,0 +1,691 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MallocBinned.h"
+#include "EngineMemory.h"
+#include "GenericPlatformMemory.h"
+#include "GenericPlatformAtomic.h"
+
+#include "EngineMath.h"
+#include "AssertionMacros.h"
+
+#include <new>
+
+// We require SSE2
+#include <emmintrin.h>
+
+
+
+
+
+namespace MallocBinned_Private
+{
+constexpr uint32 NumSizeClasses = 40;
+/**
+	Size class of spans that hold one large allocation.
+*/
+constexpr uint32 LargeSizeClass = NumSizeClasses;
+
+/**
+	Span sizes are multiple of this.
+*/
+constexpr SIZE_T SpanGranularity = 64 * KB_SZ;
+/**
+	Header takes two cache lines, so blocks start aligned and the remote free list does not share line with owner data.
+*/
+constexpr SIZE_T SpanHeaderSize = 2 * PLATFORM_CACHE_LINE_SIZE;
+/**
+	Small span is large enough to hold this count of blocks.
+*/
+constexpr uint32 MinBlocksPerSpan = 7;
+
+/**
+	Limits of free spans kept for reuse instead of returning to the OS.
+*/
+constexpr uint32 MaxCachedSpans = 64;
+constexpr SIZE_T MaxCachedBytes = 64 * MB_SZ;
+
+/**
+	Low bit of FSpan::RemoteFree, set while span is queued to its owner heap.
+*/
+constexpr UPTRINT QueuedBit = 1;
+
+static_assert(FMallocBinned::SpanAlignment % SpanGranularity == 0, "Span alignment must be multiple of span granularity");
+static_assert(SpanHeaderSize % FMalloc::DefaultAlignment == 0, "Blocks must be aligned");
+
+
+
+FORCEINLINE uint32 SizeToClass(SIZE_T Size)
+{
+	if( Size <= 128 ) return Size == 0 ? 0 : static_cast<uint32>((Size - 1) >> 4);
+
+	// Four classes per power of two: (2^k, 2^k + 2^(k-2) * 4]
+	const uint32 Value = static_cast<uint32>(Size - 1);
+	const uint32 Log = 31 - FMath::CountLeadingZeros(Value);
+	return 8 + (Log - 7) * 4 + ((Value >> (Log - 2)) - 4);
+}
+FORCEINLINE SIZE_T ClassToSize(uint32 Class)
+{
+	if( Class < 8 ) return (Class + 1) * 16;
+
+	const uint32 Log = 7 + (Class - 8) / 4;
+	return (SIZE_T(1) << Log) + ((Class - 8) % 4 + 1) * (SIZE_T(1) << (Log - 2));
+}
+FORCEINLINE SIZE_T RoundUpToSpanGranularity(SIZE_T Size)
+{
+	return (Size + SpanGranularity - 1) & ~(SpanGranularity - 1);
+}
+
+
+
+struct FThreadHeap;
+
+/**
+	Free block, the link is stored in block memory.
+*/
+struct FFreeBlock
+{
+	FFreeBlock* Next;
+};
+
+/**
+	Header at the start of each span.
+*/
+struct FSpan
+{
+	uint8 SizeClass = 0;
+	/**
+		Span is in FBin::Available list.
+	*/
+	bool bLinked = false;
+	/**
+		Count of blocks span can hold.
+	*/
+	uint16 Capacity = 0;
+
+	// Owner thread only
+
+	/**
+		Blocks not in FreeList, including the ones in RemoteFree.
+	*/
+	uint16 NumUsed = 0;
+	/**
+		Blocks taken from the never used tail, so new span does not need free list built.
+	*/
+	uint16 NumBumped = 0;
+
+	/**
+		Bytes of each block, for large span bytes after header.
+	*/
+	SIZE_T BlockSize = 0;
+	SIZE_T SpanSize = 0;
+	/**
+		Heap of thread that allocates from this span. Null for large span.
+	*/
+	FThreadHeap* Owner = nullptr;
+
+	FFreeBlock* FreeList = nullptr;
+	/**
+		Links in FBin::Available list.
+	*/
+	FSpan* Prev = nullptr;
+	FSpan* Next = nullptr;
+
+	/**
+		Link in FThreadHeap::RemoteSpans, written by thread that queues the span.
+	*/
+	FSpan* NextRemote = nullptr;
+
+	/**
+		Blocks freed by other threads with QueuedBit.
+	*/
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<UPTRINT> RemoteFree {0};
+};
+static_assert(sizeof(FSpan) <= SpanHeaderSize, "Span header does not fit");
+
+struct FBin
+{
+	/**
+		Spans that may have free blocks, most recently freed into first.
+	*/
+	FSpan* Available = nullptr;
+};
+
+/**
+	Per thread allocator state. Heaps are never destroyed, so other threads can always queue frees to them.
+*/
+struct FThreadHeap
+{
+	FBin Bins[NumSizeClasses];
+	FThreadHeap* NextAbandoned = nullptr;
+
+	/**
+		Spans with blocks freed by other threads.
+	*/
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<FSpan*> RemoteSpans {nullptr};
+};
+
+
+
+/**
+	Lock for rare global operations: heap creation and span cache.
+*/
+class FSpinLock
+{
+public:
+
+	FORCEINLINE void Lock() noexcept
+	{
+		while( bLocked.exchange(true, std::memory_order_acquire) )
+		{
+			while( bLocked.load(std::memory_order_relaxed) )
+			{
+				_mm_pause();
+			}
+		}
+	}
+	FORCEINLINE void Unlock() noexcept { bLocked.store(false, std::memory_order_release); }
+
+private:
+
+	std::atomic<bool> bLocked {false};
+};
+
+class FScopeSpinLock
+{
+public:
+
+	FORCEINLINE explicit FScopeSpinLock(FSpinLock& InLock) noexcept : Lock(InLock) { Lock.Lock(); }
+	FORCEINLINE ~FScopeSpinLock() noexcept { Lock.Unlock(); }
+
+private:
+
+	FSpinLock& Lock;
+};
+
+/**
+	Shared state, constant initialized so allocations work during static initialization.
+*/
+struct FGlobalState
+{
+	FSpinLock Lock;
+
+	FThreadHeap* AbandonedHeaps = nullptr;
+	/**
+		Heaps are carved from OS chunks.
+	*/
+	uint8* HeapChunkCursor = nullptr;
+	uint8* HeapChunkEnd = nullptr;
+
+	struct FCachedSpan
+	{
+		void* Memory = nullptr;
+		SIZE_T Size = 0;
+	};
+	FCachedSpan CachedSpans[MaxCachedSpans] = {};
+	uint32 NumCachedSpans = 0;
+	SIZE_T CachedBytes = 0;
+};
+static FGlobalState GState;
+
+
+
+/**
+	Releases heap of finished thread for reuse.
+*/
+struct FThreadHeapReleaser
+{
+	~FThreadHeapReleaser();
+
+	FORCEINLINE void Register() noexcept { }
+};
+
+static thread_local FThreadHeap* GThreadHeap = nullptr;
+static thread_local bool GThreadHeapReleased = false;
+static thread_local FThreadHeapReleaser GThreadHeapReleaser;
+
+
+
+FORCEINLINE FSpan* GetSpan(const void* Ptr)
+{
+	return reinterpret_cast<FSpan*>(reinterpret_cast<UPTRINT>(Ptr) & ~(static_cast<UPTRINT>(FMallocBinned::SpanAlignment) - 1));
+}
+
+void* AllocateSpanMemory(SIZE_T Size)
+{
+	{
+		FScopeSpinLock ScopeLock(GState.Lock);
+		for( uint32 i = GState.NumCachedSpans; i-- > 0; )
+		{
+			if( GState.CachedSpans[i].Size == Size )
+			{
+				void* const Memory = GState.CachedSpans[i].Memory;
+				GState.CachedSpans[i] = GState.CachedSpans[--GState.NumCachedSpans];
+				GState.CachedBytes -= Size;
+				return Memory;
+			}
+		}
+	}
+	return FPlatformMemory::AllocateVirtual(Size, FMallocBinned::SpanAlignment);
+}
+
+void ReleaseSpanMemory(void* Memory, SIZE_T Size)
+{
+	{
+		FScopeSpinLock ScopeLock(GState.Lock);
+		if( GState.NumCachedSpans < MaxCachedSpans && GState.CachedBytes + Size <= MaxCachedBytes )
+		{
+			GState.CachedSpans[GState.NumCachedSpans++] = {Memory, Size};
+			GState.CachedBytes += Size;
+			return;
+		}
+	}
+	FPlatformMemory::FreeVirtual(Memory, Size);
+}
+
+
+
+FORCEINLINE void LinkSpan(FBin& Bin, FSpan* Span)
+{
+	Span->Prev = nullptr;
+	Span->Next = Bin.Available;
+	if( Bin.Available != nullptr ) Bin.Available->Prev = Span;
+	Bin.Available = Span;
+	Span->bLinked = true;
+}
+
+FORCEINLINE void UnlinkSpan(FBin& Bin, FSpan* Span)
+{
+	if( Span->Prev != nullptr ) Span->Prev->Next = Span->Next;
+	else Bin.Available = Span->Next;
+	if( Span->Next != nullptr ) Span->Next->Prev = Span->Prev;
+	Span->Prev = nullptr;
+	Span->Next = nullptr;
+	Span->bLinked = false;
+}
+
+FORCEINLINE void* AllocateFromSpan(FSpan* Span)
+{
+	if( FFreeBlock* const Block = Span->FreeList )
+	{
+		Span->FreeList = Block->Next;
+		++Span->NumUsed;
+		return Block;
+	}
+	if( Span->NumBumped < Span->Capacity )
+	{
+		void* const Block = reinterpret_cast<uint8*>(Span) + SpanHeaderSize + static_cast<SIZE_T>(Span->NumBumped) * Span->BlockSize;
+		++Span->NumBumped;
+		++Span->NumUsed;
+		return Block;
+	}
+	return nullptr;
+}
+
+FSpan* CreateSmallSpan(FThreadHeap* Heap, uint32 Class)
+{
+	const SIZE_T BlockSize = ClassToSize(Class);
+	const SIZE_T SpanSize = RoundUpToSpanGranularity(SpanHeaderSize + BlockSize * MinBlocksPerSpan);
+
+	void* const Memory = AllocateSpanMemory(SpanSize);
+	if( Memory == nullptr ) return nullptr;
+
+	FSpan* const Span = new(Memory) FSpan();
+	Span->SizeClass = static_cast<uint8>(Class);
+	Span->Capacity = static_cast<uint16>((SpanSize - SpanHeaderSize) / BlockSize);
+	Span->BlockSize = BlockSize;
+	Span->SpanSize = SpanSize;
+	Span->Owner = Heap;
+	return Span;
+}
+
+/**
+	Called by owner when span got free blocks. Links it back to available spans or releases it when empty.
+*/
+void OnSpanFreed(FThreadHeap* Heap, FSpan* Span)
+{
+	FBin& Bin = Heap->Bins[Span->SizeClass];
+	if( !Span->bLinked ) LinkSpan(Bin, Span);
+
+	// Last span of the bin is kept to avoid getting it from the cache on every alloc/free pair
+	if( Span->NumUsed == 0 && (Span->Prev != nullptr || Span->Next != nullptr) )
+	{
+		UnlinkSpan(Bin, Span);
+		ReleaseSpanMemory(Span, Span->SpanSize);
+	}
+}
+
+/**
+	Move blocks freed by other threads to local free lists.
+*/
+void CollectRemoteFrees(FThreadHeap* Heap)
+{
+	FSpan* Span = Heap->RemoteSpans.exchange(nullptr, std::memory_order_acquire);
+	while( Span != nullptr )
+	{
+		// Span can be queued again right after its list is taken, so the link is read first
+		FSpan* const NextSpan = Span->NextRemote;
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Span->RemoteFree.exchange(0, std::memory_order_acq_rel) & ~QueuedBit);
+
+		uint16 NumFreed = 0;
+		while( Block != nullptr )
+		{
+			FFreeBlock* const NextBlock = Block->Next;
+			Block->Next = Span->FreeList;
+			Span->FreeList = Block;
+			Block = NextBlock;
+			++NumFreed;
+		}
+		Span->NumUsed -= NumFreed;
+		OnSpanFreed(Heap, Span);
+
+		Span = NextSpan;
+	}
+}
+
+NOINLINE void* AllocateSmallSlow(FThreadHeap* Heap, uint32 Class)
+{
+	FBin& Bin = Heap->Bins[Class];
+
+	for( bool bCollected = false;; bCollected = true )
+	{
+		while( FSpan* const Span = Bin.Available )
+		{
+			if( void* const Block = AllocateFromSpan(Span) ) return Block;
+			// Full span leaves the list until one of its blocks is freed
+			UnlinkSpan(Bin, Span);
+		}
+		if( bCollected ) break;
+		CollectRemoteFrees(Heap);
+	}
+
+	FSpan* const Span = CreateSmallSpan(Heap, Class);
+	if( Span == nullptr ) return nullptr;
+
+	LinkSpan(Bin, Span);
+	return AllocateFromSpan(Span);
+}
+
+FORCEINLINE void* AllocateSmall(FThreadHeap* Heap, uint32 Class)
+{
+	if( FSpan* const Span = Heap->Bins[Class].Available )
+	{
+		if( void* const Block = AllocateFromSpan(Span) ) return Block;
+	}
+	return AllocateSmallSlow(Heap, Class);
+}
+
+FORCEINLINE void FreeSmallLocal(FThreadHeap* Heap, FSpan* Span, void* Ptr)
+{
+	FFreeBlock* const Block = static_cast<FFreeBlock*>(Ptr);
+	Block->Next = Span->FreeList;
+	Span->FreeList = Block;
+	--Span->NumUsed;
+
+	if( UNLIKELY(!Span->bLinked || Span->NumUsed == 0) ) OnSpanFreed(Heap, Span);
+}
+
+void FreeSmallRemote(FSpan* Span, void* Ptr)
+{
+	FFreeBlock* const Block = static_cast<FFreeBlock*>(Ptr);
+
+	UPTRINT OldValue = Span->RemoteFree.load(std::memory_order_relaxed);
+	do
+	{
+		Block->Next = reinterpret_cast<FFreeBlock*>(OldValue & ~QueuedBit);
+	} while( !Span->RemoteFree.compare_exchange_weak(OldValue, reinterpret_cast<UPTRINT>(Block) | QueuedBit, std::memory_order_acq_rel, std::memory_order_relaxed) );
+
+	// The thread that set the bit queues span to owner. Owner can't release span before that, the block is still counted as used.
+	if( (OldValue & QueuedBit) == 0 )
+	{
+		FThreadHeap* const Owner = Span->Owner;
+		FSpan* Top = Owner->RemoteSpans.load(std::memory_order_relaxed);
+		do
+		{
+			Span->NextRemote = Top;
+		} while( !Owner->RemoteSpans.compare_exchange_weak(Top, Span, std::memory_order_release, std::memory_order_relaxed) );
+	}
+}
+
+/**
+	@param Offset - offset of block from span start, at least SpanHeaderSize.
+*/
+void* AllocateLarge(SIZE_T Size, SIZE_T Offset = SpanHeaderSize)
+{
+	if( Size > ~SIZE_T(0) - Offset - SpanGranularity ) return nullptr;
+
+	const SIZE_T SpanSize = RoundUpToSpanGranularity(Size + Offset);
+	void* const Memory = AllocateSpanMemory(SpanSize);
+	if( Memory == nullptr ) return nullptr;
+
+	FSpan* const Span = new(Memory) FSpan();
+	Span->SizeClass = LargeSizeClass;
+	Span->Capacity = 1;
+	Span->BlockSize = SpanSize - Offset;
+	Span->SpanSize = SpanSize;
+	return reinterpret_cast<uint8*>(Span) + Offset;
+}
+
+FThreadHeap* AcquireHeap()
+{
+	FScopeSpinLock ScopeLock(GState.Lock);
+
+	if( FThreadHeap* const Heap = GState.AbandonedHeaps )
+	{
+		GState.AbandonedHeaps = Heap->NextAbandoned;
+		Heap->NextAbandoned = nullptr;
+		return Heap;
+	}
+
+	if( GState.HeapChunkCursor == nullptr || GState.HeapChunkCursor + sizeof(FThreadHeap) > GState.HeapChunkEnd )
+	{
+		uint8* const Chunk = static_cast<uint8*>(FPlatformMemory::AllocateVirtual(SpanGranularity, SpanGranularity));
+		if( Chunk == nullptr ) return nullptr;
+
+		GState.HeapChunkCursor = Chunk;
+		GState.HeapChunkEnd = Chunk + SpanGranularity;
+	}
+
+	FThreadHeap* const Heap = new(GState.HeapChunkCursor) FThreadHeap();
+	GState.HeapChunkCursor += (sizeof(FThreadHeap) + PLATFORM_CACHE_LINE_SIZE - 1) & ~SIZE_T(PLATFORM_CACHE_LINE_SIZE - 1);
+	return Heap;
+}
+
+void AbandonHeap(FThreadHeap* Heap)
+{
+	CollectRemoteFrees(Heap);
+
+	// Nobody allocates from this heap until it is reused, so empty spans kept for reuse are released
+	for( FBin& Bin : Heap->Bins )
+	{
+		FSpan* Span = Bin.Available;
+		while( Span != nullptr )
+		{
+			FSpan* const NextSpan = Span->Next;
+			if( Span->NumUsed == 0 )
+			{
+				UnlinkSpan(Bin, Span);
+				ReleaseSpanMemory(Span, Span->SpanSize);
+			}
+			Span = NextSpan;
+		}
+	}
+
+	FScopeSpinLock ScopeLock(GState.Lock);
+	Heap->NextAbandoned = GState.AbandonedHeaps;
+	GState.AbandonedHeaps = Heap;
+}
+
+FThreadHeapReleaser::~FThreadHeapReleaser()
+{
+	if( GThreadHeap != nullptr )
+	{
+		AbandonHeap(GThreadHeap);
+		GThreadHeap = nullptr;
+	}
+	GThreadHeapReleased = true;
+}
+
+NOINLINE FThreadHeap* CreateThreadHeap()
+{
+	FThreadHeap* const Heap = AcquireHeap();
+	GThreadHeap = Heap;
+
+	// Allocations from destructors of other thread locals after release get a heap that is never reused
+	if( Heap != nullptr && !GThreadHeapReleased )
+	{
+		GThreadHeapReleaser.Register();
+	}
+	return Heap;
+}
+
+FORCEINLINE FThreadHeap* GetThreadHeap()
+{
+	FThreadHeap* const Heap = GThreadHeap;
+	return LIKELY(Heap != nullptr) ? Heap : CreateThreadHeap();
+}
+} // namespace MallocBinned_Private
+
+using namespace MallocBinned_Private;
+
+
+
+
+
+bool FMallocBinned::IsAvailable()
+{
+	void* const Memory = FPlatformMemory::AllocateVirtual(SpanGranularity, SpanAlignment);
+	if( Memory == nullptr ) return false;
+
+	FPlatformMemory::FreeVirtual(Memory, SpanGranularity);
+	return true;
+}
+
+void* FMallocBinned::Malloc(SIZE_T Size)
+{
+	if( LIKELY(Size <= MaxSmallSize) )
+	{
+		FThreadHeap* const Heap = GetThreadHeap();
+		return LIKELY(Heap != nullptr) ? AllocateSmall(Heap, SizeToClass(Size)) : nullptr;
+	}
+	return AllocateLarge(Size);
+}
+
+void* FMallocBinned::Realloc(void* Ptr, SIZE_T NewSize)
+{
+	if( Ptr == nullptr ) return Malloc(NewSize);
+	if( NewSize == 0 )
+	{
+		Free(Ptr);
+		return nullptr;
+	}
+
+	const FSpan* const Span = GetSpan(Ptr);
+	const SIZE_T OldSize = Span->BlockSize;
+
+	// Keep the block while new size has the same class or large block would not waste more than half
+	if( Span->SizeClass != LargeSizeClass )
+	{
+		if( NewSize <= MaxSmallSize && SizeToClass(NewSize) == Span->SizeClass ) return Ptr;
+	}
+	else if( NewSize > MaxSmallSize && NewSize <= OldSize && NewSize >= OldSize / 2 )
+	{
+		return Ptr;
+	}
+
+	void* const NewPtr = Malloc(NewSize);
+	if( NewPtr == nullptr ) return nullptr;
+
+	FMemory::MemCpy(NewPtr, Ptr, FMath::Min(OldSize, NewSize));
+	Free(Ptr);
+	return NewPtr;
+}
+
+void* FMallocBinned::MallocAligned(SIZE_T Size, SIZE_T Alignment)
+{
+	checkf(FMath::IsPowerOfTwo(Alignment) && Alignment < SpanAlignment, TEXT("Unsupported alignment"));
+	if( Alignment <= DefaultAlignment ) return Malloc(Size);
+
+	// Blocks start at SpanHeaderSize, so block is aligned when its size is multiple of alignment
+	if( Alignment <= SpanHeaderSize && Size <= MaxSmallSize )
+	{
+		const SIZE_T AlignedSize = Size == 0 ? Alignment : (Size + Alignment - 1) & ~(Alignment - 1);
+		for( uint32 Class = SizeToClass(AlignedSize); Class < NumSizeClasses; ++Class )
+		{
+			if( ClassToSize(Class) % Alignment != 0 ) continue;
+
+			FThreadHeap* const Heap = GetThreadHeap();
+			return LIKELY(Heap != nullptr) ? AllocateSmall(Heap, Class) : nullptr;
+		}
+	}
+
+	// Span is aligned to SpanAlignment, so block at offset of Alignment is aligned
+	return AllocateLarge(Size, FMath::Max(Alignment, SpanHeaderSize));
+}
+
+void* FMallocBinned::ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment)
+{
+	if( Alignment <= DefaultAlignment ) return Realloc(Ptr, NewSize);
+	if( Ptr == nullptr ) return MallocAligned(NewSize, Alignment);
+	if( NewSize == 0 )
+	{
+		Free(Ptr);
+		return nullptr;
+	}
+
+	const SIZE_T OldSize = GetSpan(Ptr)->BlockSize;
+
+	// Keep the block while it is aligned and would not waste more than half
+	if( (reinterpret_cast<UPTRINT>(Ptr) & (Alignment - 1)) == 0 && NewSize <= OldSize && NewSize >= OldSize / 2 ) return Ptr;
+
+	void* const NewPtr = MallocAligned(NewSize, Alignment);
+	if( NewPtr == nullptr ) return nullptr;
+
+	FMemory::MemCpy(NewPtr, Ptr, FMath::Min(OldSize, NewSize));
+	Free(Ptr);
+	return NewPtr;
+}
+
+void FMallocBinned::Free(void* Ptr)
+{
+	if( Ptr == nullptr ) return;
+
+	FSpan* const Span = GetSpan(Ptr);
+	if( UNLIKELY(Span->SizeClass == LargeSizeClass) )
+	{
+		ReleaseSpanMemory(Span, Span->SpanSize);
+		return;
+	}
+
+	FThreadHeap* const Heap = GThreadHeap;
+	if( LIKELY(Span->Owner == Heap) )
+	{
+		FreeSmallLocal(Heap, Span, Ptr);
+	}
+	else
+	{
+		FreeSmallRemote(Span, Ptr);
+	}
+}
+
+bool FMallocBinned::GetAllocationSize(void* Ptr, SIZE_T& OutSize)
+{
+	if( Ptr == nullptr ) return false;
+
+	OutSize = GetSpan(Ptr)->BlockSize;
+	return true;
+}
+
+void FMallocBinned::Trim()
+{
+	if( FThreadHeap* const Heap = GThreadHeap )
+	{
+		CollectRemoteFrees(Heap);
+	}
+
+	FScopeSpinLock ScopeLock(GState.Lock);
+	for( uint32 i = 0; i < GState.NumCachedSpans; ++i )
+	{
+		FPlatformMemory::FreeVirtual(GState.CachedSpans[i].Memory, GState.CachedSpans[i].Size);
+	}
+	GState.NumCachedSpans = 0;
+	GState.CachedBytes = 0;
+}
@@ -0,0 +1,170 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MallocTracked.h"
+
+#include "EngineMath.h"
+#include "EngineMemory.h"
+#include "AssertionMacros.h"
+
+
+
+
+
+namespace MallocTracked_Private
+{
+/**
+	Stored right before the user block, keeps user block aligned to FMalloc::DefaultAlignment.
+*/
+struct alignas(FMalloc::DefaultAlignment) FTrackedHeader
+{
+	SIZE_T Size;
+	EMemoryTag Tag;
+	/**
+		Distance from the inner block to the user block. Aligned blocks reserve whole alignment for the header.
+	*/
+	uint32 Offset;
+};
+static_assert(sizeof(FTrackedHeader) == FMalloc::DefaultAlignment, "Header must keep alignment");
+
+FORCEINLINE FTrackedHeader* GetHeader(void* Ptr)
+{
+	return static_cast<FTrackedHeader*>(Ptr) - 1;
+}
+
+FORCEINLINE void* GetInnerBlock(void* Ptr)
+{
+	return static_cast<uint8*>(Ptr) - GetHeader(Ptr)->Offset;
+}
+
+/**
+	@return offset of the user block in the inner aligned block.
+*/
+FORCEINLINE SIZE_T GetAlignedOffset(SIZE_T Alignment)
+{
+	return FMath::Max(Alignment, static_cast<SIZE_T>(sizeof(FTrackedHeader)));
+}
+
+/**
+	Fill header of new block and account it.
+*/
+FORCEINLINE void* InitBlock(void* InnerBlock, SIZE_T Offset, SIZE_T Size, EMemoryTag Tag)
+{
+	void* const Ptr = static_cast<uint8*>(InnerBlock) + Offset;
+	FTrackedHeader* const Header = GetHeader(Ptr);
+	Header->Size = Size;
+	Header->Tag = Tag;
+	Header->Offset = static_cast<uint32>(Offset);
+	FMemoryTracker::OnAlloc(Tag, Size);
+
+	return Ptr;
+}
+} // namespace MallocTracked_Private
+
+using namespace MallocTracked_Private;
+
+
+
+
+
+FMallocTracked::FMallocTracked(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc)
+{
+	check(InnerMalloc != nullptr);
+	FMemoryTracker::Enable();
+}
+
+void* FMallocTracked::Malloc(SIZE_T Size)
+{
+	void* const InnerBlock = InnerMalloc->Malloc(Size + sizeof(FTrackedHeader));
+	if( InnerBlock == nullptr ) return nullptr;
+
+	return InitBlock(InnerBlock, sizeof(FTrackedHeader), Size, FMemoryTracker::GetCurrentTag());
+}
+
+void* FMallocTracked::Realloc(void* Ptr, SIZE_T NewSize)
+{
+	if( Ptr == nullptr ) return Malloc(NewSize);
+	if( NewSize == 0 )
+	{
+		Free(Ptr);
+		return nullptr;
+	}
+
+	const FTrackedHeader OldHeader = *GetHeader(Ptr);
+
+	void* const InnerBlock = InnerMalloc->Realloc(GetHeader(Ptr), NewSize + sizeof(FTrackedHeader));
+	if( InnerBlock == nullptr ) return nullptr;
+
+	// Grown block stays charged to the tag that allocated it
+	FMemoryTracker::OnFree(OldHeader.Tag, OldHeader.Size);
+	return InitBlock(InnerBlock, sizeof(FTrackedHeader), NewSize, OldHeader.Tag);
+}
+
+void FMallocTracked::Free(void* Ptr)
+{
+	if( Ptr == nullptr ) return;
+
+	FTrackedHeader* const Header = GetHeader(Ptr);
+	FMemoryTracker::OnFree(Header->Tag, Header->Size);
+	InnerMalloc->Free(Header);
+}
+
+bool FMallocTracked::GetAllocationSize(void* Ptr, SIZE_T& OutSize)
+{
+	if( Ptr == nullptr || !InnerMalloc->GetAllocationSize(GetHeader(Ptr), OutSize) ) return false;
+
+	OutSize -= sizeof(FTrackedHeader);
+	return true;
+}
+
+
+
+void* FMallocTracked::MallocAligned(SIZE_T Size, SIZE_T Alignment)
+{
+	checkf(FMath::IsPowerOfTwo(Alignment), TEXT("Alignment must be power of two"));
+
+	const SIZE_T Offset = GetAlignedOffset(Alignment);
+	void* const InnerBlock = InnerMalloc->MallocAligned(Size + Offset, Alignment);
+	if( InnerBlock == nullptr ) return nullptr;
+
+	return InitBlock(InnerBlock, Offset, Size, FMemoryTracker::GetCurrentTag());
+}
+
+void* FMallocTracked::ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment)
+{
+	if( Ptr == nullptr ) return MallocAligned(NewSize, Alignment);
+	if( NewSize == 0 )
+	{
+		FreeAligned(Ptr);
+		return nullptr;
+	}
+
+	const FTrackedHeader OldHeader = *GetHeader(Ptr);
+	const SIZE_T Offset = GetAlignedOffset(Alignment);
+
+	// Other alignment moves user block inside inner block, so content is copied to new block
+	if( OldHeader.Offset != Offset )
+	{
+		void* const NewInnerBlock = InnerMalloc->MallocAligned(NewSize + Offset, Alignment);
+		if( NewInnerBlock == nullptr ) return nullptr;
+
+		void* const NewPtr = InitBlock(NewInnerBlock, Offset, NewSize, OldHeader.Tag);
+		FMemory::MemCpy(NewPtr, Ptr, FMath::Min(OldHeader.Size, NewSize));
+		FreeAligned(Ptr);
+		return NewPtr;
+	}
+
+	void* const InnerBlock = InnerMalloc->ReallocAligned(GetInnerBlock(Ptr), NewSize + Offset, Alignment);
+	if( InnerBlock == nullptr ) return nullptr;
+
+	// Grown block stays charged to the tag that allocated it
+	FMemoryTracker::OnFree(OldHeader.Tag, OldHeader.Size);
+	return InitBlock(InnerBlock, Offset, NewSize, OldHeader.Tag);
+}
+
+void FMallocTracked::FreeAligned(void* Ptr)
+{
+	if( Ptr == nullptr ) return;
+
+	const FTrackedHeader* const Header = GetHeader(Ptr);
+	FMemoryTracker::OnFree(Header->Tag, Header->Size);
+	InnerMalloc->FreeAligned(GetInnerBlock(Ptr));
+}
@@ -0,0 +1,74 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MemoryArena.h"
+#include "EngineMemory.h"
+
+
+
+
+FMemoryArena::~FMemoryArena()
+{
+	FreeBlockList(Blocks);
+	FreeBlockList(FreeBlocks);
+}
+
+void FMemoryArena::Reset()
+{
+	// Blocks of the default size go to the free list to be reused by the following allocations without heap calls,
+	// blocks sized for a single large request are returned to the heap.
+	FBlock* Block = Blocks;
+	while( Block )
+	{
+		FBlock* Next = Block->Next;
+		if( Block->Size == BlockSize )
+		{
+			Block->Next = FreeBlocks;
+			FreeBlocks = Block;
+		}
+		else
+		{
+			ReservedBytes -= Block->Size;
+			FMemory::Free(Block);
+		}
+		Block = Next;
+	}
+
+	Blocks = nullptr;
+	Cursor = nullptr;
+	End = nullptr;
+}
+
+void* FMemoryArena::AllocateSlow(SIZE_T Size, SIZE_T Alignment)
+{
+	const SIZE_T RequiredSize = sizeof(FBlock) + Size + Alignment;
+
+	FBlock* NewBlock;
+	if( RequiredSize <= BlockSize && FreeBlocks )
+	{
+		NewBlock = FreeBlocks;
+		FreeBlocks = NewBlock->Next;
+	}
+	else
+	{
+		const SIZE_T NewBlockSize = RequiredSize > BlockSize ? RequiredSize : BlockSize;
+		NewBlock = static_cast<FBlock*>(FMemory::Malloc(NewBlockSize));
+		NewBlock->Size = NewBlockSize;
+		ReservedBytes += NewBlockSize;
+	}
+	NewBlock->Next = Blocks;
+	Blocks = NewBlock;
+
+	Cursor = reinterpret_cast<uint8*>(NewBlock + 1);
+	End = reinterpret_cast<uint8*>(NewBlock) + NewBlock->Size;
+
+	return Allocate(Size, Alignment);
+}
+
+void FMemoryArena::FreeBlockList(FBlock* Block)
+{
+	while( Block )
+	{
+		FBlock* Next = Block->Next;
+		FMemory::Free(Block);
+		Block = Next;
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MemoryBase.h"
+#include "EngineMemory.h"
+
+#include "EngineMath.h"
+#include "AssertionMacros.h"
+
+
+
+
+
+namespace MemoryBase_Private
+{
+/**
+	Stored right before the aligned block.
+*/
+struct FAlignedHeader
+{
+	void* Original;
+	SIZE_T Size;
+};
+
+FORCEINLINE FAlignedHeader* GetAlignedHeader(void* Ptr)
+{
+	return static_cast<FAlignedHeader*>(Ptr) - 1;
+}
+} // namespace MemoryBase_Private
+
+using namespace MemoryBase_Private;
+
+
+
+
+
+void* FMalloc::MallocAligned(SIZE_T Size, SIZE_T Alignment)
+{
+	checkf(FMath::IsPowerOfTwo(Alignment), TEXT("Alignment must be power of two"));
+	Alignment = FMath::Max(Alignment, DefaultAlignment);
+
+	void* const Original = Malloc(Size + Alignment + sizeof(FAlignedHeader));
+	if( Original == nullptr ) return nullptr;
+
+	const UPTRINT Aligned = (reinterpret_cast<UPTRINT>(Original) + sizeof(FAlignedHeader) + Alignment - 1) & ~(static_cast<UPTRINT>(Alignment) - 1);
+	FAlignedHeader* const Header = GetAlignedHeader(reinterpret_cast<void*>(Aligned));
+	Header->Original = Original;
+	Header->Size = Size;
+
+	return reinterpret_cast<void*>(Aligned);
+}
+
+void* FMalloc::ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment)
+{
+	if( Ptr == nullptr ) return MallocAligned(NewSize, Alignment);
+	if( NewSize == 0 )
+	{
+		FreeAligned(Ptr);
+		return nullptr;
+	}
+
+	void* const NewPtr = MallocAligned(NewSize, Alignment);
+	if( NewPtr == nullptr ) return nullptr;
+
+	FMemory::MemCpy(NewPtr, Ptr, FMath::Min(GetAlignedHeader(Ptr)->Size, NewSize));
+	FreeAligned(Ptr);
+	return NewPtr;
+}
+
+void FMalloc::FreeAligned(void* Ptr)
+{
+	if( Ptr == nullptr ) return;
+	Free(GetAlignedHeader(Ptr)->Original);
+}
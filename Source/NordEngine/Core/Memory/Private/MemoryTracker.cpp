@@ -0,0 +1,270 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MemoryTracker.h"
+
+#include "GenericPlatformAtomic.h"
+
+#include <fstream>
+
+
+
+
+
+namespace MemoryTracker_Private
+{
+constexpr uint32 NumTags = static_cast<uint32>(EMemoryTag::Num);
+
+const ANSICHAR* const TagNames[NumTags] = {"Untagged", "Core", "World", "Graphics", "Reflection", "Strings"};
+
+/**
+	Counters of one thread. Only owner thread writes them, others only read, so plain load and store are enough.
+	Blocks are never freed, block of finished thread is reused by the next new thread with its counters.
+*/
+struct FThreadStats
+{
+	std::atomic<int64> CurrentBytes[NumTags] = {};
+	std::atomic<uint64> Allocations[NumTags] = {};
+	std::atomic<uint64> AllocatedBytes[NumTags] = {};
+
+	std::atomic<bool> bInUse {true};
+	FThreadStats* Next = nullptr;
+};
+
+/**
+	Frame statistics, written only by BeginFrame.
+*/
+struct FFrameStats
+{
+	std::atomic<uint64> LastAllocations[NumTags] = {};
+	std::atomic<uint64> LastAllocatedBytes[NumTags] = {};
+	std::atomic<uint64> FrameAllocations[NumTags] = {};
+	std::atomic<uint64> FrameAllocatedBytes[NumTags] = {};
+	std::atomic<int64> PeakBytes[NumTags] = {};
+};
+
+static std::atomic<FThreadStats*> GThreadStatsList {nullptr};
+static FFrameStats GFrameStats;
+
+/**
+	Releases stats of finished thread for reuse.
+*/
+struct FThreadStatsReleaser
+{
+	~FThreadStatsReleaser();
+
+	FORCEINLINE void Register() noexcept { }
+};
+
+static thread_local EMemoryTag GCurrentTag = EMemoryTag::Untagged;
+static thread_local FThreadStats* GThreadStats = nullptr;
+static thread_local bool GThreadStatsReleased = false;
+static thread_local FThreadStatsReleaser GThreadStatsReleaser;
+
+FThreadStatsReleaser::~FThreadStatsReleaser()
+{
+	if( GThreadStats != nullptr )
+	{
+		GThreadStats->bInUse.store(false, std::memory_order_release);
+		GThreadStats = nullptr;
+	}
+	GThreadStatsReleased = true;
+}
+
+NOINLINE FThreadStats* CreateThreadStats()
+{
+	FThreadStats* Stats = nullptr;
+	for( FThreadStats* It = GThreadStatsList.load(std::memory_order_acquire); It != nullptr; It = It->Next )
+	{
+		bool bExpected = false;
+		if( !It->bInUse.load(std::memory_order_relaxed) && It->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire) )
+		{
+			Stats = It;
+			break;
+		}
+	}
+
+	if( Stats == nullptr )
+	{
+		// Global new does not go through FMemory, so it does not recurse into tracking
+		Stats = new FThreadStats();
+		FThreadStats* Head = GThreadStatsList.load(std::memory_order_relaxed);
+		do
+		{
+			Stats->Next = Head;
+		} while( !GThreadStatsList.compare_exchange_weak(Head, Stats, std::memory_order_release, std::memory_order_relaxed) );
+	}
+
+	GThreadStats = Stats;
+	if( !GThreadStatsReleased )
+	{
+		GThreadStatsReleaser.Register();
+	}
+	return Stats;
+}
+
+FORCEINLINE FThreadStats* GetThreadStats()
+{
+	FThreadStats* const Stats = GThreadStats;
+	return LIKELY(Stats != nullptr) ? Stats : CreateThreadStats();
+}
+
+/**
+	Owner thread only increment.
+*/
+template<typename T>
+FORCEINLINE void AddRelaxed(std::atomic<T>& Counter, T Value)
+{
+	Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+}
+
+int64 SumCurrentBytes(uint32 Index)
+{
+	int64 Result = 0;
+	for( const FThreadStats* It = GThreadStatsList.load(std::memory_order_acquire); It != nullptr; It = It->Next )
+	{
+		Result += It->CurrentBytes[Index].load(std::memory_order_relaxed);
+	}
+	return Result;
+}
+
+uint64 SumAllocations(uint32 Index)
+{
+	uint64 Result = 0;
+	for( const FThreadStats* It = GThreadStatsList.load(std::memory_order_acquire); It != nullptr; It = It->Next )
+	{
+		Result += It->Allocations[Index].load(std::memory_order_relaxed);
+	}
+	return Result;
+}
+
+uint64 SumAllocatedBytes(uint32 Index)
+{
+	uint64 Result = 0;
+	for( const FThreadStats* It = GThreadStatsList.load(std::memory_order_acquire); It != nullptr; It = It->Next )
+	{
+		Result += It->AllocatedBytes[Index].load(std::memory_order_relaxed);
+	}
+	return Result;
+}
+
+void UpdatePeak(uint32 Index, int64 CurrentBytes)
+{
+	int64 Peak = GFrameStats.PeakBytes[Index].load(std::memory_order_relaxed);
+	while( CurrentBytes > Peak && !GFrameStats.PeakBytes[Index].compare_exchange_weak(Peak, CurrentBytes, std::memory_order_relaxed) )
+	{
+	}
+}
+} // namespace MemoryTracker_Private
+
+std::atomic<bool> FMemoryTracker::bEnabled {false};
+
+using namespace MemoryTracker_Private;
+
+
+
+
+
+void FMemoryTracker::BeginFrame()
+{
+	for( uint32 i = 0; i < NumTags; ++i )
+	{
+		const uint64 Allocations = SumAllocations(i);
+		const uint64 AllocatedBytes = SumAllocatedBytes(i);
+
+		GFrameStats.FrameAllocations[i].store(Allocations - GFrameStats.LastAllocations[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		GFrameStats.FrameAllocatedBytes[i].store(AllocatedBytes - GFrameStats.LastAllocatedBytes[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		GFrameStats.LastAllocations[i].store(Allocations, std::memory_order_relaxed);
+		GFrameStats.LastAllocatedBytes[i].store(AllocatedBytes, std::memory_order_relaxed);
+
+		UpdatePeak(i, SumCurrentBytes(i));
+	}
+}
+
+FMemoryTagStats FMemoryTracker::GetTagStats(EMemoryTag Tag)
+{
+	const uint32 Index = static_cast<uint32>(Tag);
+
+	FMemoryTagStats Result;
+	if( Index >= NumTags ) return Result;
+
+	Result.CurrentBytes = SumCurrentBytes(Index);
+	UpdatePeak(Index, Result.CurrentBytes);
+
+	Result.PeakBytes = GFrameStats.PeakBytes[Index].load(std::memory_order_relaxed);
+	Result.TotalAllocations = SumAllocations(Index);
+	Result.FrameAllocations = GFrameStats.FrameAllocations[Index].load(std::memory_order_relaxed);
+	Result.FrameAllocatedBytes = GFrameStats.FrameAllocatedBytes[Index].load(std::memory_order_relaxed);
+	return Result;
+}
+
+const ANSICHAR* FMemoryTracker::GetTagName(EMemoryTag Tag)
+{
+	const uint32 Index = static_cast<uint32>(Tag);
+	return Index < NumTags ? TagNames[Index] : "Invalid";
+}
+
+bool FMemoryTracker::DumpCsv(const std::string& FilePath)
+{
+	std::ofstream out;
+	out.open(FilePath);
+	if( !out.is_open() )
+	{
+		return false;
+	}
+
+	out << GetCsv();
+	out.close();
+	return true;
+}
+
+std::string FMemoryTracker::GetCsv()
+{
+	std::string Result = "Tag,CurrentBytes,PeakBytes,TotalAllocations,FrameAllocations,FrameAllocatedBytes\n";
+	for( uint32 i = 0; i < NumTags; ++i )
+	{
+		const FMemoryTagStats Stats = GetTagStats(static_cast<EMemoryTag>(i));
+
+		Result += TagNames[i];
+		Result += ',' + std::to_string(Stats.CurrentBytes);
+		Result += ',' + std::to_string(Stats.PeakBytes);
+		Result += ',' + std::to_string(Stats.TotalAllocations);
+		Result += ',' + std::to_string(Stats.FrameAllocations);
+		Result += ',' + std::to_string(Stats.FrameAllocatedBytes);
+		Result += '\n';
+	}
+	return Result;
+}
+
+
+
+EMemoryTag FMemoryTracker::GetCurrentTag() noexcept
+{
+	return GCurrentTag;
+}
+
+EMemoryTag FMemoryTracker::SetCurrentTag(EMemoryTag Tag) noexcept
+{
+	const EMemoryTag PreviousTag = GCurrentTag;
+	GCurrentTag = Tag;
+	return PreviousTag;
+}
+
+void FMemoryTracker::Enable() noexcept
+{
+	bEnabled.store(true, std::memory_order_relaxed);
+}
+
+void FMemoryTracker::OnAlloc(EMemoryTag Tag, SIZE_T Size) noexcept
+{
+	FThreadStats* const Stats = GetThreadStats();
+	const uint32 Index = static_cast<uint32>(Tag);
+
+	AddRelaxed<int64>(Stats->CurrentBytes[Index], static_cast<int64>(Size));
+	AddRelaxed<uint64>(Stats->Allocations[Index], 1);
+	AddRelaxed<uint64>(Stats->AllocatedBytes[Index], Size);
+}
+
+void FMemoryTracker::OnFree(EMemoryTag Tag, SIZE_T Size) noexcept
+{
+	FThreadStats* const Stats = GetThreadStats();
+	AddRelaxed<int64>(Stats->CurrentBytes[static_cast<uint32>(Tag)], -static_cast<int64>(Size));
+}
@@ -2,14 +2,37 @@
 #pragma once
 
 #include "GenericPlatform.h"
+#include "MemoryBase.h"
 
 #include <string.h>
 
 
 
 
+/**
+	Kind of allocator behind FMemory.
+*/
+enum class EMallocType : uint8
+{
+	/**
+		Value from [Memory] Allocator of engine config, Binned if not set. [Memory] Tracking=1 enables FMemoryTracker.
+	*/
+	Default,
+	/**
+		C runtime heap.
+	*/
+	Ansi,
+	/**
+		Thread caching binned allocator.
+	*/
+	Binned
+};
+
+
+
 /**
 	Wrapper around standard memory operations.
+	Allocations go to GMalloc, which is created on the first allocation.
 */
 struct ENGINE_API FMemory
 {
@@ -19,9 +42,42 @@ struct ENGINE_API FMemory
 	static FORCEINLINE void* MemSet(void* Dest, uint8 Char, SIZE_T Size) { return memset(Dest, Char, Size); }
 	static FORCEINLINE void* MemZero(void* Dest, SIZE_T Size) { return memset(Dest, 0, Size); }
 
-	static FORCEINLINE void* Malloc(SIZE_T Size) { return malloc(Size); }
-	static FORCEINLINE void* Realloc(void* Ptr, SIZE_T NewSize) { return realloc(Ptr, NewSize); }
-	static FORCEINLINE void Free(void* Ptr) { free(Ptr); }
+	static FORCEINLINE void* Malloc(SIZE_T Size) { return GetAllocator()->Malloc(Size); }
+	static FORCEINLINE void* Realloc(void* Ptr, SIZE_T NewSize) { return GetAllocator()->Realloc(Ptr, NewSize); }
+	static FORCEINLINE void Free(void* Ptr) { GetAllocator()->Free(Ptr); }
+
+	/**
+		Allocate memory aligned to Alignment, which must be power of two. Must be freed with FreeAligned.
+	*/
+	static FORCEINLINE void* MallocAligned(SIZE_T Size, SIZE_T Alignment) { return GetAllocator()->MallocAligned(Size, Alignment); }
+	static FORCEINLINE void* ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment) { return GetAllocator()->ReallocAligned(Ptr, NewSize, Alignment); }
+	static FORCEINLINE void FreeAligned(void* Ptr) { GetAllocator()->FreeAligned(Ptr); }
+
+	/**
+		@return usable size of allocation or 0 if allocator does not track it.
+	*/
+	static FORCEINLINE SIZE_T GetAllocationSize(void* Ptr)
+	{
+		SIZE_T Size = 0;
+		return GetAllocator()->GetAllocationSize(Ptr, Size) ? Size : 0;
+	}
+	/**
+		Return cached free memory of allocator to the OS.
+	*/
+	static FORCEINLINE void Trim() { GetAllocator()->Trim(); }
+
+	static FORCEINLINE FMalloc* GetAllocator()
+	{
+		if( UNLIKELY(GMalloc == nullptr) ) CreateGMalloc();
+		return GMalloc;
+	}
+	/**
+		Choose allocator instead of engine config. Must be called before the first allocation, e.g. at the start of main.
+
+		@param bTrackMemory - report allocations to FMemoryTracker, engine config can enable it too for Default type.
+		@return false if allocator is already created.
+	*/
+	static bool SetupAllocator(EMallocType Type, bool bTrackMemory = false);
 
 	static FORCEINLINE void Write8(void* P, uint8 Data) { *static_cast<uint8*>(P) = Data; }
 	static FORCEINLINE uint8 Read8(const void* P) { return *static_cast<const uint8*>(P); }
@@ -44,4 +100,10 @@ struct ENGINE_API FMemory
 			*d++ = *s++;
 		}
 	}
+
+
+
+private:
+
+	static void CreateGMalloc();
 };
@@ -0,0 +1,65 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemoryDefs.h"
+
+
+
+
+/**
+	How long memory from FFrameAllocator stays valid.
+*/
+enum class EFrameMemoryLifetime : uint8
+{
+	/**
+		Until the allocating thread allocates in the next frame.
+	*/
+	OneFrame,
+	/**
+		Until the end of the next frame, for data handed from game thread to render thread.
+	*/
+	TwoFrames
+};
+
+
+
+/**
+	Per-frame linear allocator.
+	Each thread owns bump arenas, one per lifetime buffer. Arena of thread is reset on its first allocation in a new frame,
+	so allocation is a pointer increment and nothing is freed one by one.
+	Frames are advanced by BeginFrame, which GCoreTickLoop calls at the start of every tick.
+
+	@see TFrameArrayAllocator, FMemoryArena.
+*/
+class ENGINE_API FFrameAllocator
+{
+public:
+
+	/**
+		Size of arena blocks, larger allocations get own block.
+	*/
+	static constexpr SIZE_T BlockSize = 256 * KB_SZ;
+
+public:
+
+	/**
+		Allocate Size bytes aligned to Alignment from arena of current thread.
+		Memory must not be used after its lifetime ends.
+	*/
+	static void* Allocate(SIZE_T Size, SIZE_T Alignment = alignof(void*), EFrameMemoryLifetime Lifetime = EFrameMemoryLifetime::OneFrame);
+
+	/**
+		Start a new frame. Must be called from one thread.
+	*/
+	static void BeginFrame();
+	/**
+		@return number of current frame, starts from 0.
+	*/
+	static uint64 GetFrameNumber();
+
+	/**
+		@return bytes reserved by arenas of current thread.
+	*/
+	static SIZE_T GetThreadReservedBytes();
+};
@@ -0,0 +1,33 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "MemoryBase.h"
+
+#include <stdlib.h>
+
+
+
+
+/**
+	Allocator that forwards to the C runtime heap.
+	Used when binned allocator is disabled or can't get memory from the OS.
+*/
+class ENGINE_API FMallocAnsi final : public FMalloc
+{
+public:
+
+	virtual void* Malloc(SIZE_T Size) override { return malloc(Size); }
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize) override
+	{
+		if( NewSize == 0 )
+		{
+			free(Ptr);
+			return nullptr;
+		}
+		return realloc(Ptr, NewSize);
+	}
+	virtual void Free(void* Ptr) override { free(Ptr); }
+
+	virtual const TCHAR* GetDescriptiveName() const override { return TEXT("Ansi"); }
+};
@@ -0,0 +1,61 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "MemoryBase.h"
+#include "EngineMemoryDefs.h"
+
+
+
+
+/**
+	Thread caching allocator for small objects.
+
+	Sizes up to MaxSmallSize are rounded to one of 40 size classes (16 byte steps up to 128, then four classes per power of two).
+	Each thread owns a heap with a list of spans per size class. Span is a region of 64-256 KB aligned to SpanAlignment
+	with header at the start, so any pointer finds its span by masking the address.
+	Allocation and free on the owning thread take no locks and no atomics.
+	Free from another thread pushes the block to lock-free list of the span, owner heap collects such lists when its spans run out.
+	Heap of finished thread is reused by the next new thread.
+
+	Larger sizes get their own span straight from the OS, freed spans are cached for reuse.
+
+	@note Only one instance must exist, all state is global.
+*/
+class ENGINE_API FMallocBinned final : public FMalloc
+{
+public:
+
+	/**
+		Largest size served from thread caches.
+	*/
+	static constexpr SIZE_T MaxSmallSize = 32 * KB_SZ;
+	/**
+		Alignment of every span.
+	*/
+	static constexpr SIZE_T SpanAlignment = 256 * KB_SZ;
+
+	/**
+		Check that OS gives memory to the allocator.
+	*/
+	static bool IsAvailable();
+
+public:
+
+	virtual void* Malloc(SIZE_T Size) override;
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize) override;
+	virtual void Free(void* Ptr) override;
+
+	/**
+		Small sizes with Alignment up to 128 are taken from size class which blocks are multiple of Alignment,
+		others get own span. Alignment must be less than SpanAlignment. Aligned memory can be freed with Free too.
+	*/
+	virtual void* MallocAligned(SIZE_T Size, SIZE_T Alignment) override;
+	virtual void* ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment) override;
+	virtual void FreeAligned(void* Ptr) override { Free(Ptr); }
+
+	virtual bool GetAllocationSize(void* Ptr, SIZE_T& OutSize) override;
+	virtual void Trim() override;
+
+	virtual const TCHAR* GetDescriptiveName() const override { return TEXT("Binned"); }
+};
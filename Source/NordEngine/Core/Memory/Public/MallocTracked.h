@@ -0,0 +1,46 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "MemoryBase.h"
+#include "MemoryTracker.h"
+
+
+
+
+/**
+	Allocator that wraps other allocator and reports every allocation to FMemoryTracker.
+	Size and tag are kept in header before each block, so free is charged to the tag that allocated the block.
+*/
+class ENGINE_API FMallocTracked final : public FMalloc
+{
+public:
+
+	explicit FMallocTracked(FMalloc* InInnerMalloc);
+
+public:
+
+	virtual void* Malloc(SIZE_T Size) override;
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize) override;
+	virtual void Free(void* Ptr) override;
+
+	/**
+		Forwarded to aligned functions of inner allocator, so it keeps its native aligned path.
+	*/
+	virtual void* MallocAligned(SIZE_T Size, SIZE_T Alignment) override;
+	virtual void* ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment) override;
+	virtual void FreeAligned(void* Ptr) override;
+
+	virtual bool GetAllocationSize(void* Ptr, SIZE_T& OutSize) override;
+	virtual void Trim() override { InnerMalloc->Trim(); }
+
+	virtual const TCHAR* GetDescriptiveName() const override { return TEXT("Tracked"); }
+
+	FORCEINLINE FMalloc* GetInnerMalloc() const noexcept { return InnerMalloc; }
+
+
+
+private:
+
+	FMalloc* InnerMalloc;
+};
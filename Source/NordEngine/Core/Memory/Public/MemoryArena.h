@@ -0,0 +1,99 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "EngineMemoryDefs.h"
+#include "SpecificationMacros.h"
+
+
+
+
+/**
+	Bump allocator over a list of heap blocks.
+	Allocation is a pointer increment, single allocations are never freed, the whole arena is released by Reset.
+	Not thread safe.
+
+	@see FArenaAllocator.
+*/
+class ENGINE_API FMemoryArena
+{
+	NONCOPYABLE(FMemoryArena)
+
+public:
+
+	FORCEINLINE explicit FMemoryArena(SIZE_T InBlockSize = 64 * KB_SZ) noexcept : BlockSize(InBlockSize) { }
+	~FMemoryArena();
+
+
+public:
+
+	/**
+		Allocate Size bytes aligned to Alignment.
+		Memory stays valid until Reset or arena destruction.
+	*/
+	FORCEINLINE void* Allocate(SIZE_T Size, SIZE_T Alignment = alignof(void*))
+	{
+		uint8* Result = reinterpret_cast<uint8*>((reinterpret_cast<UPTRINT>(Cursor) + Alignment - 1) & ~(static_cast<UPTRINT>(Alignment) - 1));
+		if( LIKELY(Cursor != nullptr && Result + Size <= End) )
+		{
+			Cursor = Result + Size;
+			return Result;
+		}
+		return AllocateSlow(Size, Alignment);
+	}
+
+	/**
+		Release all allocations.
+		Blocks of the default size are kept for reuse, blocks made for larger requests are returned to the heap.
+	*/
+	void Reset();
+
+	/**
+		@return count of bytes requested from the heap.
+	*/
+	FORCEINLINE SIZE_T GetReservedBytes() const noexcept { return ReservedBytes; }
+
+private:
+
+	void* AllocateSlow(SIZE_T Size, SIZE_T Alignment);
+
+
+
+private:
+
+	/**
+		Header placed at the start of each heap block.
+	*/
+	struct FBlock
+	{
+		FBlock* Next;
+		SIZE_T Size;
+	};
+
+	static void FreeBlockList(FBlock* Block);
+
+	/**
+		Most recent block first.
+	*/
+	FBlock* Blocks = nullptr;
+	/**
+		Default sized blocks released by Reset.
+	*/
+	FBlock* FreeBlocks = nullptr;
+	/**
+		Next free byte of the current block.
+	*/
+	uint8* Cursor = nullptr;
+	/**
+		End of the current block.
+	*/
+	uint8* End = nullptr;
+	/**
+		Default size of the new block.
+	*/
+	SIZE_T BlockSize = 0;
+	/**
+		Sum of all block sizes, including free blocks.
+	*/
+	SIZE_T ReservedBytes = 0;
+};
@@ -0,0 +1,76 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+
+
+
+
+/**
+	Interface of general purpose allocator behind FMemory.
+	All methods must be thread safe. Returned memory is aligned to at least DefaultAlignment.
+
+	@see FMemory, GMalloc.
+*/
+class ENGINE_API FMalloc
+{
+public:
+
+	/**
+		Alignment of any memory returned by Malloc and Realloc.
+	*/
+	static constexpr SIZE_T DefaultAlignment = 16;
+
+	virtual ~FMalloc() = default;
+
+public:
+
+	/**
+		@return memory of at least Size bytes or null if out of memory.
+	*/
+	virtual void* Malloc(SIZE_T Size) = 0;
+	/**
+		Resize allocation keeping its content. Null Ptr allocates, zero NewSize frees and returns null.
+	*/
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize) = 0;
+	/**
+		Free memory from Malloc or Realloc, null is ignored.
+	*/
+	virtual void Free(void* Ptr) = 0;
+
+	/**
+		@return memory of at least Size bytes aligned to Alignment or null if out of memory. Alignment must be power of two.
+		Memory must be freed with FreeAligned.
+		Default implementation over-allocates with Malloc and keeps header before the aligned block.
+	*/
+	virtual void* MallocAligned(SIZE_T Size, SIZE_T Alignment);
+	/**
+		Resize allocation from MallocAligned keeping its content and alignment. Null Ptr allocates, zero NewSize frees and returns null.
+	*/
+	virtual void* ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment);
+	/**
+		Free memory from MallocAligned or ReallocAligned, null is ignored.
+	*/
+	virtual void FreeAligned(void* Ptr);
+
+	/**
+		Get usable size of allocation, which can be larger than requested.
+
+		@return false if allocator does not track sizes.
+	*/
+	virtual bool GetAllocationSize(void* Ptr, SIZE_T& OutSize) { return false; }
+	/**
+		Return cached free memory to the OS.
+	*/
+	virtual void Trim() { }
+
+	/**
+		@return name of allocator for logs.
+	*/
+	virtual const TCHAR* GetDescriptiveName() const = 0;
+};
+
+/**
+	Allocator used by FMemory. Created on first allocation.
+*/
+extern ENGINE_API FMalloc* GMalloc;
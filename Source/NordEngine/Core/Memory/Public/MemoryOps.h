@@ -4,6 +4,7 @@
 #include "GenericPlatform.h"
 
 #include "EngineMemory.h"
+#include "MoveSemantic.h"
 
 #include "TypeTraits/AndOrNot.h"
 #include "TypeTraits/TypeTraits.h"
@@ -11,6 +12,7 @@
 #include "TypeTraits/IsTriviallyCopyAssignable.h"
 #include "TypeTraits/EnableIf.h"
 #include "TypeTraits/IsBitwiseConstructible.h"
+#include "TypeTraits/IsTriviallyRelocatable.h"
 
 #include <new>
 
@@ -24,10 +26,13 @@ struct TCanBitwiseRelocate
 {
 	enum
 	{
-		// AreTypesEqual or (IsBitwiseConstructible and IsTriviallyDestructible)
+		// (AreTypesEqual and IsTriviallyRelocatable) or (IsBitwiseConstructible and IsTriviallyDestructible)
 		// clang-format off
 		Value = TOr<
-			TAreTypesEqual<DestinationElementType, SourceElementType>, 
+			TAnd<
+					TAreTypesEqual<DestinationElementType, SourceElementType>,
+					TIsTriviallyRelocatable<SourceElementType>
+				>,
 			TAnd<
 					TIsBitwiseConstructible<DestinationElementType, SourceElementType>, 
 					TIsTriviallyDestructible<SourceElementType>
@@ -47,17 +52,17 @@ struct TCanBitwiseRelocate
 
 	@param Address - The address of the first memory location to construct at.
 */
-template<typename ElementType, typename SizeType>
+template<typename ElementType>
 FORCEINLINE typename TEnableIf<!TIsZeroConstructType<ElementType>::Value>::Type DefaultConstructItem(void* Address)
 {
 	ElementType* Element = static_cast<ElementType*>(Address);
 
 	new(Element) ElementType;
 }
-template<typename ElementType, typename SizeType>
+template<typename ElementType>
 FORCEINLINE typename TEnableIf<TIsZeroConstructType<ElementType>::Value>::Type DefaultConstructItem(void* Address)
 {
-	FMemory::MemSet(Elements, 0, sizeof(ElementType));
+	FMemory::MemSet(Address, 0, sizeof(ElementType));
 }
 
 /**
@@ -80,7 +85,7 @@ FORCEINLINE typename TEnableIf<!TIsZeroConstructType<ElementType>::Value>::Type
 template<typename ElementType, typename SizeType>
 FORCEINLINE typename TEnableIf<TIsZeroConstructType<ElementType>::Value>::Type DefaultConstructItems(void* Address, SizeType Count)
 {
-	FMemory::MemSet(Elements, 0, sizeof(ElementType) * Count);
+	FMemory::MemSet(Address, 0, sizeof(ElementType) * Count);
 }
 
 
@@ -182,38 +187,49 @@ FORCEINLINE typename TEnableIf<TIsTriviallyCopyAssignable<ElementType>::Value>::
 /**
 	Relocates a range of items to a new memory location as a new type. This is a so-called 'destructive move' for which
 	there is no single operation in C++ but which can be implemented very efficiently in general.
+	Source and destination ranges may overlap, e.g. when elements are shifted inside one array.
 	 
 	@param Dest - The memory location to relocate to.
 	@param Source - A pointer to the first item to relocate.
 	@param Count - The number of elements to relocate.
+	@see TIsTriviallyRelocatable.
 */
 template<typename DestinationElementType, typename SourceElementType, typename SizeType>
-FORCEINLINE typename TEnableIf<!MemoryOps_Private::TCanBitwiseRelocate<DestinationElementType, SourceElementType>::Value>::Type RelocateConstructItems(void* Dest, const SourceElementType* Source, SizeType Count)
+FORCEINLINE typename TEnableIf<!MemoryOps_Private::TCanBitwiseRelocate<DestinationElementType, SourceElementType>::Value>::Type RelocateConstructItems(void* Dest, SourceElementType* Source, SizeType Count)
 {
-	while( Count )
-	{
-		// We need a typedef here because VC won't compile the destructor call below if SourceElementType itself has a member called SourceElementType
-		typedef SourceElementType RelocateConstructItemsElementTypeTypedef;
+	// We need a typedef here because VC won't compile the destructor call below if SourceElementType itself has a member called SourceElementType
+	typedef SourceElementType RelocateConstructItemsElementTypeTypedef;
 
-		new(Dest) DestinationElementType(*Source);
-		++(DestinationElementType*&)Dest;
-		(Source++)->RelocateConstructItemsElementTypeTypedef::~RelocateConstructItemsElementTypeTypedef();
-		--Count;
+	DestinationElementType* DestElement = static_cast<DestinationElementType*>(Dest);
+	if( static_cast<void*>(DestElement) > static_cast<void*>(Source) && static_cast<void*>(DestElement) < static_cast<void*>(Source + Count) )
+	{
+		// Overlapped shift to the right, go from the last element so no one is overwritten before it was moved
+		DestElement += Count;
+		Source += Count;
+		while( Count )
+		{
+			--DestElement;
+			--Source;
+			new(DestElement) DestinationElementType(MoveTemp(*Source));
+			Source->RelocateConstructItemsElementTypeTypedef::~RelocateConstructItemsElementTypeTypedef();
+			--Count;
+		}
+	}
+	else
+	{
+		while( Count )
+		{
+			new(DestElement) DestinationElementType(MoveTemp(*Source));
+			Source->RelocateConstructItemsElementTypeTypedef::~RelocateConstructItemsElementTypeTypedef();
+			++DestElement;
+			++Source;
+			--Count;
+		}
 	}
 }
 template<typename DestinationElementType, typename SourceElementType, typename SizeType>
 FORCEINLINE typename TEnableIf<MemoryOps_Private::TCanBitwiseRelocate<DestinationElementType, SourceElementType>::Value>::Type RelocateConstructItems(void* Dest, const SourceElementType* Source, SizeType Count)
 {
-	/* 
-		All existing engine containers seem to assume trivial relocatability (i.e. memcpy'able) of their members,
-		so we're going to assume that this is safe here. However, it's not generally possible to assume this
-		in general as objects which contain pointers/references to themselves are not safe to be trivially
-		relocated.
-		 
-		However, it is not yet possible to automatically infer this at compile time, so we can't enable
-		different (i.e. safer) implementations anyway.
-	*/
-
 	FMemory::MemMove(Dest, Source, sizeof(SourceElementType) * Count);
 }
 
@@ -0,0 +1,174 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "GenericPlatform.h"
+#include "PreprocessorHelpers.h"
+#include "SpecificationMacros.h"
+
+#include <atomic>
+#include <string>
+
+
+
+
+/**
+	Subsystem that owns allocation. Memory is charged to the tag of the scope it was allocated in.
+
+	@see FScopedMemoryTag, FMemoryTracker.
+*/
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	Core,
+	World,
+	Graphics,
+	Reflection,
+	Strings,
+
+	Num
+};
+
+/**
+	Statistics of one tag summed over all threads.
+*/
+struct FMemoryTagStats
+{
+	/**
+		Bytes allocated and not freed yet.
+	*/
+	int64 CurrentBytes = 0;
+	/**
+		Largest CurrentBytes seen at frame boundaries and queries.
+	*/
+	int64 PeakBytes = 0;
+	/**
+		Allocations since start, including reallocations.
+	*/
+	uint64 TotalAllocations = 0;
+	/**
+		Allocations during the last finished frame.
+	*/
+	uint64 FrameAllocations = 0;
+	/**
+		Bytes allocated during the last finished frame.
+	*/
+	uint64 FrameAllocatedBytes = 0;
+};
+
+
+
+/**
+	Low-level tracker of FMemory allocations by tag.
+	Works when tracking is enabled by [Memory] Tracking=1 in engine config or FMemory::SetupAllocator,
+	then GMalloc is wrapped by FMallocTracked.
+
+	Counters are per thread and written only by their thread, so tracking takes no locks and no atomic read-modify-write.
+	Memory freed by other thread is subtracted from counters of the freeing thread, sums stay correct.
+*/
+class ENGINE_API FMemoryTracker
+{
+public:
+
+	/**
+		@return true if allocations are tracked.
+	*/
+	static FORCEINLINE bool IsEnabled() noexcept { return bEnabled.load(std::memory_order_relaxed); }
+
+	/**
+		Close current frame statistics and update peaks. GCoreTickLoop calls it at the start of every tick.
+		Must be called from one thread.
+	*/
+	static void BeginFrame();
+
+	/**
+		@return statistics of Tag.
+	*/
+	static FMemoryTagStats GetTagStats(EMemoryTag Tag);
+	/**
+		@return ANSI name of Tag.
+	*/
+	static const ANSICHAR* GetTagName(EMemoryTag Tag);
+
+	/**
+		Write statistics of all tags as CSV with header line.
+
+		@return false if file can't be opened.
+	*/
+	static bool DumpCsv(const std::string& FilePath);
+	/**
+		Write statistics of all tags as CSV with header line.
+	*/
+	static std::string GetCsv();
+
+public:
+
+	/**
+		@return tag of current thread scope.
+	*/
+	static EMemoryTag GetCurrentTag() noexcept;
+	/**
+		Set tag of current thread.
+
+		@return previous tag.
+	*/
+	static EMemoryTag SetCurrentTag(EMemoryTag Tag) noexcept;
+
+	/**
+		Mark tracking as enabled. Called by FMallocTracked.
+	*/
+	static void Enable() noexcept;
+	/**
+		Account allocation of Size bytes on current thread. Called by FMallocTracked.
+	*/
+	static void OnAlloc(EMemoryTag Tag, SIZE_T Size) noexcept;
+	/**
+		Account free of Size bytes on current thread. Called by FMallocTracked.
+	*/
+	static void OnFree(EMemoryTag Tag, SIZE_T Size) noexcept;
+
+private:
+
+	static std::atomic<bool> bEnabled;
+};
+
+
+
+/**
+	Charge allocations of the scope to Tag.
+	e.g FScopedMemoryTag Scope(EMemoryTag::World);
+	Costs only an inline flag test when tracking is disabled.
+*/
+class FScopedMemoryTag
+{
+	NONCOPYABLE(FScopedMemoryTag)
+
+public:
+
+	FORCEINLINE explicit FScopedMemoryTag(EMemoryTag Tag) noexcept : bActive(FMemoryTracker::IsEnabled())
+	{
+		if( bActive )
+		{
+			PreviousTag = FMemoryTracker::SetCurrentTag(Tag);
+		}
+	}
+	FORCEINLINE ~FScopedMemoryTag() noexcept
+	{
+		if( bActive )
+		{
+			FMemoryTracker::SetCurrentTag(PreviousTag);
+		}
+	}
+
+private:
+
+	/**
+		Tracking may be enabled inside the scope, so restore only the tag that was set.
+	*/
+	bool bActive;
+	EMemoryTag PreviousTag = EMemoryTag::Untagged;
+};
+
+/**
+	Charge allocations of the enclosing scope to tag, e.g MEMORY_TAG_SCOPE(Graphics);
+*/
+#define MEMORY_TAG_SCOPE(Tag) FScopedMemoryTag PREPROCESSOR_JOIN(MemoryTagScope, __LINE__)(EMemoryTag::Tag)
@@ -30,6 +30,7 @@
 // Memory include
 #include "EngineMemoryDefs.h"
 #include "EngineMemory.h"
+#include "MemoryTracker.h"
 
 // Containers include
 #include "Vector2D.h"
@@ -37,8 +38,13 @@
 #include "Vector4D.h"
 #include "Transform.h"
 #include "Delegate.h"
+#include "StringView.h"
+#include "StringBuilder.h"
 #include "FString.h"
+#include "Name.h"
 #include "Array.h"
+#include "ArrayView.h"
+#include "SparseArray.h"
 #include "Map.h"
 #include "Set.h"
 
@@ -148,7 +148,7 @@ struct TUseBitwiseSwap
 	enum
 	{
 		// clang-format off
-		Value = !TOrValue<TIsEnum<T>, TIsPointer<T>, TIsArithmetic<T>>::Value
+		Value = !TOr<TIsEnum<T>, TIsPointer<T>, TIsArithmetic<T>>::Value
 		// clang-format on
 	};
 };
@@ -33,6 +33,7 @@ struct TAlignedBytes<Size, 1>
 		{                                \
 			uint8 Pad[Size];             \
 		};                               \
+		TPadding Padding;                \
 	};
 
 // Implement TAlignedBytes for these alignments.
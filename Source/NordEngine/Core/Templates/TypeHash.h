@@ -6,93 +6,205 @@
 #include "TypeTraits/IsEnum.h"
 #include "TypeTraits/EnableIf.h"
 
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 
 
+
+namespace TypeHash_Private
+{
+static constexpr uint64 Secret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
 /**
-	Combines two hash values to get a third.
-	Note - this function is not commutative.
+	Full 64x64->128 multiply. A receives low half, B receives high half.
 */
-FORCEINLINE uint32 HashCombine(uint32 A, uint32 C) noexcept
+FORCEINLINE void Multiply128(uint64& A, uint64& B) noexcept
+{
+#if defined(_MSC_VER)
+	A = _umul128(A, B, &B);
+#else
+	const unsigned __int128 R = static_cast<unsigned __int128>(A) * B;
+	A = static_cast<uint64>(R);
+	B = static_cast<uint64>(R >> 64);
+#endif
+}
+
+FORCEINLINE uint64 Mix(uint64 A, uint64 B) noexcept
+{
+	Multiply128(A, B);
+	return A ^ B;
+}
+
+FORCEINLINE uint64 Read8(const uint8* P) noexcept
+{
+	uint64 V;
+	memcpy(&V, P, sizeof(V));
+	return V;
+}
+
+FORCEINLINE uint64 Read4(const uint8* P) noexcept
 {
-	uint32 B = 0x9e3779b9;
-	A += B;
+	uint32 V;
+	memcpy(&V, P, sizeof(V));
+	return V;
+}
+
+FORCEINLINE uint64 Read3(const uint8* P, SIZE_T Len) noexcept
+{
+	return (static_cast<uint64>(P[0]) << 16) | (static_cast<uint64>(P[Len >> 1]) << 8) | P[Len - 1];
+}
+} // namespace TypeHash_Private
 
-	// clang-format off
-	A -= B; A -= C; A ^= (C >> 13);
-	B -= C; B -= A; B ^= (A << 8);
-	C -= A; C -= B; C ^= (B >> 13);
-	A -= B; A -= C; A ^= (C >> 12);
-	B -= C; B -= A; B ^= (A << 16);
-	C -= A; C -= B; C ^= (B >> 5);
-	A -= B; A -= C; A ^= (C >> 3);
-	B -= C; B -= A; B ^= (A << 10);
-	C -= A; C -= B; C ^= (B >> 15);
-	// clang-format on;
 
-	return C;
+
+/**
+	Hash of byte sequence of any length (wyhash algorithm).
+	Long inputs are consumed by 48 bytes in three independent multiply lanes, short inputs take a few unaligned loads.
+
+	@param Data - bytes to hash.
+	@param Len - count of bytes.
+	@param Seed - initial value, different seeds give independent hashes.
+*/
+FORCEINLINE uint64 HashBytes(const void* Data, SIZE_T Len, uint64 Seed = 0) noexcept
+{
+	using namespace TypeHash_Private;
+
+	const uint8* P = static_cast<const uint8*>(Data);
+	Seed ^= Mix(Seed ^ Secret[0], Secret[1]);
+
+	uint64 A;
+	uint64 B;
+	if( LIKELY(Len <= 16) )
+	{
+		if( LIKELY(Len >= 4) )
+		{
+			A = (Read4(P) << 32) | Read4(P + ((Len >> 3) << 2));
+			B = (Read4(P + Len - 4) << 32) | Read4(P + Len - 4 - ((Len >> 3) << 2));
+		}
+		else if( LIKELY(Len > 0) )
+		{
+			A = Read3(P, Len);
+			B = 0;
+		}
+		else
+		{
+			A = B = 0;
+		}
+	}
+	else
+	{
+		SIZE_T i = Len;
+		if( UNLIKELY(i >= 48) )
+		{
+			uint64 See1 = Seed;
+			uint64 See2 = Seed;
+			do
+			{
+				Seed = Mix(Read8(P) ^ Secret[1], Read8(P + 8) ^ Seed);
+				See1 = Mix(Read8(P + 16) ^ Secret[2], Read8(P + 24) ^ See1);
+				See2 = Mix(Read8(P + 32) ^ Secret[3], Read8(P + 40) ^ See2);
+				P += 48;
+				i -= 48;
+			} while( LIKELY(i >= 48) );
+			Seed ^= See1 ^ See2;
+		}
+		while( UNLIKELY(i > 16) )
+		{
+			Seed = Mix(Read8(P) ^ Secret[1], Read8(P + 8) ^ Seed);
+			i -= 16;
+			P += 16;
+		}
+		A = Read8(P + i - 16);
+		B = Read8(P + i - 8);
+	}
+
+	A ^= Secret[1];
+	B ^= Seed;
+	Multiply128(A, B);
+	return Mix(A ^ Secret[0] ^ Len, B ^ Secret[1]);
+}
+
+/**
+	Finalizer for integer and pointer keys.
+	Sequential values get uncorrelated hashes, so they do not cluster in hash tables.
+*/
+FORCEINLINE uint64 HashMix64(uint64 Value) noexcept
+{
+	return TypeHash_Private::Mix(Value ^ TypeHash_Private::Secret[0], TypeHash_Private::Secret[1]);
+}
+
+/**
+	Combines two hash values to get a third.
+	Note - this function is not commutative.
+*/
+FORCEINLINE uint64 HashCombine(uint64 A, uint64 B) noexcept
+{
+	return TypeHash_Private::Mix(A ^ TypeHash_Private::Secret[0], B ^ TypeHash_Private::Secret[2]);
 }
 
 //............Hash functions for common types..........................//
 
 FORCEINLINE uint64 GetTypeHash(const uint8 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const int8 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const uint16 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const int16 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const int32 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const uint32 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const uint64 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(const int64 A) noexcept
 {
-	return A;
+	return HashMix64(static_cast<uint64>(A));
 }
 
 FORCEINLINE uint64 GetTypeHash(float Value) noexcept
 {
-	return *(uint32*)&Value;
+	return HashMix64(*(uint32*)&Value);
 }
 
 FORCEINLINE uint64 GetTypeHash(double Value) noexcept
 {
-	return *(uint64*)&Value;
+	return HashMix64(*(uint64*)&Value);
 }
 
 FORCEINLINE uint64 GetTypeHash(const void* Value) noexcept
 {
-	return reinterpret_cast<UPTRINT>(Value);
+	return HashMix64(reinterpret_cast<UPTRINT>(Value));
 }
 
 FORCEINLINE uint64 GetTypeHash(void* Value) noexcept
 {
-	return reinterpret_cast<UPTRINT>(Value);
+	return HashMix64(reinterpret_cast<UPTRINT>(Value));
 }
 
 template<typename EnumType>
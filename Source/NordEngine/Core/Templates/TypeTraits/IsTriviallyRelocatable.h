@@ -0,0 +1,32 @@
+// Copyright Nord Engine. All Rights Reserved.
+#pragma once
+
+#include "TypeTraits/AndOrNot.h"
+#include "TypeTraits/IsTriviallyCopyConstructible.h"
+#include "TypeTraits/IsTriviallyDestructible.h"
+
+
+
+
+/**
+	Traits class which tests if a type can be moved to another address with memcpy, without calling move constructor
+	and destructor of the source.
+	True for trivially copyable types. Types that do not store pointers into themselves can opt in by specialization:
+
+	template<> struct TIsTriviallyRelocatable<FMyType> { enum { Value = true }; };
+*/
+template<typename T>
+struct TIsTriviallyRelocatable
+{
+	enum
+	{
+		// clang-format off
+		Value = TAnd<TIsTriviallyCopyConstructible<T>, TIsTriviallyDestructible<T>>::Value
+		// clang-format on
+	};
+};
+
+template<typename T>
+struct TIsTriviallyRelocatable<const T> : TIsTriviallyRelocatable<T>
+{
+};
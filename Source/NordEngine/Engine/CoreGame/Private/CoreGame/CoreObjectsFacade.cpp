@@ -1,6 +1,8 @@
 
 #include "CoreGame/CoreObjectsFacade.h"
 
+#include "MemoryTracker.h"
+
 #include "World/World.h"
 #include "Window/BaseWindow.h"
 #include "GameInstance/GameInstance.h"
@@ -29,6 +31,9 @@ GCoreObjectsFacade::~GCoreObjectsFacade()
 
 void GCoreObjectsFacade::ConstructCoreObjects()
 {
+	// Engine startup memory is charged to Core, except objects of tagged subsystems
+	MEMORY_TAG_SCOPE(Core);
+
 	GGameSettings* LGameSettings = GGameSettings::Get();
 
 
@@ -38,12 +43,18 @@ void GCoreObjectsFacade::ConstructCoreObjects()
 
 	//....................Construct engines..................//
 
-	GraphicsEngine = LGameSettings->ConstructGraphicsEngine();
+	{
+		MEMORY_TAG_SCOPE(Graphics);
+		GraphicsEngine = LGameSettings->ConstructGraphicsEngine();
+	}
 
 	//.......................................................//
 
 
-	MainWorld = LGameSettings->ConstructWorld();
+	{
+		MEMORY_TAG_SCOPE(World);
+		MainWorld = LGameSettings->ConstructWorld();
+	}
 	GameInstance = LGameSettings->ConstructGameInstance();
 	CameraManager = LGameSettings->ConstructCameraManager();
 
@@ -52,6 +63,8 @@ void GCoreObjectsFacade::ConstructCoreObjects()
 
 void GCoreObjectsFacade::InitSubsystems()
 {
+	MEMORY_TAG_SCOPE(Core);
+
 	GGameSettings* LGameSettings = GGameSettings::Get();
 
 
@@ -68,10 +81,13 @@ void GCoreObjectsFacade::InitSubsystems()
 
 void GCoreObjectsFacade::StartSubsystems()
 {
+	MEMORY_TAG_SCOPE(Core);
+
 	//...........Start engines.........//
 
 	if( GraphicsEngine != nullptr )
 	{
+		MEMORY_TAG_SCOPE(Graphics);
 		GraphicsEngine->OnGameStart();
 	}
 
@@ -81,6 +97,7 @@ void GCoreObjectsFacade::StartSubsystems()
 	// start world at the end
 	if( MainWorld != nullptr )
 	{
+		MEMORY_TAG_SCOPE(World);
 		MainWorld->OnGameStart();
 	}
 }
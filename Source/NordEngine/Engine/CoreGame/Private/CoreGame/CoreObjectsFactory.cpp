@@ -90,19 +90,19 @@ void GCoreObjectsFactory::Clear()
 
 
 
-void GCoreObjectsFactory::RegisterWorldClass(const std::string& ClassName, FWorldBuilder* WorldBuilder)
+void GCoreObjectsFactory::RegisterWorldClass(FName ClassName, FWorldBuilder* WorldBuilder)
 {
 	WorldClassesMap.RegisterBuilderClass(ClassName, WorldBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterWorldClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterWorldClass(FName ClassName)
 {
 	WorldClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-GWorld* GCoreObjectsFactory::ConstructWorld(const std::string& ClassName)
+GWorld* GCoreObjectsFactory::ConstructWorld(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FWorldBuilder LWorldBuilder;
 		return LWorldBuilder.ConstructWorld();
@@ -116,19 +116,19 @@ GWorld* GCoreObjectsFactory::ConstructWorld(const std::string& ClassName)
 
 
 
-void GCoreObjectsFactory::RegisterWindowClass(const std::string& ClassName, FWindowBuilder* WindowBuilder)
+void GCoreObjectsFactory::RegisterWindowClass(FName ClassName, FWindowBuilder* WindowBuilder)
 {
 	WindowClassesMap.RegisterBuilderClass(ClassName, WindowBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterWindowClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterWindowClass(FName ClassName)
 {
 	WindowClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-GBaseWindow* GCoreObjectsFactory::ConstructWindow(const std::string& ClassName, int WindowStyle)
+GBaseWindow* GCoreObjectsFactory::ConstructWindow(FName ClassName, int WindowStyle)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FWindowBuilder LWindowBuilder;
 		return LWindowBuilder.ConstructWindow(WindowStyle);
@@ -142,19 +142,19 @@ GBaseWindow* GCoreObjectsFactory::ConstructWindow(const std::string& ClassName,
 
 
 
-void GCoreObjectsFactory::RegisterGameInstanceClass(const std::string& ClassName, FGameInstanceBuilder* GameInstanceBuilder)
+void GCoreObjectsFactory::RegisterGameInstanceClass(FName ClassName, FGameInstanceBuilder* GameInstanceBuilder)
 {
 	GameInstanceClassesMap.RegisterBuilderClass(ClassName, GameInstanceBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterGameInstanceClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterGameInstanceClass(FName ClassName)
 {
 	GameInstanceClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-GGameInstance* GCoreObjectsFactory::ConstructGameInstance(const std::string& ClassName)
+GGameInstance* GCoreObjectsFactory::ConstructGameInstance(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FGameInstanceBuilder LGameInstanceBuilder;
 		return LGameInstanceBuilder.ConstructGameInstance();
@@ -168,19 +168,19 @@ GGameInstance* GCoreObjectsFactory::ConstructGameInstance(const std::string& Cla
 
 
 
-void GCoreObjectsFactory::RegisterCameraManagerClass(const std::string& ClassName, FCameraManagerBuilder* CameraManagerBuilder)
+void GCoreObjectsFactory::RegisterCameraManagerClass(FName ClassName, FCameraManagerBuilder* CameraManagerBuilder)
 {
 	CameraManagerClassesMap.RegisterBuilderClass(ClassName, CameraManagerBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterCameraManagerClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterCameraManagerClass(FName ClassName)
 {
 	CameraManagerClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-GCameraManager* GCoreObjectsFactory::ConstructCameraManager(const std::string& ClassName)
+GCameraManager* GCoreObjectsFactory::ConstructCameraManager(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FCameraManagerBuilder LCameraManagerBuilder;
 		return LCameraManagerBuilder.ConstructCameraManager();
@@ -194,19 +194,19 @@ GCameraManager* GCoreObjectsFactory::ConstructCameraManager(const std::string& C
 
 
 
-void GCoreObjectsFactory::RegisterGameUserSettingsClass(const std::string& ClassName, FGameUserSettingsBuilder* GameUserSettingsBuilder)
+void GCoreObjectsFactory::RegisterGameUserSettingsClass(FName ClassName, FGameUserSettingsBuilder* GameUserSettingsBuilder)
 {
 	GameUserSettingsClassesMap.RegisterBuilderClass(ClassName, GameUserSettingsBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterGameUserSettingsClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterGameUserSettingsClass(FName ClassName)
 {
 	GameUserSettingsClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-UGameUserSettings* GCoreObjectsFactory::ConstructGameUserSettings(const std::string& ClassName)
+UGameUserSettings* GCoreObjectsFactory::ConstructGameUserSettings(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FGameUserSettingsBuilder LGameUserSettingsBuilder;
 		return LGameUserSettingsBuilder.ConstructGameUserSettings();
@@ -220,19 +220,19 @@ UGameUserSettings* GCoreObjectsFactory::ConstructGameUserSettings(const std::str
 
 
 
-void GCoreObjectsFactory::RegisterGameInputSettingsClass(const std::string& ClassName, FGameInputSettingsBuilder* GameInputSettingsBuilder)
+void GCoreObjectsFactory::RegisterGameInputSettingsClass(FName ClassName, FGameInputSettingsBuilder* GameInputSettingsBuilder)
 {
 	GameInputSettingsClassesMap.RegisterBuilderClass(ClassName, GameInputSettingsBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterGameInputSettingsClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterGameInputSettingsClass(FName ClassName)
 {
 	GameInputSettingsClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-UGameInputSettings* GCoreObjectsFactory::ConstructGameInputSettings(const std::string& ClassName)
+UGameInputSettings* GCoreObjectsFactory::ConstructGameInputSettings(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FGameInputSettingsBuilder LGameInputSettingsBuilder;
 		return LGameInputSettingsBuilder.ConstructGameInputSettings();
@@ -246,19 +246,19 @@ UGameInputSettings* GCoreObjectsFactory::ConstructGameInputSettings(const std::s
 
 
 
-void GCoreObjectsFactory::RegisterDeviceResourcesAdapterClass(const std::string& ClassName, FDeviceResourcesAdapterBuilder* DeviceResourcesAdapterBuilder)
+void GCoreObjectsFactory::RegisterDeviceResourcesAdapterClass(FName ClassName, FDeviceResourcesAdapterBuilder* DeviceResourcesAdapterBuilder)
 {
 	DeviceResourcesAdapterClassesMap.RegisterBuilderClass(ClassName, DeviceResourcesAdapterBuilder);
 }
 
-void GCoreObjectsFactory::UnregistervClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregistervClass(FName ClassName)
 {
 	DeviceResourcesAdapterClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-IDeviceResourcesAdapter* GCoreObjectsFactory::ConstructDeviceResourcesAdapter(const std::string& ClassName)
+IDeviceResourcesAdapter* GCoreObjectsFactory::ConstructDeviceResourcesAdapter(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FDeviceResourcesAdapterBuilder LDeviceResourcesAdapterBuilder;
 		return LDeviceResourcesAdapterBuilder.ConstructDeviceResourcesAdapter();
@@ -272,19 +272,19 @@ IDeviceResourcesAdapter* GCoreObjectsFactory::ConstructDeviceResourcesAdapter(co
 
 
 
-void GCoreObjectsFactory::RegisterGraphicsEngineClass(const std::string& ClassName, FGraphicsEngineBuilder* GraphicsEngineBuilder)
+void GCoreObjectsFactory::RegisterGraphicsEngineClass(FName ClassName, FGraphicsEngineBuilder* GraphicsEngineBuilder)
 {
 	GraphicsEngineClassesMap.RegisterBuilderClass(ClassName, GraphicsEngineBuilder);
 }
 
-void GCoreObjectsFactory::UnregisterGraphicsEngineClass(const std::string& ClassName)
+void GCoreObjectsFactory::UnregisterGraphicsEngineClass(FName ClassName)
 {
 	GraphicsEngineClassesMap.UnregisterBuilderClass(ClassName);
 }
 
-GGraphicsEngine* GCoreObjectsFactory::ConstructGraphicsEngine(const std::string& ClassName)
+GGraphicsEngine* GCoreObjectsFactory::ConstructGraphicsEngine(FName ClassName)
 {
-	if( ClassName.empty() )
+	if( ClassName.IsNone() )
 	{
 		FGraphicsEngineBuilder LGraphicsEngineBuilder;
 		return LGraphicsEngineBuilder.ConstructGraphicsEngine();
@@ -2,6 +2,8 @@
 #include "CoreGame/CoreTickLoop.h"
 
 #include "GenericPlatformTime.h"
+#include "FrameAllocator.h"
+#include "MemoryTracker.h"
 
 #include "World/World.h"
 #include "CameraManager/CameraManager.h"
@@ -48,9 +50,18 @@ void GCoreTickLoop::Tick(GCoreObjectsFacade& CoreObjectsFacade)
 
 void GCoreTickLoop::Update()
 {
+	// Drop memory of previous frame
+	FFrameAllocator::BeginFrame();
+	if( FMemoryTracker::IsEnabled() )
+	{
+		FMemoryTracker::BeginFrame();
+	}
+
 	// clang-format off
 	GameBlockPerformance.CacheCodePerformance([this]()
 	{
+		MEMORY_TAG_SCOPE(World);
+
 		//....Start engines critical section.....//
 		if( CurrentTickCoreObjectsFacade->GetGraphicsEngine() != nullptr )
 		{
@@ -76,6 +87,7 @@ void GCoreTickLoop::Update()
 	// clang-format off
 	GraphicsEnginePerformance.CacheCodePerformance([this]()	
 	{ 
+		MEMORY_TAG_SCOPE(Graphics);
 		if( CurrentTickCoreObjectsFacade->GetGraphicsEngine() != nullptr ) CurrentTickCoreObjectsFacade->GetGraphicsEngine()->Render(CurrentTickCoreObjectsFacade->GetWorld()); 
 	});
 	// clang-format on
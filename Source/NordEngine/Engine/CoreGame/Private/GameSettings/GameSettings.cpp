@@ -62,6 +62,9 @@ void GGameSettings::LoadSettings()
 	GameIconPath = LIniFile.Get<std::string>("Game", "GameIconPath", "");
 	GameCursorPath = LIniFile.Get<std::string>("Game", "GameCursorPath", "");
 
+	MemoryAllocator = LIniFile.Get<std::string>("Memory", "Allocator", "");
+	MemoryTracking = LIniFile.Get<bool>("Memory", "Tracking", false);
+
 
 	if( GameUserSettings != nullptr )
 	{
@@ -132,6 +135,12 @@ void GGameSettings::SaveGameSettings()
 	LIniFile.Set("Game", "GameIconPath", GameIconPath);
 	LIniFile.Set("Game", "GameCursorPath", GameCursorPath);
 
+	if( !MemoryAllocator.empty() )
+	{
+		LIniFile.Set("Memory", "Allocator", MemoryAllocator);
+	}
+	LIniFile.Set("Memory", "Tracking", MemoryTracking);
+
 	FINIWriter::Write(FPath::GetEngineConfigPath(), LIniFile);
 
 
@@ -151,7 +160,7 @@ void GGameSettings::SaveGameSettings()
 
 GWorld* GGameSettings::ConstructWorld()
 {
-	return GCoreObjectsFactory::Get()->ConstructWorld(WorldClassName);
+	return GCoreObjectsFactory::Get()->ConstructWorld(FName(WorldClassName.c_str()));
 }
 
 GBaseWindow* GGameSettings::ConstructWindow()
@@ -161,35 +170,35 @@ GBaseWindow* GGameSettings::ConstructWindow()
 	if( MainWindowResizable ) LWindowStyle |= EWindowStyle::Resize;
 	if( MainWindowCloseable ) LWindowStyle |= EWindowStyle::Close;
 
-	return GCoreObjectsFactory::Get()->ConstructWindow(WindowClassName, LWindowStyle);
+	return GCoreObjectsFactory::Get()->ConstructWindow(FName(WindowClassName.c_str()), LWindowStyle);
 }
 
 GGameInstance* GGameSettings::ConstructGameInstance()
 {
-	return GCoreObjectsFactory::Get()->ConstructGameInstance(GameInstanceClassName);
+	return GCoreObjectsFactory::Get()->ConstructGameInstance(FName(GameInstanceClassName.c_str()));
 }
 
 GCameraManager* GGameSettings::ConstructCameraManager()
 {
-	return GCoreObjectsFactory::Get()->ConstructCameraManager(CameraManagerClassName);
+	return GCoreObjectsFactory::Get()->ConstructCameraManager(FName(CameraManagerClassName.c_str()));
 }
 
 UGameUserSettings* GGameSettings::ConstructGameUserSettings()
 {
-	return GCoreObjectsFactory::Get()->ConstructGameUserSettings(GameUserSettingsClassName);
+	return GCoreObjectsFactory::Get()->ConstructGameUserSettings(FName(GameUserSettingsClassName.c_str()));
 }
 
 UGameInputSettings* GGameSettings::ConstructGameInputSettings()
 {
-	return GCoreObjectsFactory::Get()->ConstructGameInputSettings(GameInputSettingsClassName);
+	return GCoreObjectsFactory::Get()->ConstructGameInputSettings(FName(GameInputSettingsClassName.c_str()));
 }
 
 IDeviceResourcesAdapter* GGameSettings::ConstructDeviceResourcesAdapter()
 {
-	return GCoreObjectsFactory::Get()->ConstructDeviceResourcesAdapter(DeviceResourcesAdapterClassName);
+	return GCoreObjectsFactory::Get()->ConstructDeviceResourcesAdapter(FName(DeviceResourcesAdapterClassName.c_str()));
 }
 
 GGraphicsEngine* GGameSettings::ConstructGraphicsEngine()
 {
-	return GCoreObjectsFactory::Get()->ConstructGraphicsEngine(GraphicsEngineClassName);
+	return GCoreObjectsFactory::Get()->ConstructGraphicsEngine(FName(GraphicsEngineClassName.c_str()));
 }
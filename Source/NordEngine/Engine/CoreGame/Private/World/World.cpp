@@ -5,6 +5,48 @@
 
 
 
+namespace World_Private
+{
+/**
+	Remove invalid objects and tick the rest.
+	Objects spawned during tick can take any free slot, so only objects that existed before tick are ticked.
+	Spawned objects are ticked from the next frame.
+*/
+template<typename T>
+static void TickObjects(TSparseArray<std::shared_ptr<T>>& Objects, double DeltaTime)
+{
+	TArray<uint32, FFrameArrayAllocator> TickIndices;
+	TickIndices.Reserve(Objects.Num());
+
+	for( uint32 i = 0; i < Objects.GetMaxIndex(); ++i )
+	{
+		if( !Objects.IsValidIndex(i) ) continue;
+		if( !IsValid(Objects[i]) )
+		{
+			Objects.RemoveAt(i);
+			continue;
+		}
+
+		TickIndices.PushBack(i);
+	}
+
+	for( const uint32 Index : TickIndices )
+	{
+		// Object can be destroyed by tick of other object
+		if( !Objects.IsValidIndex(Index) || !IsValid(Objects[Index]) ) continue;
+
+		if( Objects[Index]->GetIsTickEnabled() )
+		{
+			Objects[Index]->Tick(DeltaTime);
+		}
+	}
+}
+} // namespace World_Private
+
+
+
+
+
 void GWorld::OnGameStart()
 {
 	if( WorldGameWasStarted ) return;
@@ -37,33 +79,8 @@ void GWorld::Tick(double DeltaTime)
 	if( WorldGameWasStarted ) return;
 
 
-	for( int64 i = SceneObjects2D.size() - 1; i >= 0; --i )
-	{
-		if( !IsValid(SceneObjects2D[i]) )
-		{
-			SceneObjects2D.erase(SceneObjects2D.begin() + i);
-			continue;
-		}
-
-		if( SceneObjects2D[i]->GetIsTickEnabled() )
-		{
-			SceneObjects2D[i]->Tick(DeltaTime);
-		}
-	}
-
-	for( int64 i = SceneObjects3D.size() - 1; i >= 0; --i )
-	{
-		if( !IsValid(SceneObjects3D[i]) )
-		{
-			SceneObjects3D.erase(SceneObjects3D.begin() + i);
-			continue;
-		}
-
-		if( SceneObjects3D[i]->GetIsTickEnabled() )
-		{
-			SceneObjects3D[i]->Tick(DeltaTime);
-		}
-	}
+	World_Private::TickObjects(SceneObjects2D, DeltaTime);
+	World_Private::TickObjects(SceneObjects3D, DeltaTime);
 }
 
 
@@ -81,8 +98,8 @@ void GWorld::DestroyAllObjects()
 	});
 	// clang-format on
 
-	SceneObjects2D.clear();
-	SceneObjects3D.clear();
+	SceneObjects2D.Clear();
+	SceneObjects3D.Clear();
 }
 
 
@@ -181,22 +181,26 @@ public:
 		@param ClassName - name of class that will be used as key to construct object.
 		@param ClassBuilder - Builder of object.
 	*/
-	FORCEINLINE void RegisterBuilderClass(const std::string& ClassName, T* ClassBuilder) { ClassesMap.insert_or_assign(ClassName, ClassBuilder); }
+	FORCEINLINE void RegisterBuilderClass(FName ClassName, T* ClassBuilder)
+	{
+		MEMORY_TAG_SCOPE(Reflection);
+		ClassesMap.Insert(ClassName, ClassBuilder);
+	}
 
 	/*
 		Unregister object builder if it exists.
 		@param ClassName - name of class to unregister.
 	*/
-	FORCEINLINE void UnregisterBuilderClass(const std::string& ClassName)
+	FORCEINLINE void UnregisterBuilderClass(FName ClassName)
 	{
-		auto LPair = ClassesMap.find(ClassName);
-		if( LPair != ClassesMap.end() )
+		T** LBuilder = ClassesMap.FindPtr(ClassName);
+		if( LBuilder != nullptr )
 		{
-			if( LPair->second != nullptr )
+			if( *LBuilder != nullptr )
 			{
-				delete LPair->second;
+				delete *LBuilder;
 			}
-			ClassesMap.erase(ClassName);
+			ClassesMap.Remove(ClassName);
 		}
 	}
 
@@ -205,27 +209,27 @@ public:
 	*/
 	FORCEINLINE void Clear()
 	{
-		for( auto LPair : ClassesMap )
+		for( auto& LPair : ClassesMap )
 		{
-			if( LPair.second != nullptr )
+			if( LPair.Value != nullptr )
 			{
-				delete LPair.second;
+				delete LPair.Value;
 			}
 		}
-		ClassesMap.clear();
+		ClassesMap.Clear();
 	}
 
 	/*
 		Find builder of class by ClassName.
-		@param ClassName - name of class as key for builder searching.
+		@param ClassName - name of class as key for builder searching, compared by name index.
 		@return class builder or nullptr if not found.
 	*/
-	FORCEINLINE T* GetClassBuilder(const std::string& ClassName) const
+	FORCEINLINE T* GetClassBuilder(FName ClassName) const
 	{
-		auto LPair = ClassesMap.find(ClassName);
-		if( LPair == ClassesMap.end() ) return nullptr;
+		T* const* LBuilder = ClassesMap.FindPtr(ClassName);
+		if( LBuilder == nullptr ) return nullptr;
 
-		return LPair->second;
+		return *LBuilder;
 	}
 
 
@@ -235,7 +239,7 @@ private:
 		Key - Class name.
 		Value - Builder of concrete class.
 	*/
-	std::unordered_map<std::string, T*> ClassesMap;
+	TMap<FName, T*> ClassesMap;
 };
 
 
@@ -243,6 +247,7 @@ private:
 
 /*
 	Factory for registering user classes for core objects.
+	Classes are keyed by FName, None class name means default builder.
 	@see GameSettings
 */
 class ENGINE_API GCoreObjectsFactory final
@@ -264,37 +269,37 @@ public:
 	void Clear();
 
 
-	void RegisterWorldClass(const std::string& ClassName, FWorldBuilder* WorldBuilder);
-	void UnregisterWorldClass(const std::string& ClassName);
-	GWorld* ConstructWorld(const std::string& ClassName);
+	void RegisterWorldClass(FName ClassName, FWorldBuilder* WorldBuilder);
+	void UnregisterWorldClass(FName ClassName);
+	GWorld* ConstructWorld(FName ClassName);
 
-	void RegisterWindowClass(const std::string& ClassName, FWindowBuilder* WindowBuilder);
-	void UnregisterWindowClass(const std::string& ClassName);
-	GBaseWindow* ConstructWindow(const std::string& ClassName, int WindowStyle);
+	void RegisterWindowClass(FName ClassName, FWindowBuilder* WindowBuilder);
+	void UnregisterWindowClass(FName ClassName);
+	GBaseWindow* ConstructWindow(FName ClassName, int WindowStyle);
 
-	void RegisterGameInstanceClass(const std::string& ClassName, FGameInstanceBuilder* GameInstanceBuilder);
-	void UnregisterGameInstanceClass(const std::string& ClassName);
-	GGameInstance* ConstructGameInstance(const std::string& ClassName);
+	void RegisterGameInstanceClass(FName ClassName, FGameInstanceBuilder* GameInstanceBuilder);
+	void UnregisterGameInstanceClass(FName ClassName);
+	GGameInstance* ConstructGameInstance(FName ClassName);
 
-	void RegisterCameraManagerClass(const std::string& ClassName, FCameraManagerBuilder* CameraManagerBuilder);
-	void UnregisterCameraManagerClass(const std::string& ClassName);
-	GCameraManager* ConstructCameraManager(const std::string& ClassName);
+	void RegisterCameraManagerClass(FName ClassName, FCameraManagerBuilder* CameraManagerBuilder);
+	void UnregisterCameraManagerClass(FName ClassName);
+	GCameraManager* ConstructCameraManager(FName ClassName);
 
-	void RegisterGameUserSettingsClass(const std::string& ClassName, FGameUserSettingsBuilder* GameUserSettingsBuilder);
-	void UnregisterGameUserSettingsClass(const std::string& ClassName);
-	UGameUserSettings* ConstructGameUserSettings(const std::string& ClassName);
+	void RegisterGameUserSettingsClass(FName ClassName, FGameUserSettingsBuilder* GameUserSettingsBuilder);
+	void UnregisterGameUserSettingsClass(FName ClassName);
+	UGameUserSettings* ConstructGameUserSettings(FName ClassName);
 
-	void RegisterGameInputSettingsClass(const std::string& ClassName, FGameInputSettingsBuilder* GameInputSettingsBuilder);
-	void UnregisterGameInputSettingsClass(const std::string& ClassName);
-	UGameInputSettings* ConstructGameInputSettings(const std::string& ClassName);
+	void RegisterGameInputSettingsClass(FName ClassName, FGameInputSettingsBuilder* GameInputSettingsBuilder);
+	void UnregisterGameInputSettingsClass(FName ClassName);
+	UGameInputSettings* ConstructGameInputSettings(FName ClassName);
 
-	void RegisterDeviceResourcesAdapterClass(const std::string& ClassName, FDeviceResourcesAdapterBuilder* DeviceResourcesAdapterBuilder);
-	void UnregistervClass(const std::string& ClassName);
-	IDeviceResourcesAdapter* ConstructDeviceResourcesAdapter(const std::string& ClassName);
+	void RegisterDeviceResourcesAdapterClass(FName ClassName, FDeviceResourcesAdapterBuilder* DeviceResourcesAdapterBuilder);
+	void UnregistervClass(FName ClassName);
+	IDeviceResourcesAdapter* ConstructDeviceResourcesAdapter(FName ClassName);
 
-	void RegisterGraphicsEngineClass(const std::string& ClassName, FGraphicsEngineBuilder* GraphicsEngineBuilder);
-	void UnregisterGraphicsEngineClass(const std::string& ClassName);
-	GGraphicsEngine* ConstructGraphicsEngine(const std::string& ClassName);
+	void RegisterGraphicsEngineClass(FName ClassName, FGraphicsEngineBuilder* GraphicsEngineBuilder);
+	void UnregisterGraphicsEngineClass(FName ClassName);
+	GGraphicsEngine* ConstructGraphicsEngine(FName ClassName);
 
 
 
@@ -126,6 +126,19 @@ private:
 
 	//..............................................................................//
 
+	//............................Active after restart..............................//
+
+	/*
+		Allocator behind FMemory, read at startup. Memory settings are kept only to save config without losing them.
+	*/
+	std::string MemoryAllocator = "";
+	/*
+		FMemoryTracker is enabled at startup.
+	*/
+	bool MemoryTracking = false;
+
+	//..............................................................................//
+
 
 	std::string GameName = "";
 	std::string GameIconPath = "";
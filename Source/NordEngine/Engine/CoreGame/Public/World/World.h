@@ -57,16 +57,16 @@ public:
 	/*
 		@return all spawned 2D objects.
 	*/
-	FORCEINLINE const std::vector<std::shared_ptr<ISpawnableObject2D>>& Get2DObjects() const noexcept { return SceneObjects2D; }
+	FORCEINLINE const TSparseArray<std::shared_ptr<ISpawnableObject2D>>& Get2DObjects() const noexcept { return SceneObjects2D; }
 	/*
 		@return all spawned 3D objects.
 	*/
-	FORCEINLINE const std::vector<std::shared_ptr<ISpawnableObject3D>>& Get3DObjects() const noexcept { return SceneObjects3D; }
+	FORCEINLINE const TSparseArray<std::shared_ptr<ISpawnableObject3D>>& Get3DObjects() const noexcept { return SceneObjects3D; }
 	
 	/*
 		@return total spawned objects count(including invalid objects).
 	*/
-	FORCEINLINE int GetObjectsCount() const noexcept { return SceneObjects2D.size() + SceneObjects3D.size(); }
+	FORCEINLINE int GetObjectsCount() const noexcept { return SceneObjects2D.Num() + SceneObjects3D.Num(); }
 
 
 	/*
@@ -96,13 +96,13 @@ private:
 private:
 
 	/*
-		Spawned 2D objects.
+		Spawned 2D objects. Slots of removed objects are reused, so indices of alive objects are stable.
 	*/
-	std::vector<std::shared_ptr<ISpawnableObject2D>> SceneObjects2D;
+	TSparseArray<std::shared_ptr<ISpawnableObject2D>> SceneObjects2D;
 	/*
-		Spawned 3D objects.
+		Spawned 3D objects. Slots of removed objects are reused, so indices of alive objects are stable.
 	*/
-	std::vector<std::shared_ptr<ISpawnableObject3D>> SceneObjects3D;
+	TSparseArray<std::shared_ptr<ISpawnableObject3D>> SceneObjects3D;
 
 
 	/*
@@ -121,7 +121,7 @@ FORCEINLINE std::shared_ptr<T> GWorld::SpawnActor2D(const FSceneObject2DSpawnPar
 	std::shared_ptr<T> LNewActor = std::make_shared<T>(Params...);
 
 	if( LNewActor == nullptr ) return nullptr;
-	SceneObjects2D.push_back(LNewActor);
+	SceneObjects2D.Add(LNewActor);
 
 
 	LNewActor->PreConstruct();
@@ -142,7 +142,7 @@ FORCEINLINE std::shared_ptr<T> GWorld::SpawnActor3D(const FSceneObject3DSpawnPar
 	std::shared_ptr<T> LNewActor = std::make_shared<T>(Params...);
 
 	if( LNewActor == nullptr ) return nullptr;
-	SceneObjects3D.push_back(LNewActor);
+	SceneObjects3D.Add(LNewActor);
 
 
 	LNewActor->PreConstruct();
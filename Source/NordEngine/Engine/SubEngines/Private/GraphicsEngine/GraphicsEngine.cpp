@@ -5,8 +5,6 @@
 
 #include "World/World.h"
 
-#include <algorithm>
-
 
 
 
@@ -76,9 +74,9 @@ void GGraphicsEngine::Render(GWorld* World)
 		L2DView.WorldScale = LSceneObject->GetWorldScale();
 		L2DView.LayerIndex = LSceneObject->GetLayer();
 
-		SceneView.View2D.push_back(L2DView);
+		SceneView.View2D.PushBack(L2DView);
 	}
-	std::sort(SceneView.View2D.begin(), SceneView.View2D.end(), [](const F2DView& A, const F2DView& B) { return A.LayerIndex < B.LayerIndex; });
+	SceneView.View2D.RadixSort([](const F2DView& View) { return View.LayerIndex; });
 
 
 	// Prepare 3D objects
@@ -90,7 +88,7 @@ void GGraphicsEngine::Render(GWorld* World)
 
 		//TODO
 
-		SceneView.View3D.push_back(L3DView);
+		SceneView.View3D.PushBack(L3DView);
 	}
 
 
@@ -11,15 +11,16 @@
 
 /*
 	Main struct for containing information for rendering.
+	Rebuilt every frame, so views are stored in frame memory.
 */
 struct FSceneView
 {
 	/*
 		2D view from all 2D objects.
 	*/
-	std::vector<F2DView> View2D;
+	TArray<F2DView, FFrameArrayAllocator> View2D;
 	/*
 		3D view from all 3D objects.
 	*/
-	std::vector<F3DView> View3D;
+	TArray<F3DView, FFrameArrayAllocator> View3D;
 };
@@ -1,10 +1,47 @@
 // Copyright Nord Engine. All Rights Reserved.
 #include "Array.h"
 #include "TestHelpers.h"
+#include "MemoryArena.h"
 
 
 
 
+template<typename T>
+static bool TestArraySearch(const T* Values, uint32 ValuesNum)
+{
+	for( uint32 Num = 0; Num < 70; ++Num )
+	{
+		TArray<T> arr;
+		for( uint32 i = 0; i < Num; ++i )
+		{
+			arr.Add(Values[(i * 7) % ValuesNum]);
+		}
+
+		for( uint32 v = 0; v < ValuesNum; ++v )
+		{
+			uint32 First = INDEX_NONE;
+			uint32 Last = INDEX_NONE;
+			uint32 Count = 0;
+			for( uint32 i = 0; i < Num; ++i )
+			{
+				if( arr[i] == Values[v] )
+				{
+					if( First == static_cast<uint32>(INDEX_NONE) ) First = i;
+					Last = i;
+					++Count;
+				}
+			}
+
+			if( arr.Find(Values[v]) != First ) return false;
+			if( arr.FindLast(Values[v]) != Last ) return false;
+			if( arr.Count(Values[v]) != Count ) return false;
+			if( arr.Contains(Values[v]) != (Count > 0) ) return false;
+		}
+	}
+	return true;
+}
+
+
 
 int Core_ArrayTest(int argc, char* argv[])
 {
@@ -54,5 +91,394 @@ int Core_ArrayTest(int argc, char* argv[])
 		TestEqual(arr.GetCapacity(), 0);
 	}
 
+	{
+		// Reserve is exact, adding past capacity still grows geometrically
+		TArray<TestSimpleType> arr;
+		arr.Reserve(100);
+		TestEqual(arr.GetCapacity(), 100);
+		for( int i = 0; i < 100; ++i )
+		{
+			arr.PushBack(i);
+		}
+		TestEqual(arr.GetCapacity(), 100);
+		arr.Reserve(50);
+		TestEqual(arr.GetCapacity(), 100);
+
+		arr.PushBack(100);
+		Test(arr.GetCapacity() >= 200);
+
+		uint32 NumGrowths = 0;
+		for( int i = 0; i < 10000; ++i )
+		{
+			const uint32 Capacity = arr.GetCapacity();
+			arr.PushBack(i);
+			NumGrowths += arr.GetCapacity() != Capacity;
+		}
+		Test(NumGrowths <= 8);
+	}
+
+	{
+		TArray<TestSimpleType, TInlineAllocator<4>> arr;
+		TestEqual(arr.GetCapacity(), 4);
+		for( int i = 0; i < 4; ++i )
+		{
+			arr.PushBack(i);
+		}
+		TestEqual(arr.GetCapacity(), 4);
+		Test(reinterpret_cast<const uint8*>(arr.GetData()) >= reinterpret_cast<const uint8*>(&arr));
+		Test(reinterpret_cast<const uint8*>(arr.GetData()) < reinterpret_cast<const uint8*>(&arr + 1));
+
+		arr.PushBack(4);
+		Test(arr.GetCapacity() > 4);
+		for( int i = 0; i < 5; ++i )
+		{
+			TestEqual(arr[i], i);
+		}
+
+		TArray<TestSimpleType, TInlineAllocator<4>> copy = arr;
+		TArray<TestSimpleType, TInlineAllocator<4>> moved = MoveTemp(arr);
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(moved.Num(), 5);
+		TestEqual(copy.Num(), 5);
+
+		moved.PopBack();
+		moved.PopBack();
+		moved.ShrinkToFit();
+		TestEqual(moved.GetCapacity(), 4);
+		for( int i = 0; i < 3; ++i )
+		{
+			TestEqual(moved[i], i);
+		}
+	}
+
+	{
+		TArray<TestSimpleType, TFixedAllocator<8>> arr;
+		TestEqual(arr.GetCapacity(), 8);
+		for( int i = 0; i < 8; ++i )
+		{
+			arr.PushBack(i);
+		}
+		TestEqual(arr.GetCapacity(), 8);
+		TestEqual(arr.Back(), 7);
+
+		arr.Reset();
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(arr.GetCapacity(), 8);
+	}
+
+	{
+		FMemoryArena Arena(256);
+		TArray<TestSimpleType, FArenaAllocator> arr(Arena);
+		for( int i = 0; i < 100; ++i )
+		{
+			arr.PushBack(i);
+		}
+		TestEqual(arr.Num(), 100);
+		TestEqual(arr[99], 99);
+		Test(Arena.GetReservedBytes() >= 100 * sizeof(TestSimpleType));
+
+		TArray<TestSimpleType, FArenaAllocator> copy = arr;
+		TestEqual(copy[50], 50);
+
+		arr.Reset();
+		copy.Reset();
+		Arena.Reset();
+		TestEqual(Arena.GetReservedBytes() % 256, 0);
+	}
+
+	{
+		// Default sized blocks are reused after Reset, large blocks are freed
+		FMemoryArena Arena(256);
+		for( int i = 0; i < 3; ++i )
+		{
+			Arena.Allocate(100);
+		}
+		TestEqual(Arena.GetReservedBytes(), 512);
+		Arena.Allocate(1000);
+		Test(Arena.GetReservedBytes() > 1512);
+
+		for( int Frame = 0; Frame < 3; ++Frame )
+		{
+			Arena.Reset();
+			TestEqual(Arena.GetReservedBytes(), 512);
+			for( int i = 0; i < 3; ++i )
+			{
+				Arena.Allocate(100);
+			}
+			TestEqual(Arena.GetReservedBytes(), 512);
+		}
+	}
+
+	{
+		StaticCheck(TIsTriviallyRelocatable<TestSimpleType>::Value, "");
+		StaticCheck(!TIsTriviallyRelocatable<TestSelfPointerType>::Value, "");
+		StaticCheck(TIsTriviallyRelocatable<TArray<TestSelfPointerType>>::Value, "");
+		StaticCheck(!(TIsTriviallyRelocatable<TArray<TestSelfPointerType, TInlineAllocator<2>>>::Value), "");
+
+		TArray<TestSelfPointerType> arr;
+		for( int i = 0; i < 20; ++i )
+		{
+			arr.PushBack(TestSelfPointerType(i));
+		}
+		arr.Insert(3, TestSelfPointerType(100));
+		arr.PushFront(TestSelfPointerType(-1));
+		arr.RemoveAt(10);
+		arr.RemoveAt(2, 3);
+		arr.PopFront();
+		arr.RemoveAtSwap(0);
+		arr.ShrinkToFit();
+
+		TArray<TestSelfPointerType, TInlineAllocator<2>> inl;
+		inl.PushBack(TestSelfPointerType(1));
+		inl.PushBack(TestSelfPointerType(2));
+		inl.PushBack(TestSelfPointerType(3));
+		inl.PopBack();
+		inl.ShrinkToFit();
+		TArray<TestSelfPointerType, TInlineAllocator<2>> moved = MoveTemp(inl);
+
+		for( const TestSelfPointerType& Elem : arr )
+		{
+			Test(Elem.IsValid());
+		}
+		for( const TestSelfPointerType& Elem : moved )
+		{
+			Test(Elem.IsValid());
+		}
+		TestEqual(moved.Num(), 2);
+		TestEqual(moved[1].Value, 2);
+	}
+
+	{
+		TArray<TestComplexType> arr;
+		TestEqual(arr.Emplace(1, 2), 0);
+		TestEqual(arr.Emplace(3, 4), 1);
+		arr.EmplaceAt(1, 5, 6);
+		arr.EmplaceAt(arr.Num(), 7, 8);
+		TestEqual(arr.Num(), 4);
+		TestEqual(arr[0].a, 1);
+		TestEqual(arr[1].a, 5);
+		TestEqual(arr[2].a, 3);
+		TestEqual(arr[3].b, 8);
+		for( const TestComplexType& Elem : arr )
+		{
+			Test(Elem.IsValid());
+		}
+
+		TArray<TestSimpleType> ints;
+		TestEqual(ints.AddZeroed(3), 0);
+		TestEqual(ints.AddDefaulted(2), 3);
+		const uint32 Index = ints.AddUninitialized(2);
+		ints[Index] = 10;
+		ints[Index + 1] = 11;
+		TestEqual(ints.Num(), 7);
+		TestEqual(ints[0], 0);
+		TestEqual(ints[4], 0);
+		TestEqual(ints[6], 11);
+
+		const TestSimpleType Source[] = {20, 21, 22, 23};
+		ints.Append(Source, 4);
+		ints.Append(nullptr, 0);
+		TestEqual(ints.Num(), 11);
+		TestEqual(ints[10], 23);
+
+		TArray<TestSimpleType> other;
+		other.Append(ints);
+		TestEqual(other.Num(), ints.Num());
+		TestEqual(other[7], 20);
+	}
+
+	{
+		TArray<TestSelfPointerType> arr;
+		for( int i = 0; i < 100; ++i )
+		{
+			arr.Emplace(i);
+		}
+		uint32 Calls = 0;
+		arr.RemoveAll(
+			[&](const TestSelfPointerType& Elem)
+			{
+				++Calls;
+				return Elem.Value % 3 == 0 || (Elem.Value > 50 && Elem.Value < 60);
+			}
+		);
+		TestEqual(Calls, 100);
+		TestEqual(arr.Num(), 60);
+		for( uint32 i = 0; i < arr.Num(); ++i )
+		{
+			Test(arr[i].IsValid());
+			Test(arr[i].Value % 3 != 0);
+			Test(i == 0 || arr[i - 1].Value < arr[i].Value);
+		}
+
+		Calls = 0;
+		arr.RemoveAllSwap(
+			[&](const TestSelfPointerType& Elem)
+			{
+				++Calls;
+				return Elem.Value % 2 == 0 || Elem.Value > 90;
+			}
+		);
+		TestEqual(Calls, 60);
+		TestEqual(arr.Num(), 27);
+		for( const TestSelfPointerType& Elem : arr )
+		{
+			Test(Elem.IsValid());
+			Test(Elem.Value % 2 != 0 && Elem.Value <= 90);
+		}
+
+		arr.RemoveAllSwap([](const TestSelfPointerType& Elem) { return true; });
+		TestEqual(arr.IsEmpty(), true);
+
+		TArray<TestSimpleType> ints;
+		for( int i = 0; i < 10; ++i )
+		{
+			ints.Add(i);
+		}
+		TArray<uint32> Indices;
+		Indices.Add(0);
+		Indices.Add(3);
+		Indices.Add(4);
+		Indices.Add(9);
+		ints.RemoveAtIndices(Indices);
+		TestEqual(ints.Num(), 6);
+		TestEqual(ints[0], 1);
+		TestEqual(ints[1], 2);
+		TestEqual(ints[2], 5);
+		TestEqual(ints[5], 8);
+		ints.RemoveAtIndices(TArray<uint32>());
+		TestEqual(ints.Num(), 6);
+	}
+
+	{
+		const uint8 Bytes[] = {0, 1, 2, 255, 128, 7, 9};
+		Test(TestArraySearch(Bytes, 7));
+		const int16 Shorts[] = {0, -1, 300, 32767, -32768, 5};
+		Test(TestArraySearch(Shorts, 6));
+		const int32 Ints[] = {0, -1, 1 << 20, 42, 7, 8, 9, 10, 11};
+		Test(TestArraySearch(Ints, 9));
+		const int64 Longs[] = {0, -1, 1ll << 40, (1ll << 40) + 1, 1ll << 32, 1};
+		Test(TestArraySearch(Longs, 6));
+		const float Floats[] = {0.0f, 1.5f, -2.0f, 1e30f, 3.0f};
+		Test(TestArraySearch(Floats, 5));
+		const double Doubles[] = {0.0, 1.5, -2.0, 1e300, 3.0};
+		Test(TestArraySearch(Doubles, 5));
+		const void* Pointers[] = {nullptr, Ints, Ints + 1, Longs, Floats};
+		Test(TestArraySearch(Pointers, 5));
+		const TestSimpleType Simple[] = {1, 2, 3, 4, 5};
+		Test(TestArraySearch(Simple, 5));
+
+		TArray<float> floats;
+		floats.Add(-0.0f);
+		floats.Add(NAN);
+		floats.AddZeroed(8);
+		TestEqual(floats.Find(0.0f), 0);
+		TestEqual(floats.Count(0.0f), 9);
+		TestEqual(floats.Contains(NAN), false);
+	}
+
+	{
+		TArray<TestSimpleType> arr;
+		uint32 Seed = 12345;
+		for( int i = 0; i < 100000; ++i )
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			arr.Add(static_cast<int>(Seed >> 8) - (1 << 23));
+		}
+		TArray<TestSimpleType> copy = arr;
+
+		arr.ParallelSort([](const TestSimpleType& A, const TestSimpleType& B) { return A < B; });
+		copy.Sort([](const TestSimpleType& A, const TestSimpleType& B) { return A < B; });
+		for( uint32 i = 0; i < arr.Num(); ++i )
+		{
+			TestEqual(arr[i], copy[i]);
+		}
+
+		TArray<TestSelfPointerType> items;
+		for( int i = 0; i < 1000; ++i )
+		{
+			items.Emplace(i);
+		}
+		items.StableSort([](const TestSelfPointerType& A, const TestSelfPointerType& B) { return A.Value % 7 < B.Value % 7; });
+		for( uint32 i = 1; i < items.Num(); ++i )
+		{
+			Test(items[i].IsValid());
+			Test(items[i - 1].Value % 7 < items[i].Value % 7 || (items[i - 1].Value % 7 == items[i].Value % 7 && items[i - 1].Value < items[i].Value));
+		}
+
+		TArray<TestSelfPointerType> radix;
+		for( int i = 0; i < 1000; ++i )
+		{
+			radix.Emplace(i);
+		}
+		radix.RadixSort([](const TestSelfPointerType& Elem) { return (Elem.Value % 5) - 2; });
+		for( uint32 i = 1; i < radix.Num(); ++i )
+		{
+			Test(radix[i].IsValid());
+			const int PrevKey = radix[i - 1].Value % 5;
+			const int Key = radix[i].Value % 5;
+			Test(PrevKey < Key || (PrevKey == Key && radix[i - 1].Value < radix[i].Value));
+		}
+
+		TArray<float> floats;
+		const float FloatValues[] = {3.5f, -1.0f, 0.0f, -100.25f, 1e10f, -1e-10f, 2.0f, -0.0f};
+		floats.Append(FloatValues, 8);
+		floats.RadixSort([](float Value) { return Value; });
+		for( uint32 i = 1; i < floats.Num(); ++i )
+		{
+			Test(floats[i - 1] <= floats[i]);
+		}
+
+		TArray<int64> longs;
+		for( int i = 0; i < 500; ++i )
+		{
+			longs.Add((static_cast<int64>(i % 13) - 6) * (1ll << 40) + i);
+		}
+		longs.RadixSort([](int64 Value) { return Value; });
+		for( uint32 i = 1; i < longs.Num(); ++i )
+		{
+			Test(longs[i - 1] < longs[i]);
+		}
+
+		TArray<TestSimpleType, TInlineAllocator<4>> inl;
+		inl.Add(3);
+		inl.Add(1);
+		inl.Add(2);
+		inl.RadixSort([](const TestSimpleType& Elem) { return static_cast<uint8>(Elem); });
+		TestEqual(inl[0], 1);
+		TestEqual(inl[2], 3);
+	}
+
+	{
+		// Storage follows alignment of element type and of policy while growing
+		struct alignas(64) FWideType
+		{
+			float Values[16];
+		};
+
+		TArray<FWideType> wide;
+		TArray<float, FCacheAlignedHeapAllocator> floats;
+		TArray<TestComplexType, TAlignedHeapAllocator<32>> complex;
+		for( int i = 0; i < 300; ++i )
+		{
+			wide.Add(FWideType {{static_cast<float>(i)}});
+			floats.Add(static_cast<float>(i));
+			complex.Emplace(i, 1);
+
+			Test(reinterpret_cast<UPTRINT>(wide.GetData()) % 64 == 0);
+			Test(reinterpret_cast<UPTRINT>(floats.GetData()) % PLATFORM_CACHE_LINE_SIZE == 0);
+			Test(reinterpret_cast<UPTRINT>(complex.GetData()) % 32 == 0);
+		}
+		for( int i = 0; i < 300; ++i )
+		{
+			TestEqual(wide[i].Values[0], static_cast<float>(i));
+			TestEqual(floats[i], static_cast<float>(i));
+			Test(complex[i].IsValid());
+		}
+
+		wide.ShrinkToFit();
+		floats.Reset();
+		Test(reinterpret_cast<UPTRINT>(wide.GetData()) % 64 == 0);
+	}
+
 	return PROGRAM_EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "ArrayView.h"
+#include "TestHelpers.h"
+
+#include <type_traits>
+
+
+
+
+static int32 SumView(TArrayView<const int32> View)
+{
+	int32 Result = 0;
+	for( int32 Elem : View )
+	{
+		Result += Elem;
+	}
+	return Result;
+}
+
+struct TestViewBase
+{
+	int32 A;
+};
+struct TestViewDerived : TestViewBase
+{
+	int32 B;
+};
+
+// View conversion only adds const, element stride must not change
+static_assert(std::is_convertible<TArrayView<int32>, TArrayView<const int32>>::value, "View must convert to const view");
+static_assert(!std::is_convertible<TArrayView<const int32>, TArrayView<int32>>::value, "Const view must not lose const");
+static_assert(!std::is_convertible<TArrayView<TestViewDerived>, TArrayView<TestViewBase>>::value, "Derived view must not convert to base view");
+static_assert(!std::is_convertible<TArrayView<TestViewDerived>, TArrayView<const TestViewBase>>::value, "Derived view must not convert to base view");
+
+
+
+int Core_ArrayViewTest(int argc, char* argv[])
+{
+	{
+		TArray<int32> arr;
+		for( int32 i = 0; i < 10; ++i )
+		{
+			arr.PushBack(i);
+		}
+
+		TArrayView<int32> view = arr;
+		TestEqual(view.Num(), 10);
+		TestEqual(view.GetData(), arr.GetData());
+		TestEqual(view.First(), 0);
+		TestEqual(view.Last(), 9);
+
+		view[3] = 30;
+		TestEqual(arr[3], 30);
+
+		const TArray<int32>& constArr = arr;
+		TestEqual(SumView(constArr), 72);
+		TestEqual(SumView(view), 72);
+
+		TestEqual(view.Left(2).Num(), 2);
+		TestEqual(view.Left(20).Num(), 10);
+		TestEqual(view.LeftChop(8).Last(), 1);
+		TestEqual(view.Right(2).First(), 8);
+		TestEqual(view.RightChop(7).First(), 7);
+		TestEqual(view.RightChop(20).IsEmpty(), true);
+		TestEqual(view.Mid(2, 3).Num(), 3);
+		TestEqual(view.Mid(2, 3).First(), 2);
+		TestEqual(view.Mid(8).Num(), 2);
+		TestEqual(view.Mid(11).IsEmpty(), true);
+
+		TestEqual(view.Find(30), 3);
+		TestEqual(view.Find(3), static_cast<uint32>(INDEX_NONE));
+		TestEqual(view.Contains(9), true);
+
+		TArray<int32> copy = view.Mid(1, 2).ToArray();
+		TestEqual(copy.Num(), 2);
+		TestEqual(copy[1], 2);
+	}
+
+	{
+		int32 Values[] = {1, 2, 3};
+		TestEqual(SumView(Values), 6);
+
+		TArrayView<const int32> empty;
+		TestEqual(empty.IsEmpty(), true);
+		TestEqual(SumView(empty), 0);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "BitArray.h"
+#include "TestHelpers.h"
+
+
+
+
+int Core_BitArrayTest(int argc, char* argv[])
+{
+	{
+		FBitArray bits;
+		TestEqual(bits.IsEmpty(), true);
+		TestEqual(bits.FindFirstSet(), INDEX_NONE);
+		TestEqual(bits.FindFirstClear(), INDEX_NONE);
+		TestEqual(bits.CountSetBits(), 0);
+
+		for( uint32 i = 0; i < 200; ++i )
+		{
+			TestEqual(bits.Add(i % 3 == 0), i);
+		}
+		TestEqual(bits.Num(), 200);
+		TestEqual(bits.NumWords(), 4);
+		TestEqual(bits.CountSetBits(), 67);
+		TestEqual(bits.FindFirstSet(), 0);
+		TestEqual(bits.FindNextSet(1), 3);
+		TestEqual(bits.FindNextSet(64), 66);
+		TestEqual(bits.FindNextSet(199), INDEX_NONE);
+		TestEqual(bits.FindNextSet(200), INDEX_NONE);
+		TestEqual(bits.FindFirstClear(), 1);
+
+		uint32 NumVisited = 0;
+		bool bAllSet = true;
+		bits.ForEachSetBit(
+			[&](uint32 Index)
+			{
+				bAllSet &= Index % 3 == 0 && bits[Index];
+				++NumVisited;
+			}
+		);
+		Test(bAllSet);
+		TestEqual(NumVisited, 67);
+
+		bits.SetNum(250, true);
+		TestEqual(bits.CountSetBits(), 117);
+		TestEqual(bits[199], false);
+		TestEqual(bits[200], true);
+		TestEqual(bits[249], true);
+
+		bits.SetNum(70, false);
+		TestEqual(bits.NumWords(), 2);
+		TestEqual(bits.CountSetBits(), 24);
+		bits.BitwiseNot();
+		TestEqual(bits.CountSetBits(), 46);
+
+		bits.SetAll(true);
+		TestEqual(bits.CountSetBits(), 70);
+		TestEqual(bits.FindFirstClear(), INDEX_NONE);
+		bits.Set(69, false);
+		TestEqual(bits.FindFirstClear(), 69);
+	}
+
+	{
+		static constexpr uint32 NumBits = 1000;
+
+		FBitArray Visible(false, NumBits);
+		FBitArray PendingKill(false, NumBits);
+		for( uint32 i = 0; i < NumBits; ++i )
+		{
+			Visible.Set(i, i % 2 == 0);
+			PendingKill.Set(i, i % 5 == 0);
+		}
+
+		FBitArray Mask = Visible;
+		Mask.BitwiseAndNot(PendingKill);
+		FBitArray Both = Visible;
+		Both.BitwiseAnd(PendingKill);
+		FBitArray Any = Visible;
+		Any.BitwiseOr(PendingKill);
+		FBitArray Diff = Visible;
+		Diff.BitwiseXor(PendingKill);
+
+		bool bCorrect = true;
+		for( uint32 i = 0; i < NumBits; ++i )
+		{
+			bCorrect &= Mask[i] == (i % 2 == 0 && i % 5 != 0);
+			bCorrect &= Both[i] == (i % 10 == 0);
+			bCorrect &= Any[i] == (i % 2 == 0 || i % 5 == 0);
+			bCorrect &= Diff[i] == ((i % 2 == 0) != (i % 5 == 0));
+		}
+		Test(bCorrect);
+		TestEqual(Mask.CountSetBits(), 400);
+		TestEqual(Both.CountSetBits(), 100);
+		TestEqual(Any.CountSetBits(), 600);
+		TestEqual(Diff.CountSetBits(), 500);
+
+		Test(Mask != Visible);
+		Mask.BitwiseOr(Both);
+		Test(Mask == Visible);
+
+		Mask.Reset();
+		TestEqual(Mask.Num(), 0);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -8,5 +8,153 @@
 
 int Core_FStringTest(int argc, char* argv[])
 {
+	{
+		const FString Str(TEXT("  Hello World \t"));
+
+		FStringView View = Str;
+		TestEqual(View.Len(), Str.Length());
+		TestEqual(View.GetData(), Str.GetStr());
+
+		const FStringView Trimmed = Str.TrimView();
+		TestEqual(Trimmed.GetData(), Str.GetStr() + 2);
+		Test(Trimmed == TEXT("Hello World"));
+		Test(Str.TrimLeftView() == TEXT("Hello World \t"));
+		Test(Str.TrimRightView() == TEXT("  Hello World"));
+
+		Test(Trimmed.Left(5) == TEXT("Hello"));
+		Test(Trimmed.LeftChop(6) == TEXT("Hello"));
+		Test(Trimmed.Right(5) == TEXT("World"));
+		Test(Trimmed.RightChop(6) == TEXT("World"));
+		Test(Trimmed.Mid(6, 3) == TEXT("Wor"));
+		Test(Trimmed.Mid(100).IsEmpty());
+
+		Test(Trimmed.Equals(TEXT("hello world")));
+		Test(!Trimmed.Equals(TEXT("hello world"), ESearchCase::CaseSensitive));
+		Test(Trimmed.StartsWith(TEXT("HELLO")));
+		Test(Trimmed.EndsWith(TEXT("World"), ESearchCase::CaseSensitive));
+		TestEqual(Trimmed.FindChar(TEXT('o')), 4);
+		TestEqual(Trimmed.FindLastChar(TEXT('o')), 7);
+		TestEqual(Trimmed.FindChar(TEXT('x')), INDEX_NONE);
+
+		Test(FString(Trimmed) == FString(TEXT("Hello World")));
+		Test(Str.Trim() == FString(TEXT("Hello World")));
+		Test(Str.TrimLeft() == FString(TEXT("Hello World \t")));
+		Test(Str.TrimRight() == FString(TEXT("  Hello World")));
+	}
+
+	{
+		const FString Str(TEXT("abcdef"));
+		Test(Str.LeftView(2) == TEXT("ab"));
+		Test(Str.LeftChopView(2) == TEXT("abcd"));
+		Test(Str.RightView(2) == TEXT("ef"));
+		Test(Str.RightChopView(2) == TEXT("cdef"));
+		Test(Str.MidView(1, 2) == TEXT("bc"));
+		Test(Str.MidView(1, -1).IsEmpty());
+
+		Test(Str.Left(2) == FString(TEXT("ab")));
+		Test(Str.Right(2) == FString(TEXT("ef")));
+		Test(Str.RightChop(2) == FString(TEXT("cdef")));
+		Test(Str.Mid(2, 100) == FString(TEXT("cdef")));
+		Test(Str.Left(0).IsEmpty());
+
+		FString Inline(TEXT("  x  "));
+		Inline.TrimInline();
+		Test(Inline == FString(TEXT("x")));
+		Inline = TEXT("   ");
+		Inline.TrimRightInline();
+		TestEqual(Inline.IsEmpty(), true);
+	}
+
+	{
+		FString Short(TEXT("Actor"));
+		Test(Short.IsInline());
+		TestEqual(Short.Length(), 5);
+
+		FString Moved = MoveTemp(Short);
+		TestEqual(Short.IsEmpty(), true);
+		Test(Moved == FString(TEXT("Actor")));
+
+		FString Grown;
+		for( uint32 i = 0; i < 100; ++i )
+		{
+			Grown += static_cast<TCHAR>(TEXT('a') + i % 26);
+		}
+		TestEqual(Grown.Length(), 100);
+		Test(!Grown.IsInline());
+		TestEqual(Grown[99], TEXT('a') + 99 % 26);
+		TestEqual(Grown.GetStr()[100], TEXT('\0'));
+
+		TArray<FString> arr;
+		arr.PushBack(Moved);
+		arr.PushBack(Grown);
+		for( uint32 i = 0; i < 50; ++i )
+		{
+			arr.PushBack(FString(TEXT("x")));
+		}
+		Test(arr[0] == FString(TEXT("Actor")));
+		Test(arr[1] == Grown);
+		TestEqual(FPlatformString::Strlen(arr[0].GetStr()), 5);
+
+		Grown = Moved;
+		Test(Grown == Moved);
+		Moved = Moved + Moved;
+		Test(Moved == FString(TEXT("ActorActor")));
+		Test(FString::Concat(Moved, FString(TEXT("-")), Moved) == FString(TEXT("ActorActor-ActorActor")));
+
+		FString Empty;
+		TestEqual(Empty.GetStr()[0], TEXT('\0'));
+	}
+
+	{
+		const FString Str(TEXT("HashMe"));
+		TestEqual(GetTypeHash(Str), GetTypeHash(FStringView(TEXT("HashMe"))));
+		Test(GetTypeHash(Str) != GetTypeHash(FString(TEXT("hashme"))));
+		Test(GetTypeHash(Str) != GetTypeHash(Str.LeftView(5)));
+
+		// Long strings are hashed whole, a change in the tail gives another hash
+		FString Long;
+		for( uint32 i = 0; i < 3000; ++i )
+		{
+			Long += TEXT('x');
+		}
+		const uint64 LongHash = GetTypeHash(Long);
+		Long[2999] = TEXT('y');
+		Test(GetTypeHash(Long) != LongHash);
+	}
+
+	{
+		const FString Str(TEXT("[Section]\nKeyName=Value; the quick brown fox jumps over the lazy dog KEYNAME=Other"));
+		TestEqual(Str.Find(TEXT("keyname")), 10);
+		TestEqual(Str.Find(TEXT("keyname"), ESearchCase::CaseSensitive), INDEX_NONE);
+		TestEqual(Str.Find(TEXT("KEYNAME"), ESearchCase::CaseSensitive), 69);
+		TestEqual(Str.Find(TEXT("keyname"), ESearchCase::IgnoreCase, ESearchDir::FromEnd), 69);
+		TestEqual(Str.Find(TEXT("keyname"), ESearchCase::IgnoreCase, ESearchDir::FromEnd, 69), 10);
+		TestEqual(Str.Find(TEXT("keyname"), ESearchCase::IgnoreCase, ESearchDir::FromStart, 11), 69);
+		TestEqual(Str.Find(TEXT("DOG")), 65);
+		TestEqual(Str.Find(TEXT("r")), 36);
+		TestEqual(Str.Find(TEXT("Other!")), INDEX_NONE);
+		Test(Str.Contains(TEXT("LAZY DOG")));
+		Test(!Str.Contains(TEXT("lazy cat")));
+		Test(Str.StartsWith(TEXT("[section]")));
+		Test(!Str.StartsWith(TEXT("[section]"), ESearchCase::CaseSensitive));
+		Test(Str.EndsWith(FString(TEXT("other"))));
+		Test(!Str.EndsWith(TEXT("other"), ESearchCase::CaseSensitive));
+		TestEqual(FString::Stristr(Str.GetStr(), TEXT("FOX")) - Str.GetStr(), 41);
+		TestEqual(FString::Stristr(Str.GetStr(), TEXT("x")) - Str.GetStr(), 43);
+		TestEqual(FString::Stristr(Str.GetStr(), TEXT("cat")), nullptr);
+
+		const FString Upper = Str.ToUpper();
+		Test(Upper.StartsWith(TEXT("[SECTION]\nKEYNAME=VALUE; THE QUICK"), ESearchCase::CaseSensitive));
+		Test(Upper.ToLower() == Str.ToLower());
+		Test(Upper != Str);
+		Test(FStringView(Upper).Equals(Str));
+
+		// Non-ASCII chars are not folded
+		const FString Wide(TEXT("\u00C4bc\u00E4bc\u00C4BC\u00E4BCxxxxxxxxxxxxxxxx"));
+		TestEqual(Wide.Find(TEXT("\u00E4BC")), 3);
+		TestEqual(Wide.Find(TEXT("\u00C4bc"), ESearchCase::IgnoreCase, ESearchDir::FromEnd), 6);
+		Test(Wide.ToLower().StartsWith(TEXT("\u00C4bc\u00E4bc\u00C4bc"), ESearchCase::CaseSensitive));
+	}
+
 	return PROGRAM_EXIT_SUCCESS;
-}
\ No newline at end of file
+}
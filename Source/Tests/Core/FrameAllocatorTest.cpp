@@ -0,0 +1,96 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "FrameAllocator.h"
+#include "Array.h"
+#include "TestHelpers.h"
+
+#include <thread>
+
+
+
+
+int Core_FrameAllocatorTest(int argc, char* argv[])
+{
+	{
+		FFrameAllocator::BeginFrame();
+
+		// Allocations of one frame follow each other in the arena
+		uint8* const First = static_cast<uint8*>(FFrameAllocator::Allocate(24, 8));
+		uint8* const Second = static_cast<uint8*>(FFrameAllocator::Allocate(8, 8));
+		Test(Second == First + 24);
+		Test(reinterpret_cast<UPTRINT>(FFrameAllocator::Allocate(1, 64)) % 64 == 0);
+
+		// Larger than arena block
+		void* const Large = FFrameAllocator::Allocate(FFrameAllocator::BlockSize * 2);
+		Test(Large != nullptr);
+		FMemory::MemSet(Large, 0xAA, FFrameAllocator::BlockSize * 2);
+
+		const SIZE_T Reserved = FFrameAllocator::GetThreadReservedBytes();
+		Test(Reserved > FFrameAllocator::BlockSize * 2);
+
+		// Next frame reuses the same memory and drops extra blocks
+		FFrameAllocator::BeginFrame();
+		Test(FFrameAllocator::Allocate(24, 8) == First);
+		Test(FFrameAllocator::GetThreadReservedBytes() < Reserved);
+	}
+
+	{
+		// Double buffered memory survives one frame boundary
+		FFrameAllocator::BeginFrame();
+		uint32* const Data = static_cast<uint32*>(FFrameAllocator::Allocate(sizeof(uint32) * 16, alignof(uint32), EFrameMemoryLifetime::TwoFrames));
+		for( uint32 i = 0; i < 16; ++i )
+		{
+			Data[i] = i;
+		}
+
+		FFrameAllocator::BeginFrame();
+		uint32* const NextData = static_cast<uint32*>(FFrameAllocator::Allocate(sizeof(uint32) * 16, alignof(uint32), EFrameMemoryLifetime::TwoFrames));
+		Test(NextData != Data);
+		FMemory::MemSet(NextData, 0xFF, sizeof(uint32) * 16);
+		for( uint32 i = 0; i < 16; ++i )
+		{
+			TestEqual(Data[i], i);
+		}
+
+		FFrameAllocator::BeginFrame();
+		Test(FFrameAllocator::Allocate(sizeof(uint32) * 16, alignof(uint32), EFrameMemoryLifetime::TwoFrames) == Data);
+	}
+
+	{
+		FFrameAllocator::BeginFrame();
+
+		TArray<TestComplexType, FFrameArrayAllocator> arr;
+		for( int i = 0; i < 1000; ++i )
+		{
+			arr.Emplace(i, 2);
+		}
+		TestEqual(arr.Num(), 1000u);
+		for( int i = 0; i < 1000; ++i )
+		{
+			TestEqual(arr[i].a, i);
+			Test(arr[i].IsValid());
+		}
+
+		arr.RadixSort([](const TestComplexType& Elem) { return -Elem.a; });
+		TestEqual(arr[0].a, 999);
+
+		TArray<TestComplexType, FFrameArrayAllocator> moved = MoveTemp(arr);
+		TestEqual(moved.Num(), 1000u);
+		Test(arr.IsEmpty());
+
+		TArray<TestSimpleType, FDoubleBufferedFrameArrayAllocator> views;
+		views.Add(1);
+		views.Add(2);
+		TestEqual(views[1], 2);
+	}
+
+	{
+		// Every thread has own arenas
+		FFrameAllocator::BeginFrame();
+		void* const Main = FFrameAllocator::Allocate(16);
+		void* Other = nullptr;
+		std::thread([&Other]() { Other = FFrameAllocator::Allocate(16); }).join();
+		Test(Other != nullptr && Other != Main);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,250 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MallocBinned.h"
+#include "MallocAnsi.h"
+#include "EngineMemory.h"
+#include "TestHelpers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+
+
+static FMallocBinned GTestMalloc;
+
+/**
+	Fill block with pattern of its owner, so overlapping blocks are detected on free.
+*/
+static void FillBlock(void* Ptr, SIZE_T Size, uint8 Pattern)
+{
+	FMemory::MemSet(Ptr, Pattern, Size);
+}
+
+static bool CheckBlock(const void* Ptr, SIZE_T Size, uint8 Pattern)
+{
+	const uint8* const Bytes = static_cast<const uint8*>(Ptr);
+	for( SIZE_T i = 0; i < Size; ++i )
+	{
+		if( Bytes[i] != Pattern ) return false;
+	}
+	return true;
+}
+
+/**
+	Threads allocate blocks and pass every second one to the next thread to free it.
+*/
+static bool RunCrossThreadStress()
+{
+	constexpr uint32 NumThreads = 4;
+	constexpr uint32 NumIterations = 20000;
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FMailbox
+	{
+		std::atomic<void*> Slot {nullptr};
+	};
+	FMailbox Mailboxes[NumThreads];
+	std::atomic<bool> bFailed {false};
+
+	auto Worker = [&](uint32 ThreadIndex)
+	{
+		std::vector<std::pair<void*, SIZE_T>> Owned;
+		FMailbox& Outgoing = Mailboxes[(ThreadIndex + 1) % NumThreads];
+		FMailbox& Incoming = Mailboxes[ThreadIndex];
+		const uint8 Pattern = static_cast<uint8>(0x10 + ThreadIndex);
+
+		for( uint32 i = 0; i < NumIterations; ++i )
+		{
+			const SIZE_T Size = 1 + (i * 7919 + ThreadIndex * 104729) % 2048;
+			void* const Ptr = GTestMalloc.Malloc(Size);
+			if( Ptr == nullptr || reinterpret_cast<UPTRINT>(Ptr) % FMalloc::DefaultAlignment != 0 )
+			{
+				bFailed = true;
+				return;
+			}
+			FillBlock(Ptr, Size, Pattern);
+
+			if( (i & 1) == 0 )
+			{
+				void* Expected = nullptr;
+				if( Outgoing.Slot.compare_exchange_strong(Expected, Ptr) ) continue;
+			}
+			Owned.emplace_back(Ptr, Size);
+
+			if( void* const Received = Incoming.Slot.exchange(nullptr) )
+			{
+				GTestMalloc.Free(Received);
+			}
+			if( Owned.size() > 64 )
+			{
+				for( const std::pair<void*, SIZE_T>& Block : Owned )
+				{
+					if( !CheckBlock(Block.first, Block.second, Pattern) ) bFailed = true;
+					GTestMalloc.Free(Block.first);
+				}
+				Owned.clear();
+			}
+		}
+
+		for( const std::pair<void*, SIZE_T>& Block : Owned )
+		{
+			if( !CheckBlock(Block.first, Block.second, Pattern) ) bFailed = true;
+			GTestMalloc.Free(Block.first);
+		}
+	};
+
+	std::vector<std::thread> Threads;
+	for( uint32 i = 0; i < NumThreads; ++i )
+	{
+		Threads.emplace_back(Worker, i);
+	}
+	for( std::thread& Thread : Threads )
+	{
+		Thread.join();
+	}
+
+	for( FMailbox& Mailbox : Mailboxes )
+	{
+		GTestMalloc.Free(Mailbox.Slot.exchange(nullptr));
+	}
+	return !bFailed;
+}
+
+
+
+int Core_MallocBinnedTest(int argc, char* argv[])
+{
+	Test(FMallocBinned::IsAvailable());
+
+	{
+		// Every size up to the small limit gets aligned block of at least requested size
+		for( SIZE_T Size = 0; Size <= FMallocBinned::MaxSmallSize; Size += (Size < 512 ? 1 : 97) )
+		{
+			void* const Ptr = GTestMalloc.Malloc(Size);
+			Test(Ptr != nullptr);
+			Test(reinterpret_cast<UPTRINT>(Ptr) % FMalloc::DefaultAlignment == 0);
+
+			SIZE_T BlockSize = 0;
+			Test(GTestMalloc.GetAllocationSize(Ptr, BlockSize));
+			Test(BlockSize >= Size);
+			// Size classes waste at most a quarter
+			Test(Size <= 128 || BlockSize - Size < Size / 4 + 1);
+
+			FillBlock(Ptr, Size, 0xAB);
+			GTestMalloc.Free(Ptr);
+		}
+	}
+
+	{
+		// Blocks of one size do not overlap
+		constexpr uint32 Count = 5000;
+		std::vector<void*> Blocks(Count);
+		for( uint32 i = 0; i < Count; ++i )
+		{
+			Blocks[i] = GTestMalloc.Malloc(48);
+			FillBlock(Blocks[i], 48, static_cast<uint8>(i));
+		}
+		for( uint32 i = 0; i < Count; ++i )
+		{
+			Test(CheckBlock(Blocks[i], 48, static_cast<uint8>(i)));
+			GTestMalloc.Free(Blocks[i]);
+		}
+	}
+
+	{
+		// Realloc keeps content and block while size class does not change
+		uint8* Ptr = static_cast<uint8*>(GTestMalloc.Realloc(nullptr, 20));
+		FillBlock(Ptr, 20, 0x5A);
+		Test(GTestMalloc.Realloc(Ptr, 30) == Ptr);
+
+		Ptr = static_cast<uint8*>(GTestMalloc.Realloc(Ptr, 1000));
+		Test(CheckBlock(Ptr, 20, 0x5A));
+		FillBlock(Ptr, 1000, 0x6B);
+
+		Ptr = static_cast<uint8*>(GTestMalloc.Realloc(Ptr, 200 * KB_SZ));
+		Test(CheckBlock(Ptr, 1000, 0x6B));
+		FillBlock(Ptr, 200 * KB_SZ, 0x7C);
+		Test(GTestMalloc.Realloc(Ptr, 150 * KB_SZ) == Ptr);
+
+		Ptr = static_cast<uint8*>(GTestMalloc.Realloc(Ptr, 16));
+		Test(CheckBlock(Ptr, 16, 0x7C));
+		Test(GTestMalloc.Realloc(Ptr, 0) == nullptr);
+	}
+
+	{
+		// Large blocks are reused from span cache and returned to the OS on trim
+		for( uint32 i = 0; i < 8; ++i )
+		{
+			const SIZE_T Size = (1 + i) * MB_SZ + i;
+			uint8* const Ptr = static_cast<uint8*>(GTestMalloc.Malloc(Size));
+			Test(Ptr != nullptr);
+			Ptr[0] = 1;
+			Ptr[Size - 1] = 2;
+
+			SIZE_T BlockSize = 0;
+			Test(GTestMalloc.GetAllocationSize(Ptr, BlockSize));
+			Test(BlockSize >= Size);
+			GTestMalloc.Free(Ptr);
+		}
+		GTestMalloc.Trim();
+		GTestMalloc.Free(nullptr);
+	}
+
+	{
+		// Aligned blocks from size classes and from own spans
+		for( SIZE_T Alignment = 32; Alignment <= 64 * KB_SZ; Alignment *= 2 )
+		{
+			for( SIZE_T Size : {SIZE_T(0), SIZE_T(1), SIZE_T(100), SIZE_T(1000), SIZE_T(20000), SIZE_T(100000)} )
+			{
+				void* const Ptr = GTestMalloc.MallocAligned(Size, Alignment);
+				Test(Ptr != nullptr);
+				Test(reinterpret_cast<UPTRINT>(Ptr) % Alignment == 0);
+				FillBlock(Ptr, Size, 0x3C);
+
+				void* const Grown = GTestMalloc.ReallocAligned(Ptr, Size * 3 + 1, Alignment);
+				Test(reinterpret_cast<UPTRINT>(Grown) % Alignment == 0);
+				Test(CheckBlock(Grown, Size, 0x3C));
+				GTestMalloc.FreeAligned(Grown);
+			}
+		}
+
+		// Generic implementation with header works over any allocator
+		FMallocAnsi AnsiMalloc;
+		void* Ptr = AnsiMalloc.MallocAligned(100, 256);
+		Test(reinterpret_cast<UPTRINT>(Ptr) % 256 == 0);
+		FillBlock(Ptr, 100, 0x4D);
+		Ptr = AnsiMalloc.ReallocAligned(Ptr, 5000, 128);
+		Test(reinterpret_cast<UPTRINT>(Ptr) % 128 == 0);
+		Test(CheckBlock(Ptr, 100, 0x4D));
+		AnsiMalloc.FreeAligned(Ptr);
+	}
+
+	Test(RunCrossThreadStress());
+
+	{
+		// Heap of finished thread is reused, blocks it allocated can be freed by anyone
+		void* Leftover = nullptr;
+		std::thread([&Leftover]() { Leftover = GTestMalloc.Malloc(100); }).join();
+		Test(Leftover != nullptr);
+		GTestMalloc.Free(Leftover);
+
+		std::thread([&Leftover]() { Leftover = GTestMalloc.Malloc(100); }).join();
+		Test(Leftover != nullptr);
+		GTestMalloc.Free(Leftover);
+	}
+
+	{
+		// FMemory goes through the global allocator
+		void* const Ptr = FMemory::Malloc(64);
+		Test(Ptr != nullptr);
+		Test(GMalloc != nullptr);
+		Test(!FMemory::SetupAllocator(EMallocType::Ansi));
+		FMemory::Free(Ptr);
+
+		void* const AlignedPtr = FMemory::MallocAligned(64, PLATFORM_CACHE_LINE_SIZE);
+		Test(reinterpret_cast<UPTRINT>(AlignedPtr) % PLATFORM_CACHE_LINE_SIZE == 0);
+		FMemory::FreeAligned(AlignedPtr);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -5,8 +5,175 @@
 
 
 
+struct TestCollidingKey
+{
+	int Value = 0;
+
+	bool operator==(const TestCollidingKey& Other) const noexcept { return Value == Other.Value; }
+};
+
+FORCEINLINE uint64 GetTypeHash(const TestCollidingKey& Key) noexcept
+{
+	return 7;
+}
+
+struct TestCountedValue
+{
+	static inline int Constructions = 0;
+
+	int Value;
+
+	TestCountedValue() : Value(0) { ++Constructions; }
+	TestCountedValue(const TestCountedValue& Other) : Value(Other.Value) { ++Constructions; }
+	TestCountedValue(TestCountedValue&& Other) noexcept : Value(Other.Value) { ++Constructions; }
+	TestCountedValue& operator=(const TestCountedValue& Other) = default;
+};
+
+
 
 int Core_MapTest(int argc, char* argv[])
 {
+	{
+		TMap<TestSimpleType, TestSimpleType> map;
+		TestEqual(map.IsEmpty(), true);
+		TestEqual(map.Num(), 0);
+		TestEqual(map.Contains(1), false);
+
+		for( int i = 0; i < 1000; ++i )
+		{
+			map.Insert(i, i * 2);
+		}
+		TestEqual(map.Num(), 1000);
+		TestEqual(map.GetSize(), map.Num());
+		Test(map.GetCapacity() >= map.Num());
+
+		for( int i = 0; i < 1000; ++i )
+		{
+			TestEqual(map.Contains(i), true);
+			TestEqual(map.Find(i), i * 2);
+		}
+		TestEqual(map.Contains(1000), false);
+		TestEqual(map.FindPtr(-1), nullptr);
+
+		map.Insert(5, 50);
+		TestEqual(map.Num(), 1000);
+		TestEqual(map.Find(5), 50);
+
+		map[5] += 1;
+		TestEqual(map.FindRef(5), 51);
+		map[2000] = 3;
+		TestEqual(map.Num(), 1001);
+		TestEqual(map.Find(2000), 3);
+
+		for( int i = 0; i < 1000; i += 2 )
+		{
+			map.Remove(i);
+		}
+		map.Remove(-1);
+		TestEqual(map.Num(), 501);
+		for( int i = 1; i < 1000; i += 2 )
+		{
+			TestEqual(map.Find(i), i == 5 ? 51 : i * 2);
+		}
+		for( int i = 0; i < 1000; i += 2 )
+		{
+			TestEqual(map.Contains(i), false);
+		}
+
+		uint32 Visited = 0;
+		for( TKeyValuePair<TestSimpleType, TestSimpleType>& Pair : map )
+		{
+			TestEqual(map.Find(Pair.Key), Pair.Value);
+			++Visited;
+		}
+		TestEqual(Visited, map.Num());
+
+		const uint32 Capacity = map.GetCapacity();
+		map.Clear();
+		TestEqual(map.IsEmpty(), true);
+		TestEqual(map.GetCapacity(), Capacity);
+		TestEqual(map.begin() == map.end(), true);
+
+		map.Reset();
+		TestEqual(map.GetCapacity(), 0);
+	}
+
+	{
+		TMap<TestCollidingKey, TestSimpleType> map;
+		for( int i = 0; i < 40; ++i )
+		{
+			map.Insert(TestCollidingKey{i}, i);
+		}
+		TestEqual(map.Num(), 40);
+		for( int i = 0; i < 40; ++i )
+		{
+			TestEqual(map.Find(TestCollidingKey{i}), i);
+		}
+
+		for( int i = 0; i < 40; i += 3 )
+		{
+			map.Remove(TestCollidingKey{i});
+		}
+		for( int i = 0; i < 40; ++i )
+		{
+			TestEqual(map.Contains(TestCollidingKey{i}), i % 3 != 0);
+		}
+	}
+
+	{
+		TMap<TestSimpleType, TestComplexType> map;
+		for( int i = 0; i < 100; ++i )
+		{
+			map.Insert(i, TestComplexType(i, 1));
+		}
+
+		TMap<TestSimpleType, TestComplexType> copy = map;
+		map.Reset();
+		TestEqual(copy.Num(), 100);
+		for( int i = 0; i < 100; ++i )
+		{
+			Test(copy.FindRef(i).IsValid());
+			TestEqual(copy.FindRef(i).a, i);
+		}
+
+		TMap<TestSimpleType, TestComplexType> moved = MoveTemp(copy);
+		TestEqual(copy.IsEmpty(), true);
+		TestEqual(moved.Num(), 100);
+	}
+
+	{
+		TMap<TestSimpleType, TestSelfPointerType> map;
+		for( int i = 0; i < 100; ++i )
+		{
+			map.Insert(i, TestSelfPointerType(i));
+		}
+		for( int i = 0; i < 100; i += 3 )
+		{
+			map.Remove(i);
+		}
+		for( TKeyValuePair<TestSimpleType, TestSelfPointerType>& Pair : map )
+		{
+			Test(Pair.Value.IsValid());
+			TestEqual(Pair.Value.Value, Pair.Key);
+		}
+	}
+
+	{
+		// operator[] constructs value only for missing key
+		TMap<TestSimpleType, TestCountedValue> map;
+		map[1].Value = 10;
+		TestEqual(TestCountedValue::Constructions, 1);
+
+		const int Constructions = TestCountedValue::Constructions;
+		for( int i = 0; i < 10; ++i )
+		{
+			TestEqual(map[1].Value, 10);
+		}
+		TestEqual(TestCountedValue::Constructions, Constructions);
+
+		TMap<TestSimpleType, TestSimpleType> ints;
+		TestEqual(ints[7], 0);
+	}
+
 	return PROGRAM_EXIT_SUCCESS;
-}
\ No newline at end of file
+}
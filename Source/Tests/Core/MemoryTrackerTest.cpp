@@ -0,0 +1,174 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "MemoryTracker.h"
+#include "MallocTracked.h"
+#include "MallocAnsi.h"
+#include "TestHelpers.h"
+
+#include <string>
+#include <thread>
+
+
+
+
+/**
+	Counts aligned calls that reach inner allocator.
+*/
+class FTestAlignedCountingMalloc final : public FMalloc
+{
+public:
+
+	virtual void* Malloc(SIZE_T Size) override { return Inner.Malloc(Size); }
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize) override { return Inner.Realloc(Ptr, NewSize); }
+	virtual void Free(void* Ptr) override { Inner.Free(Ptr); }
+
+	virtual void* MallocAligned(SIZE_T Size, SIZE_T Alignment) override
+	{
+		++NumAlignedCalls;
+		return Inner.MallocAligned(Size, Alignment);
+	}
+	virtual void* ReallocAligned(void* Ptr, SIZE_T NewSize, SIZE_T Alignment) override
+	{
+		++NumAlignedCalls;
+		return Inner.ReallocAligned(Ptr, NewSize, Alignment);
+	}
+	virtual void FreeAligned(void* Ptr) override
+	{
+		++NumAlignedCalls;
+		Inner.FreeAligned(Ptr);
+	}
+
+	virtual const TCHAR* GetDescriptiveName() const override { return TEXT("TestAlignedCounting"); }
+
+	FMallocAnsi Inner;
+	uint32 NumAlignedCalls = 0;
+};
+
+
+
+int Core_MemoryTrackerTest(int argc, char* argv[])
+{
+	if( !FMemoryTracker::IsEnabled() )
+	{
+		// Scopes do nothing until tracking is enabled
+		MEMORY_TAG_SCOPE(World);
+		TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::Untagged);
+	}
+
+	FMallocAnsi AnsiMalloc;
+	FMallocTracked TrackedMalloc(&AnsiMalloc);
+	Test(FMemoryTracker::IsEnabled());
+
+	{
+		TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::Untagged);
+		MEMORY_TAG_SCOPE(World);
+		TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::World);
+		{
+			FScopedMemoryTag Scope(EMemoryTag::Graphics);
+			TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::Graphics);
+		}
+		TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::World);
+	}
+	TestEqual(FMemoryTracker::GetCurrentTag(), EMemoryTag::Untagged);
+
+	{
+		const FMemoryTagStats Before = FMemoryTracker::GetTagStats(EMemoryTag::World);
+
+		void* Ptr = nullptr;
+		{
+			MEMORY_TAG_SCOPE(World);
+			Ptr = TrackedMalloc.Malloc(1000);
+			Test(reinterpret_cast<UPTRINT>(Ptr) % FMalloc::DefaultAlignment == 0);
+		}
+
+		FMemoryTagStats Stats = FMemoryTracker::GetTagStats(EMemoryTag::World);
+		TestEqual(Stats.CurrentBytes - Before.CurrentBytes, 1000);
+		TestEqual(Stats.TotalAllocations - Before.TotalAllocations, 1u);
+		Test(Stats.PeakBytes >= Stats.CurrentBytes);
+
+		// Realloc outside of scope is still charged to the owner tag
+		Ptr = TrackedMalloc.Realloc(Ptr, 3000);
+		Stats = FMemoryTracker::GetTagStats(EMemoryTag::World);
+		TestEqual(Stats.CurrentBytes - Before.CurrentBytes, 3000);
+
+		SIZE_T Size = 0;
+		TestEqual(TrackedMalloc.GetAllocationSize(Ptr, Size), false);
+
+		// Free on other thread is subtracted from the same tag
+		std::thread([&TrackedMalloc, Ptr]() { TrackedMalloc.Free(Ptr); }).join();
+		Stats = FMemoryTracker::GetTagStats(EMemoryTag::World);
+		TestEqual(Stats.CurrentBytes, Before.CurrentBytes);
+		Test(Stats.PeakBytes - Before.CurrentBytes >= 3000);
+	}
+
+	{
+		// Frame statistics count allocations between two frame starts
+		FMemoryTracker::BeginFrame();
+		{
+			MEMORY_TAG_SCOPE(Strings);
+			for( int i = 0; i < 10; ++i )
+			{
+				TrackedMalloc.Free(TrackedMalloc.Malloc(64));
+			}
+		}
+		FMemoryTracker::BeginFrame();
+
+		FMemoryTagStats Stats = FMemoryTracker::GetTagStats(EMemoryTag::Strings);
+		TestEqual(Stats.FrameAllocations, 10u);
+		TestEqual(Stats.FrameAllocatedBytes, 640u);
+		TestEqual(Stats.CurrentBytes, 0);
+
+		FMemoryTracker::BeginFrame();
+		Stats = FMemoryTracker::GetTagStats(EMemoryTag::Strings);
+		TestEqual(Stats.FrameAllocations, 0u);
+		TestEqual(Stats.TotalAllocations, 10u);
+	}
+
+	{
+		// Aligned allocations go to aligned path of inner allocator and are charged by requested size
+		FTestAlignedCountingMalloc CountingMalloc;
+		FMallocTracked AlignedTrackedMalloc(&CountingMalloc);
+		const int64 Before = FMemoryTracker::GetTagStats(EMemoryTag::Graphics).CurrentBytes;
+
+		uint8* Aligned = nullptr;
+		{
+			MEMORY_TAG_SCOPE(Graphics);
+			Aligned = static_cast<uint8*>(AlignedTrackedMalloc.MallocAligned(100, 64));
+		}
+		Test(reinterpret_cast<UPTRINT>(Aligned) % 64 == 0);
+		TestEqual(FMemoryTracker::GetTagStats(EMemoryTag::Graphics).CurrentBytes - Before, 100);
+		for( int i = 0; i < 100; ++i )
+		{
+			Aligned[i] = static_cast<uint8>(i);
+		}
+
+		Aligned = static_cast<uint8*>(AlignedTrackedMalloc.ReallocAligned(Aligned, 5000, 64));
+		Test(reinterpret_cast<UPTRINT>(Aligned) % 64 == 0);
+		TestEqual(FMemoryTracker::GetTagStats(EMemoryTag::Graphics).CurrentBytes - Before, 5000);
+
+		// Other alignment keeps content and tag
+		Aligned = static_cast<uint8*>(AlignedTrackedMalloc.ReallocAligned(Aligned, 200, 256));
+		Test(reinterpret_cast<UPTRINT>(Aligned) % 256 == 0);
+		TestEqual(FMemoryTracker::GetTagStats(EMemoryTag::Graphics).CurrentBytes - Before, 200);
+		bool bContentKept = true;
+		for( int i = 0; i < 100; ++i )
+		{
+			bContentKept = bContentKept && Aligned[i] == static_cast<uint8>(i);
+		}
+		Test(bContentKept);
+
+		AlignedTrackedMalloc.FreeAligned(Aligned);
+		TestEqual(FMemoryTracker::GetTagStats(EMemoryTag::Graphics).CurrentBytes, Before);
+		TestEqual(CountingMalloc.NumAlignedCalls, 5u);
+	}
+
+	{
+		const std::string Csv = FMemoryTracker::GetCsv();
+		Test(Csv.find("Tag,CurrentBytes,PeakBytes") == 0);
+		Test(Csv.find("\nStrings,0,") != std::string::npos);
+		Test(Csv.find("\nReflection,") != std::string::npos);
+
+		Test(std::string(FMemoryTracker::GetTagName(EMemoryTag::Graphics)) == "Graphics");
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "Name.h"
+#include "Map.h"
+#include "TestHelpers.h"
+
+#include <thread>
+
+
+
+
+
+int Core_NameTest(int argc, char* argv[])
+{
+	{
+		FName None;
+		TestEqual(None.IsNone(), true);
+		Test(FName(TEXT("")) == None);
+		Test(FName("") == None);
+		TestEqual(None.ToView().IsEmpty(), true);
+		TestEqual(FName::Find(TEXT("NameTest_Missing")).IsNone(), true);
+
+		const uint32 NumNames = FName::GetNumNames();
+
+		FName Actor(TEXT("NameTest_Actor"));
+		TestEqual(Actor.IsNone(), false);
+		Test(FName(TEXT("NAMETEST_ACTOR")) == Actor);
+		Test(FName("nametest_actor") == Actor);
+		Test(FName(FString(TEXT("NameTest_Actor"))) == Actor);
+		Test(FName::Find(TEXT("nameTest_actor")) == Actor);
+		Test(FName(TEXT("NameTest_Pawn")) != Actor);
+		TestEqual(FName::GetNumNames(), NumNames + 2);
+
+		// First registered spelling is kept
+		Test(FName(TEXT("NAMETEST_ACTOR")).ToView().Equals(TEXT("NameTest_Actor"), ESearchCase::CaseSensitive));
+		Test(Actor.ToString() == FString(TEXT("NameTest_Actor")));
+		TestEqual(Actor.GetStringHash(), FName(TEXT("nametest_actor")).GetStringHash());
+		TestEqual(FName(TEXT("NameTest_Actor_Long_Enough_To_Not_Fit_Inline_Buffer")).ToView().Len(), 51);
+	}
+
+	{
+		TMap<FName, int32> map;
+		map.Insert(FName(TEXT("NameTest_A")), 1);
+		map.Insert(FName(TEXT("NameTest_B")), 2);
+		TestEqual(*map.FindPtr(FName(TEXT("nametest_a"))), 1);
+		TestEqual(*map.FindPtr(FName(TEXT("NAMETEST_B"))), 2);
+		TestEqual(map.FindPtr(FName(TEXT("NameTest_C"))), nullptr);
+	}
+
+	{
+		// Many threads interning overlapping names must agree on indices
+		constexpr uint32 NumThreads = 4;
+		constexpr uint32 NumPerThread = 2000;
+		TArray<uint32> Indices[NumThreads];
+		TArray<std::thread> Threads;
+		for( uint32 t = 0; t < NumThreads; ++t )
+		{
+			Threads.PushBack(std::thread(
+				[&Indices, t]()
+				{
+					for( uint32 i = 0; i < NumPerThread; ++i )
+					{
+						const FString Str = FString(TEXT("NameTest_Thread_")) + FString::FromInt(i);
+						Indices[t].PushBack(FName(Str).GetIndex());
+					}
+				}
+			));
+		}
+		for( std::thread& Thread : Threads )
+		{
+			Thread.join();
+		}
+
+		for( uint32 i = 0; i < NumPerThread; ++i )
+		{
+			for( uint32 t = 1; t < NumThreads; ++t )
+			{
+				TestEqual(Indices[t][i], Indices[0][i]);
+			}
+		}
+		TestEqual(FName::Find(TEXT("NAMETEST_THREAD_1999")).GetIndex(), Indices[0][NumPerThread - 1]);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
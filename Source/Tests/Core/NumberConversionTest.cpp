@@ -0,0 +1,220 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "NumberConversion.h"
+#include "FString.h"
+#include "TestHelpers.h"
+
+#include <clocale>
+#include <cstring>
+#include <limits>
+
+
+
+
+
+template<typename T>
+static FString FormatNumber(T Value)
+{
+	TCHAR Chars[FNumberConversion::MaxFloatChars];
+	return FString(FStringView(Chars, FNumberConversion::Format(Value, Chars)));
+}
+
+template<typename T>
+static TNumberParseResult<ANSICHAR> ParseNumber(const ANSICHAR* Text, T& OutValue)
+{
+	return FNumberConversion::Parse(Text, Text + strlen(Text), OutValue);
+}
+
+
+
+int Core_NumberConversionTest(int argc, char* argv[])
+{
+	{
+		Test(FormatNumber(int32(0)) == FString(TEXT("0")));
+		Test(FormatNumber(int32(-7)) == FString(TEXT("-7")));
+		Test(FormatNumber(uint32(1234567890)) == FString(TEXT("1234567890")));
+		Test(FormatNumber(int64(-9223372036854775807ll - 1)) == FString(TEXT("-9223372036854775808")));
+		Test(FormatNumber(uint64(18446744073709551615ull)) == FString(TEXT("18446744073709551615")));
+
+		Test(FString::FromInt(-120) == FString(TEXT("-120")));
+		Test(FString::FormatAsNumber(1234567) == FString(TEXT("1,234,567")));
+		Test(FString::FormatAsNumber(-123) == FString(TEXT("-123")));
+		Test(FString::FormatAsNumber(-1234) == FString(TEXT("-1,234")));
+		Test(FString::FormatAsNumber(999) == FString(TEXT("999")));
+	}
+
+	{
+		int32 Value = 5;
+		auto Result = ParseNumber("-2147483648 rest", Value);
+		Test(Result.IsOk());
+		TestEqual(Value, -2147483647 - 1);
+		TestEqual(*Result.End, ' ');
+
+		Value = 5;
+		Result = ParseNumber("2147483648", Value);
+		Test(Result.Error == ENumberParseError::OutOfRange);
+		TestEqual(Value, 5);
+
+		Result = ParseNumber(" 1", Value);
+		Test(Result.Error == ENumberParseError::Invalid);
+		Result = ParseNumber("-", Value);
+		Test(Result.Error == ENumberParseError::Invalid);
+
+		uint8 Byte = 0;
+		Test(ParseNumber("255", Byte).IsOk());
+		TestEqual(Byte, 255);
+		Test(ParseNumber("256", Byte).Error == ENumberParseError::OutOfRange);
+		Test(ParseNumber("-1", Byte).Error == ENumberParseError::Invalid);
+
+		uint64 Big = 0;
+		Test(ParseNumber("18446744073709551615", Big).IsOk());
+		TestEqual(Big, 18446744073709551615ull);
+		Test(ParseNumber("18446744073709551616", Big).Error == ENumberParseError::OutOfRange);
+	}
+
+	{
+		Test(FormatNumber(0.1) == FString(TEXT("0.1")));
+		Test(FormatNumber(0.1f) == FString(TEXT("0.1")));
+		Test(FormatNumber(1.0f / 3.0f) == FString(TEXT("0.33333334")));
+		Test(FormatNumber(2.0) == FString(TEXT("2.0")));
+		Test(FormatNumber(-2.5) == FString(TEXT("-2.5")));
+		Test(FormatNumber(0.001) == FString(TEXT("0.001")));
+		Test(FormatNumber(1e20) == FString(TEXT("1e+20")));
+		Test(FormatNumber(1.5e-7) == FString(TEXT("1.5e-07")));
+		Test(FormatNumber(5e-324) == FString(TEXT("5e-324")));
+		Test(FormatNumber(1.7976931348623157e308) == FString(TEXT("1.7976931348623157e+308")));
+		Test(FormatNumber(TNumericLimits<float>::Max()) == FString(TEXT("3.4028235e+38")));
+
+		// Every value is read back exactly
+		uint64 Bits = 0x9E3779B97F4A7C15ull;
+		for( uint32 i = 0; i < 10000; ++i )
+		{
+			Bits = Bits * 6364136223846793005ull + 1442695040888963407ull;
+
+			double Value;
+			memcpy(&Value, &Bits, sizeof(Value));
+			if( Value != Value ) continue;
+
+			ANSICHAR Chars[FNumberConversion::MaxFloatChars];
+			const uint32 NumChars = FNumberConversion::FormatDouble(Value, Chars);
+
+			double Parsed = 0;
+			const auto Result = FNumberConversion::ParseFloat(Chars, Chars + NumChars, Parsed);
+			Test(Result.IsOk());
+			Test(Result.End == Chars + NumChars);
+			Test(memcmp(&Parsed, &Value, sizeof(Value)) == 0);
+
+			float FloatValue;
+			const uint32 FloatBits = static_cast<uint32>(Bits >> 32);
+			memcpy(&FloatValue, &FloatBits, sizeof(FloatValue));
+			if( FloatValue != FloatValue ) continue;
+
+			const uint32 NumFloatChars = FNumberConversion::FormatFloat(FloatValue, Chars);
+			float ParsedFloat = 0;
+			Test(FNumberConversion::ParseFloat(Chars, Chars + NumFloatChars, ParsedFloat).IsOk());
+			Test(memcmp(&ParsedFloat, &FloatValue, sizeof(FloatValue)) == 0);
+		}
+	}
+
+	{
+		double Value = 0;
+		Test(ParseNumber("1.5e3", Value).IsOk());
+		TestEqual(Value, 1500.0);
+		Test(ParseNumber(".5", Value).IsOk());
+		TestEqual(Value, 0.5);
+		Test(ParseNumber("0.30000000000000004", Value).IsOk());
+		TestEqual(Value, 0.1 + 0.2);
+		Test(ParseNumber("123456789012345678901234567890", Value).IsOk());
+		TestEqual(Value, 1.2345678901234568e29);
+		Test(ParseNumber("-INF", Value).IsOk());
+		Test(Value < 0 && Value == Value * 2);
+
+		const auto Result = ParseNumber("2e", Value);
+		Test(Result.IsOk());
+		TestEqual(Value, 2.0);
+		TestEqual(*Result.End, 'e');
+
+		Value = 1;
+		Test(ParseNumber("1e400", Value).Error == ENumberParseError::OutOfRange);
+		Test(ParseNumber("1e-400", Value).Error == ENumberParseError::OutOfRange);
+		Test(ParseNumber("e5", Value).Error == ENumberParseError::Invalid);
+		Test(ParseNumber(".", Value).Error == ENumberParseError::Invalid);
+		TestEqual(Value, 1.0);
+
+		float FloatValue = 0;
+		Test(ParseNumber("1e39", FloatValue).Error == ENumberParseError::OutOfRange);
+		Test(ParseNumber("16777217", FloatValue).IsOk());
+		TestEqual(FloatValue, 16777216.0f);
+	}
+
+	{
+		const auto FormatFixed = [](double Value, int32 Precision) {
+			TCHAR Chars[FNumberConversion::MaxFixedChars];
+			return FString(FStringView(Chars, FNumberConversion::FormatFixed(Value, Precision, Chars)));
+		};
+		Test(FormatFixed(1.5, 2) == FString(TEXT("1.50")));
+		Test(FormatFixed(2.5, 0) == FString(TEXT("2")));
+		Test(FormatFixed(-0.001, 3) == FString(TEXT("-0.001")));
+		Test(FormatFixed(0.125, 2) == FString(TEXT("0.12")));
+		Test(FormatFixed(1e20, 1) == FString(TEXT("100000000000000000000.0")));
+		Test(FormatFixed(-1e300, FNumberConversion::MaxFixedPrecision).Length() == 1 + 301 + 1 + FNumberConversion::MaxFixedPrecision);
+		Test(FormatFixed(-std::numeric_limits<double>::max(), FNumberConversion::MaxFixedPrecision).Length() == FNumberConversion::MaxFixedChars);
+		Test(FormatFixed(std::numeric_limits<double>::quiet_NaN(), 2) == FString(TEXT("nan")));
+		Test(FormatFixed(-std::numeric_limits<double>::infinity(), 2) == FString(TEXT("-inf")));
+	}
+
+	{
+		// Slow path does not depend on C locale with comma decimal separator
+		const bool bLocaleSet = setlocale(LC_NUMERIC, "de_DE.UTF-8") != nullptr || setlocale(LC_NUMERIC, "de_DE") != nullptr || setlocale(LC_NUMERIC, "German") != nullptr;
+
+		double Value = 0;
+		Test(ParseNumber("0.30000000000000004", Value).IsOk());
+		TestEqual(Value, 0.1 + 0.2);
+		Test(ParseNumber("+1.2345678901234567e-300", Value).IsOk());
+		TestEqual(Value, 1.2345678901234567e-300);
+
+		float FloatValue = 0;
+		Test(ParseNumber("0.100000001", FloatValue).IsOk());
+		TestEqual(FloatValue, 0.1f);
+
+		Test(FString::Format(FORMAT_TEXT("{:.2}"), 1.5) == FString(TEXT("1.50")));
+
+		if( bLocaleSet )
+		{
+			setlocale(LC_NUMERIC, "C");
+		}
+	}
+
+	{
+		Test(FString::SanitizeFloat(1.234) == FString(TEXT("1.234")));
+		Test(FString::SanitizeFloat(0.1f) == FString(TEXT("0.1")));
+		Test(FString::SanitizeFloat(2.0) == FString(TEXT("2.0")));
+		Test(FString::SanitizeFloat(2.0, 0) == FString(TEXT("2")));
+		Test(FString::SanitizeFloat(2.5, 3) == FString(TEXT("2.500")));
+		Test(FString::SanitizeFloat(-0.0) == FString(TEXT("0.0")));
+		Test(FString::SanitizeFloat(1e20) == FString(TEXT("1e+20")));
+		Test(FString::SanitizeFloat(5) == FString(TEXT("5.0")));
+		Test(FString::SanitizeFloat(int64(-3), 0) == FString(TEXT("-3")));
+
+		int32 Int = 0;
+		FString::LexFromString(Int, TEXT("  -42abc"));
+		TestEqual(Int, -42);
+		FString::LexFromString(Int, TEXT("abc"));
+		TestEqual(Int, 0);
+
+		uint64 Hex = 0;
+		FString::LexFromString(Hex, TEXT("0xFF"));
+		TestEqual(Hex, 255);
+
+		float Float = 0;
+		FString::LexFromString(Float, TEXT("\t0.25"));
+		TestEqual(Float, 0.25f);
+
+		Test(FString::LexTryParseString(Int, TEXT(" 17 ")));
+		TestEqual(Int, 17);
+		Test(!FString::LexTryParseString(Int, TEXT("17x")));
+		Test(!FString::LexTryParseString(Int, TEXT("")));
+		TestEqual(Int, 17);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "GenericPlatformString.h"
+#include "TestHelpers.h"
+
+
+
+
+
+template<typename CharType>
+static int32 ReferenceStrlen(const CharType* String)
+{
+	int32 Length = 0;
+	while( String[Length] != 0 )
+	{
+		++Length;
+	}
+	return Length;
+}
+
+template<typename CharType>
+static int32 Sign(int32 Value)
+{
+	return (Value > 0) - (Value < 0);
+}
+
+/**
+	@return 0 if all checks passed, otherwise failed line.
+*/
+template<typename CharType>
+static int32 TestCharType()
+{
+	// Page aligned region, so strings start and end at every offset around page boundary
+	alignas(4096) static CharType Buffer1[3 * 4096 / sizeof(CharType)];
+	alignas(4096) static CharType Buffer2[3 * 4096 / sizeof(CharType)];
+	const uint32 PageChars = 4096 / sizeof(CharType);
+	const uint32 MaxLength = 80;
+
+	for( uint32 Offset = PageChars - MaxLength - 8; Offset < PageChars + 8; ++Offset )
+	{
+		for( uint32 Length = 0; Length < MaxLength; Length += 7 )
+		{
+			for( uint32 i = 0; i < Length; ++i )
+			{
+				Buffer1[Offset + i] = static_cast<CharType>('A' + (i + Offset) % 26);
+				Buffer2[Offset + i + 1] = static_cast<CharType>('a' + (i + Offset) % 26);
+			}
+			Buffer1[Offset + Length] = 0;
+			Buffer2[Offset + Length + 1] = 0;
+
+			const CharType* const String1 = Buffer1 + Offset;
+			const CharType* const String2 = Buffer2 + Offset + 1;
+
+			if( FPlatformString::Strlen(String1) != static_cast<int32>(Length) ) return __LINE__;
+			if( FPlatformString::Strlen(String2) != ReferenceStrlen(String2) ) return __LINE__;
+
+			// Same chars in other case
+			if( FPlatformString::Stricmp(String1, String2) != 0 ) return __LINE__;
+			if( Length > 0 && FPlatformString::Strcmp(String1, String2) >= 0 ) return __LINE__;
+			if( FPlatformString::Strnicmp(String1, String2, Length / 2) != 0 ) return __LINE__;
+
+			CharType Copy[MaxLength + 1];
+			FPlatformString::Strcpy(Copy, MaxLength + 1, String1);
+			if( FPlatformString::Strcmp(Copy, String1) != 0 ) return __LINE__;
+			if( FPlatformString::Strncmp(Copy, String1, 1000) != 0 ) return __LINE__;
+
+			if( Length > 0 )
+			{
+				// Difference in the last char, greater than any letter in both cases
+				Copy[Length - 1] = '~';
+				if( Sign<CharType>(FPlatformString::Strcmp(Copy, String1)) != 1 ) return __LINE__;
+				if( Sign<CharType>(FPlatformString::Stricmp(String2, Copy)) != -1 ) return __LINE__;
+				if( FPlatformString::Strncmp(Copy, String1, Length - 1) != 0 ) return __LINE__;
+				if( FPlatformString::Strncmp(Copy, String1, Length) <= 0 ) return __LINE__;
+
+				// Shorter string is less
+				Copy[Length - 1] = 0;
+				if( FPlatformString::Strcmp(Copy, String1) >= 0 ) return __LINE__;
+				if( FPlatformString::Stricmp(String1, Copy) <= 0 ) return __LINE__;
+			}
+		}
+	}
+
+	// Only ASCII letters are folded, chars next to them and above 7 bits are compared as is
+	const CharType Punctuation1[] = {'a', '[', '@', 0};
+	const CharType Punctuation2[] = {'A', '{', '@', 0};
+	if( FPlatformString::Stricmp(Punctuation1, Punctuation2) == 0 ) return __LINE__;
+
+	const CharType High1[] = {'x', static_cast<CharType>(0xC4), 0};
+	const CharType High2[] = {'X', static_cast<CharType>(0xE4), 0};
+	if( FPlatformString::Stricmp(High1, High2) == 0 ) return __LINE__;
+
+	// Copy is truncated to destination
+	CharType Small[4];
+	const CharType Long[] = {'a', 'b', 'c', 'd', 'e', 0};
+	FPlatformString::Strncpy(Small, Long, 4);
+	if( FPlatformString::Strlen(Small) != 3 ) return __LINE__;
+
+	return 0;
+}
+
+
+
+int Core_PlatformStringTest(int argc, char* argv[])
+{
+	TestEqual(TestCharType<ANSICHAR>(), 0);
+	TestEqual(TestCharType<WIDECHAR>(), 0);
+
+	Test(FPlatformString::Stricmp("Hello", L"hELLO") == 0);
+	Test(FPlatformString::Strncmp(L"Hello", "Help", 3) == 0);
+
+	return PROGRAM_EXIT_SUCCESS;
+}
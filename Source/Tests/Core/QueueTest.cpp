@@ -0,0 +1,170 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "Queue.h"
+#include "TestHelpers.h"
+
+#include <thread>
+
+
+
+
+int Core_QueueTest(int argc, char* argv[])
+{
+	{
+		TSpscQueue<TestComplexType> queue(3);
+		TestEqual(queue.GetCapacity(), 4);
+		TestEqual(queue.IsEmpty(), true);
+
+		for( int i = 0; i < 4; ++i )
+		{
+			Test(queue.Enqueue(TestComplexType(i, 1)));
+		}
+		TestEqual(queue.Enqueue(TestComplexType(4, 1)), false);
+
+		TestComplexType Elem;
+		for( int i = 0; i < 4; ++i )
+		{
+			Test(queue.Dequeue(Elem));
+			TestEqual(Elem.a, i);
+			Test(Elem.IsValid());
+		}
+		TestEqual(queue.Dequeue(Elem), false);
+		Test(queue.Emplace(7, 1));
+	}
+
+	{
+		TMpmcQueue<TestSimpleType> queue(4);
+		for( int i = 0; i < 4; ++i )
+		{
+			Test(queue.Enqueue(i));
+		}
+		TestEqual(queue.Enqueue(4), false);
+
+		TestSimpleType Elem;
+		Test(queue.Dequeue(Elem));
+		TestEqual(Elem, 0);
+		Test(queue.Enqueue(4));
+		for( int i = 1; i < 5; ++i )
+		{
+			Test(queue.Dequeue(Elem));
+			TestEqual(Elem, i);
+		}
+		TestEqual(queue.Dequeue(Elem), false);
+	}
+
+	{
+		TSegmentedQueue<TestSelfPointerType, 4> queue;
+		for( int i = 0; i < 10; ++i )
+		{
+			queue.Emplace(i);
+		}
+
+		TestSelfPointerType Elem;
+		for( int i = 0; i < 6; ++i )
+		{
+			Test(queue.Dequeue(Elem));
+			TestEqual(Elem.Value, i);
+		}
+		queue.Enqueue(TestSelfPointerType(10));
+		for( int i = 6; i < 11; ++i )
+		{
+			Test(queue.Dequeue(Elem));
+			TestEqual(Elem.Value, i);
+		}
+		TestEqual(queue.Dequeue(Elem), false);
+	}
+
+	{
+		static constexpr int NumItems = 100000;
+
+		TSpscQueue<int> spsc(64);
+		TSegmentedQueue<int, 32> segmented;
+		std::thread Producer(
+			[&]()
+			{
+				for( int i = 0; i < NumItems; ++i )
+				{
+					while( !spsc.Enqueue(i) )
+					{
+						std::this_thread::yield();
+					}
+					segmented.Enqueue(i);
+				}
+			}
+		);
+
+		bool bOrdered = true;
+		int Elem;
+		for( int Expected = 0; Expected < NumItems; )
+		{
+			if( spsc.Dequeue(Elem) )
+			{
+				bOrdered &= Elem == Expected;
+				++Expected;
+			}
+		}
+		for( int Expected = 0; Expected < NumItems; )
+		{
+			if( segmented.Dequeue(Elem) )
+			{
+				bOrdered &= Elem == Expected;
+				++Expected;
+			}
+		}
+		Producer.join();
+		Test(bOrdered);
+	}
+
+	{
+		static constexpr int NumThreads = 4;
+		static constexpr int NumItemsPerThread = 20000;
+
+		TMpmcQueue<int> mpmc(128);
+		std::atomic<int64> Sum {0};
+		std::atomic<int> NumConsumed {0};
+
+		std::thread Threads[NumThreads * 2];
+		for( int t = 0; t < NumThreads; ++t )
+		{
+			Threads[t] = std::thread(
+				[&, t]()
+				{
+					for( int i = 0; i < NumItemsPerThread; ++i )
+					{
+						while( !mpmc.Enqueue(t * NumItemsPerThread + i) )
+						{
+							std::this_thread::yield();
+						}
+					}
+				}
+			);
+			Threads[NumThreads + t] = std::thread(
+				[&]()
+				{
+					int Elem;
+					while( NumConsumed.load() < NumThreads * NumItemsPerThread )
+					{
+						if( mpmc.Dequeue(Elem) )
+						{
+							Sum += Elem;
+							++NumConsumed;
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				}
+			);
+		}
+		for( std::thread& Thread : Threads )
+		{
+			Thread.join();
+		}
+
+		const int64 Total = static_cast<int64>(NumThreads) * NumItemsPerThread;
+		TestEqual(NumConsumed.load(), Total);
+		TestEqual(Sum.load(), Total * (Total - 1) / 2);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
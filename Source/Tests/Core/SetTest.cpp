@@ -8,5 +8,42 @@
 
 int Core_SetTest(int argc, char* argv[])
 {
+	{
+		TSet<TestSimpleType> set;
+		TestEqual(set.IsEmpty(), true);
+		TestEqual(set.Contains(0), false);
+
+		for( int i = 0; i < 1000; ++i )
+		{
+			set.Insert(i * 7);
+			set.Insert(i * 7);
+		}
+		TestEqual(set.Num(), 1000);
+		for( int i = 0; i < 1000; ++i )
+		{
+			TestEqual(set.Contains(i * 7), true);
+			TestEqual(set.Contains(i * 7 + 1), false);
+		}
+		TestEqual(set.FindRef(14), 14);
+
+		for( int i = 0; i < 1000; i += 2 )
+		{
+			set.Remove(i * 7);
+		}
+		TestEqual(set.Num(), 500);
+		for( int i = 0; i < 1000; ++i )
+		{
+			TestEqual(set.Contains(i * 7), i % 2 == 1);
+		}
+
+		uint32 Visited = 0;
+		set.ForEach([&Visited](const TestSimpleType& Key) { Visited += (Key % 14) == 7; });
+		TestEqual(Visited, 500);
+
+		set.Clear();
+		TestEqual(set.IsEmpty(), true);
+		TestEqual(set.Contains(7), false);
+	}
+
 	return PROGRAM_EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,76 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "SoAArray.h"
+#include "TestHelpers.h"
+
+
+
+
+int Core_SoAArrayTest(int argc, char* argv[])
+{
+	{
+		TSoAArray<float, double, uint8> arr;
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(arr.NumFields, 3);
+
+		for( int i = 0; i < 100; ++i )
+		{
+			TestEqual(arr.Add(i * 1.0f, i * 2.0, static_cast<uint8>(i)), i);
+		}
+		TestEqual(arr.Num(), 100);
+		Test(arr.GetCapacity() >= 100);
+
+		TestEqual(reinterpret_cast<UPTRINT>(arr.GetColumn<0>()) % 32, 0);
+		TestEqual(reinterpret_cast<UPTRINT>(arr.GetColumn<1>()) % 32, 0);
+		TestEqual(reinterpret_cast<UPTRINT>(arr.GetColumn<2>()) % 32, 0);
+
+		for( int i = 0; i < 100; ++i )
+		{
+			TestEqual(arr.Get<0>(i), i * 1.0f);
+			TestEqual(arr.Get<1>(i), i * 2.0);
+			TestEqual(arr[i].Get<2>(), i);
+		}
+
+		arr[5].Get<1>() = -1.0;
+		TestEqual(arr.Get<1>(5), -1.0);
+
+		arr.RemoveAtSwap(0);
+		TestEqual(arr.Num(), 99);
+		TestEqual(arr.Get<0>(0), 99.0f);
+		TestEqual(arr.Get<2>(0), 99);
+
+		const uint32 Index = arr.AddDefaulted();
+		TestEqual(arr.Get<0>(Index), 0.0f);
+		TestEqual(arr.Get<2>(Index), 0);
+
+		TSoAArray<float, double, uint8> copy = arr;
+		TestEqual(copy.Num(), arr.Num());
+		TestEqual(copy.Get<1>(5), -1.0);
+
+		arr.Reset();
+		TestEqual(arr.GetCapacity(), 0);
+		TestEqual(copy.Get<0>(1), 1.0f);
+	}
+
+	{
+		TSoAArray<TestSelfPointerType, TestComplexType> arr;
+		for( int i = 0; i < 50; ++i )
+		{
+			arr.Emplace(TestSelfPointerType(i), TestComplexType(i, 1));
+		}
+		arr.RemoveAtSwap(10);
+		arr.PopBack();
+
+		TSoAArray<TestSelfPointerType, TestComplexType> moved = MoveTemp(arr);
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(moved.Num(), 48);
+		for( uint32 i = 0; i < moved.Num(); ++i )
+		{
+			Test(moved.Get<0>(i).IsValid());
+			Test(moved.Get<1>(i).IsValid());
+			TestEqual(moved.Get<0>(i).Value, moved.Get<1>(i).a);
+		}
+		TestEqual(moved.Get<0>(10).Value, 49);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "SparseArray.h"
+#include "TestHelpers.h"
+
+
+
+
+int Core_SparseArrayTest(int argc, char* argv[])
+{
+	{
+		TSparseArray<TestSimpleType> arr;
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(arr.begin() == arr.end(), true);
+
+		for( int i = 0; i < 100; ++i )
+		{
+			TestEqual(arr.Add(i), i);
+		}
+		TestEqual(arr.Num(), 100);
+
+		for( int i = 0; i < 100; i += 2 )
+		{
+			arr.RemoveAt(i);
+		}
+		TestEqual(arr.Num(), 50);
+		TestEqual(arr.GetMaxIndex(), 100);
+		for( int i = 0; i < 100; ++i )
+		{
+			TestEqual(arr.IsValidIndex(i), i % 2 == 1);
+			if( i % 2 == 1 ) TestEqual(arr[i], i);
+		}
+
+		uint32 Visited = 0;
+		for( TSparseArrayIterator<TestSimpleType, TSparseArray<TestSimpleType>::SlotType> It = arr.begin(); It != arr.end(); ++It )
+		{
+			TestEqual(*It, static_cast<int>(It.GetIndex()));
+			TestEqual(It.GetIndex() % 2, 1);
+			++Visited;
+		}
+		TestEqual(Visited, 50);
+
+		// Holes are reused before the array grows
+		for( int i = 0; i < 50; ++i )
+		{
+			const uint32 Index = arr.Add(-1);
+			TestEqual(Index % 2, 0);
+		}
+		TestEqual(arr.GetMaxIndex(), 100);
+		TestEqual(arr.Add(-1), 100);
+
+		arr.Clear();
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(arr.Add(7), 0);
+	}
+
+	{
+		TSparseArray<TestSelfPointerType> arr;
+		for( int i = 0; i < 200; ++i )
+		{
+			arr.Emplace(i);
+			if( i % 3 == 0 ) arr.RemoveAt(i / 2);
+		}
+
+		TSparseArray<TestSelfPointerType> copy = arr;
+		TSparseArray<TestSelfPointerType> moved = MoveTemp(arr);
+		TestEqual(arr.IsEmpty(), true);
+		TestEqual(copy.Num(), moved.Num());
+
+		bool bAllValid = true;
+		moved.ForEach(
+			[&](uint32 Index, TestSelfPointerType& Elem)
+			{
+				bAllValid &= Elem.IsValid() && copy.IsValidIndex(Index) && copy[Index].IsValid() && copy[Index].Value == Elem.Value;
+			}
+		);
+		Test(bAllValid);
+	}
+
+	{
+		TSparseArray<TestComplexType> arr;
+		const uint32 A = arr.Emplace(1, 2);
+		const uint32 B = arr.Emplace(3, 4);
+		arr.RemoveAt(A);
+		const uint32 C = arr.Emplace(5, 6);
+		TestEqual(C, A);
+		Test(arr[B].IsValid());
+		TestEqual(arr[C].a, 5);
+		arr.Reset();
+		TestEqual(arr.GetMaxIndex(), 0);
+	}
+
+	{
+		// Appends grow storage geometrically, both for memcpy and for element by element relocation
+		constexpr uint32 Count = 10000;
+		TSparseArray<TestSimpleType> Simple;
+		TSparseArray<TestSelfPointerType> Relocated;
+
+		uint32 SimpleGrowths = 0;
+		uint32 RelocatedGrowths = 0;
+		for( uint32 i = 0; i < Count; ++i )
+		{
+			const uint32 SimpleCapacity = Simple.GetCapacity();
+			const uint32 RelocatedCapacity = Relocated.GetCapacity();
+			Simple.Add(i);
+			Relocated.Emplace(i);
+			SimpleGrowths += Simple.GetCapacity() != SimpleCapacity;
+			RelocatedGrowths += Relocated.GetCapacity() != RelocatedCapacity;
+		}
+		Test(SimpleGrowths <= 16);
+		Test(RelocatedGrowths <= 16);
+
+		bool bAllValid = true;
+		Relocated.ForEach([&bAllValid](uint32 Index, TestSelfPointerType& Elem) { bAllValid = bAllValid && Elem.IsValid() && Elem.Value == static_cast<int>(Index); });
+		Test(bAllValid);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
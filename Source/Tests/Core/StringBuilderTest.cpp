@@ -0,0 +1,66 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "FString.h"
+#include "StringBuilder.h"
+#include "TestHelpers.h"
+
+
+
+
+
+int Core_StringBuilderTest(int argc, char* argv[])
+{
+	{
+		FStringBuilder Builder;
+		TestEqual(Builder.IsEmpty(), true);
+		TestEqual(Builder.GetData()[0], TEXT('\0'));
+
+		Builder.Append(TEXT("Value: ")).Append(-42).Append(TCHAR(' ')).Append(uint64(18446744073709551615ull));
+		Test(Builder.ToView() == TEXT("Value: -42 18446744073709551615"));
+		TestEqual(Builder.IsInline(), true);
+
+		Builder.Reset();
+		Builder.Append(int64(-9223372036854775807ll - 1)).Append(' ').Append(true).Append("!");
+		Test(Builder.ToView() == TEXT("-9223372036854775808 true!"));
+
+		Builder.Reset();
+		Builder.AppendHex(0xBEEF).Append(TCHAR(' ')).Append(1.5).Append(TCHAR(' ')).Append(2.0f).Append(TCHAR(' ')).AppendFloat(3.14159, 2);
+		Test(Builder.ToView() == TEXT("BEEF 1.5 2.0 3.14"));
+
+		Builder.RemoveSuffix(5);
+		Test(Builder.ToView() == TEXT("BEEF 1.5 2.0"));
+
+		Builder.Reset();
+		Builder.AppendFloat(-0.0, 3).Append(TCHAR(' ')).AppendFloat(1.0 / 3.0, 5);
+		Test(Builder.ToView() == TEXT("0.000 0.33333"));
+	}
+
+	{
+		TStringBuilder<4> Builder;
+		for( uint32 i = 0; i < 100; ++i )
+		{
+			Builder.Append(TCHAR('a' + i % 26));
+		}
+		TestEqual(Builder.Len(), 100);
+		TestEqual(Builder.IsInline(), false);
+		TestEqual(Builder[99], TCHAR('a' + 99 % 26));
+		TestEqual(Builder.GetData()[100], TEXT('\0'));
+
+		Builder.AppendChars(TEXT('-'), 3);
+		Test(Builder.ToView().EndsWith(TEXT("v---"), ESearchCase::CaseSensitive));
+	}
+
+	{
+		const FString Name(TEXT("Actor"));
+		Test(FString::Format(FORMAT_TEXT("{} of {}"), 3, 10) == FString(TEXT("3 of 10")));
+		Test(FString::Format(FORMAT_TEXT("Name: {}, pos: {:.2}, {:.0}"), Name, 1.005f, 2.5) == FString(TEXT("Name: Actor, pos: 1.00, 2")));
+		Test(FString::Format(FORMAT_TEXT("{{{}}} }}"), TEXT("x")) == FString(TEXT("{x} }")));
+		Test(FString::Format(FORMAT_TEXT("no args")) == FString(TEXT("no args")));
+		Test(FString::Format(FORMAT_TEXT("{}{}"), "ansi", TCHAR('!')) == FString(TEXT("ansi!")));
+
+		FStringBuilder Builder;
+		Builder.AppendFormat(FORMAT_TEXT("[{}]"), Name.LeftView(3));
+		Test(Builder.ToView() == TEXT("[Act]"));
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
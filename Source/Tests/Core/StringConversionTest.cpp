@@ -0,0 +1,106 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "StringConversion.h"
+#include "FString.h"
+#include "TestHelpers.h"
+
+#include <cstring>
+
+
+
+
+
+int Core_StringConversionTest(int argc, char* argv[])
+{
+	{
+		// Long enough to go through SIMD blocks and scalar tail
+		const ANSICHAR* Ascii = "The quick brown fox jumps over the lazy dog, 0123456789";
+		const uint32 AsciiLen = static_cast<uint32>(strlen(Ascii));
+		Test(FStringConversion::IsAscii(Ascii, AsciiLen));
+		Test(FStringConversion::IsValidUtf8(Ascii, AsciiLen));
+		TestEqual(FStringConversion::GetUtf8ToWideLength(Ascii, AsciiLen), AsciiLen);
+
+		const FString Str = FString::FromAnsi(Ascii);
+		TestEqual(Str.Length(), AsciiLen);
+		Test(Str.StartsWith(TEXT("The quick brown fox"), ESearchCase::CaseSensitive));
+		Test(FString::FromUtf8(Ascii) == Str);
+		Test(FString::FromWide(Str.GetStr()) == Str);
+
+		const TArray<ANSICHAR> Utf8 = Str.ToUtf8();
+		TestEqual(Utf8.Num(), AsciiLen + 1);
+		TestEqual(strcmp(Utf8.GetData(), Ascii), 0);
+	}
+
+	{
+		// Latin-1 bytes are zero extended
+		const ANSICHAR Latin1[] = "caf\xE9 na\xEFve \xC4\xD6\xDC \xFF";
+		const FString Str = FString::FromAnsi(Latin1);
+		TestEqual(Str.Length(), sizeof(Latin1) - 1);
+		TestEqual(static_cast<uint32>(Str[3]), 0xE9u);
+		TestEqual(static_cast<uint32>(Str[Str.Length() - 1]), 0xFFu);
+		Test(!FStringConversion::IsAscii(Latin1, sizeof(Latin1) - 1));
+
+		ANSICHAR Back[sizeof(Latin1)] = {};
+		FStringConversion::WideToLatin1(reinterpret_cast<const WIDECHAR*>(Str.GetStr()), Str.Length(), Back);
+		TestEqual(memcmp(Back, Latin1, sizeof(Latin1) - 1), 0);
+
+		const WIDECHAR Wide[] = {'a', 0x20AC, 'b'};
+		ANSICHAR Narrow[3];
+		FStringConversion::WideToLatin1(Wide, 3, Narrow);
+		TestEqual(Narrow[1], '?');
+	}
+
+	{
+		// "Привет, мир! €𝄞" mixed with ASCII run longer than a block
+		const ANSICHAR Utf8[] = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! \xE2\x82\xAC\xF0\x9D\x84\x9E and some ASCII tail text";
+		const uint32 Utf8Len = sizeof(Utf8) - 1;
+		Test(FStringConversion::IsValidUtf8(Utf8, Utf8Len));
+
+		const FString Str = FString::FromUtf8(Utf8);
+		const uint32 ExpectedLength = 6 + 2 + 3 + 2 + 1 + (sizeof(WIDECHAR) == 2 ? 2 : 1) + 25;
+		TestEqual(Str.Length(), ExpectedLength);
+		TestEqual(static_cast<uint32>(Str[0]), 0x41Fu);
+		TestEqual(static_cast<uint32>(Str[13]), 0x20ACu);
+		if( sizeof(WIDECHAR) == 2 )
+		{
+			TestEqual(static_cast<uint32>(Str[14]), 0xD834u);
+			TestEqual(static_cast<uint32>(Str[15]), 0xDD1Eu);
+		}
+		else
+		{
+			TestEqual(static_cast<uint32>(Str[14]), 0x1D11Eu);
+		}
+
+		const TArray<ANSICHAR> Back = Str.ToUtf8();
+		TestEqual(Back.Num(), Utf8Len + 1);
+		TestEqual(memcmp(Back.GetData(), Utf8, Utf8Len + 1), 0);
+	}
+
+	{
+		// Malformed sequences become one replacement char each: overlong, surrogate, truncated, stray continuation
+		const ANSICHAR Bad[] = "a\xC0\xAF" "b\xED\xA0\x80" "c\xE2\x82" "d\x80" "e\xF4\x90\x80\x80";
+		const uint32 BadLen = sizeof(Bad) - 1;
+		Test(!FStringConversion::IsValidUtf8(Bad, BadLen));
+
+		const uint32 Length = FStringConversion::GetUtf8ToWideLength(Bad, BadLen);
+		WIDECHAR Wide[32];
+		TestEqual(FStringConversion::Utf8ToWide(Bad, BadLen, Wide), Length);
+
+		uint32 NumReplaced = 0;
+		for( uint32 i = 0; i < Length; ++i )
+		{
+			NumReplaced += static_cast<uint32>(Wide[i]) == FStringConversion::ReplacementChar;
+		}
+		TestEqual(Wide[0], 'a');
+		TestEqual(Wide[Length - 1], static_cast<WIDECHAR>(FStringConversion::ReplacementChar));
+		TestEqual(Length - NumReplaced, 5u);
+
+		// Unpaired surrogate is encoded as replacement char
+		const WIDECHAR Lone[] = {'x', static_cast<WIDECHAR>(0xD800), 'y'};
+		ANSICHAR Encoded[16];
+		TestEqual(FStringConversion::GetWideToUtf8Length(Lone, 3), 5u);
+		TestEqual(FStringConversion::WideToUtf8(Lone, 3, Encoded), 5u);
+		TestEqual(memcmp(Encoded, "x\xEF\xBF\xBDy", 5), 0);
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// Copyright Nord Engine. All Rights Reserved.
+#include "StringTokenizer.h"
+#include "FString.h"
+#include "TestHelpers.h"
+
+
+
+
+
+int Core_StringTokenizerTest(int argc, char* argv[])
+{
+	{
+		const FString Str = TEXT("alpha,beta,,gamma,");
+
+		TArray<FStringView> Views;
+		TestEqual(Str.ParseIntoArray(Views, TEXT(",")), 3);
+		Test(Views[0] == FStringView(TEXT("alpha")));
+		Test(Views[2] == FStringView(TEXT("gamma")));
+		// Views point into the original buffer
+		Test(Views[1].GetData() == Str.GetStr() + 6);
+
+		TestEqual(Str.ParseIntoArray(Views, TEXT(","), false), 5);
+		Test(Views[2].IsEmpty());
+		Test(Views[4].IsEmpty());
+
+		TArray<FString> Strings;
+		TestEqual(Str.ParseIntoArray(Strings, TEXT(",")), 3);
+		Test(Strings[1] == FString(TEXT("beta")));
+		TestEqual(Str.ParseIntoArray(Strings, TEXT("")), 0);
+		TestEqual(FString().ParseIntoArray(Strings, TEXT(",")), 0);
+	}
+
+	{
+		// Multi-char delimiter and text long enough for SIMD scan
+		const FString Str = TEXT("first token here::second::::third one is a bit longer than a vector::");
+
+		TArray<FStringView> Views;
+		TestEqual(Str.ParseIntoArray(Views, TEXT("::")), 3);
+		Test(Views[0] == FStringView(TEXT("first token here")));
+		Test(Views[1] == FStringView(TEXT("second")));
+		Test(Views[2] == FStringView(TEXT("third one is a bit longer than a vector")));
+
+		TestEqual(Str.ParseIntoArray(Views, TEXT("::"), false), 5);
+		Test(Views[2].IsEmpty());
+
+		// Delimiter is case sensitive
+		TestEqual(FString(TEXT("aXbxc")).ParseIntoArray(Views, TEXT("x")), 2);
+	}
+
+	{
+		const FString Str = TEXT("  one  two   three ");
+
+		uint32 Count = 0;
+		for( FStringView Token : Str.Tokenize(TEXT(" ")) )
+		{
+			Test(!Token.IsEmpty());
+			++Count;
+		}
+		TestEqual(Count, 3u);
+
+		FStringTokenizer Tokenizer(Str, TEXT(" "), false);
+		FStringView Token;
+		Count = 0;
+		while( Tokenizer.Next(Token) )
+		{
+			++Count;
+		}
+		TestEqual(Count, 9u);
+
+		Tokenizer.Reset();
+		Test(Tokenizer.Next(Token));
+		Test(Token.IsEmpty());
+
+		FStringTokenizer Whole(TEXT("no delimiter"), FStringView());
+		Test(Whole.Next(Token));
+		Test(Token == FStringView(TEXT("no delimiter")));
+		Test(!Whole.Next(Token));
+	}
+
+	{
+		const FString Str = TEXT("Key=Value=More");
+
+		FStringView Left, Right;
+		Test(Str.Split(TEXT("="), &Left, &Right));
+		Test(Left == FStringView(TEXT("Key")));
+		Test(Right == FStringView(TEXT("Value=More")));
+
+		Test(Str.Split(TEXT("="), &Left, &Right, ESearchCase::CaseSensitive, ESearchDir::FromEnd));
+		Test(Left == FStringView(TEXT("Key=Value")));
+		Test(Right == FStringView(TEXT("More")));
+
+		Test(Str.Split(TEXT("value"), nullptr, &Right));
+		Test(Right == FStringView(TEXT("=More")));
+		Test(!Str.Split(TEXT("value"), nullptr, &Right, ESearchCase::CaseSensitive));
+		Test(!Str.Split(TEXT(";"), &Left, nullptr));
+		Test(Left == FStringView(TEXT("Key=Value")));
+	}
+
+	return PROGRAM_EXIT_SUCCESS;
+}
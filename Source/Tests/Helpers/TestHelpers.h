@@ -139,4 +139,23 @@ public:
 	short int b = 0;
 	char* mem = nullptr;
 	unsigned long long int res = 0;
-};
\ No newline at end of file
+};
+
+/**
+	Keeps pointer to itself, so it is broken by memcpy relocation.
+*/
+struct TestSelfPointerType
+{
+	TestSelfPointerType(int InValue = 0) : Value(InValue), Self(this) { }
+	TestSelfPointerType(const TestSelfPointerType& Other) : Value(Other.Value), Self(this) { }
+	TestSelfPointerType& operator=(const TestSelfPointerType& Other)
+	{
+		Value = Other.Value;
+		return *this;
+	}
+
+	bool IsValid() const noexcept { return Self == this; }
+
+	int Value;
+	TestSelfPointerType* Self;
+};